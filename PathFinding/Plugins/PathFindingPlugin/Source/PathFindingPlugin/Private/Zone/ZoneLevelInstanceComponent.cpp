@@ -1,5 +1,6 @@
 #include "Zone/ZoneLevelInstanceComponent.h"
 #include "Zone/ZonePathScoreCache.h"
+#include "Zone/ZonePathCacheFormat.h"
 #include "Engine/World.h"
 #include "Engine/Engine.h"
 #include "Engine/LevelStreamingDynamic.h"
@@ -26,13 +27,9 @@ void UZoneLevelInstanceComponent::BeginPlay()
 	{
 		SetupPathCache();
 		// 캐시된 경로 데이터 로드 시도
-		if (compPathScoreCache)
+		if (compPathScoreCache && !compPathScoreCache->IsGridGenerated())/*modify_261016_: 매니저가 미리 로드(웜 로드/풀 재사용)한 캐시는 다시 읽지 않음*/
 		{
-			FString saveDir = FPaths::ProjectSavedDir() / TEXT("PathFindingCache");
-			FString fileName = FString::Printf(TEXT("%s_%d.json"),
-				*zoneData.zoneIdentifier.zoneName.ToString(),
-				zoneData.zoneIdentifier.zoneID);
-			FString filePath = saveDir / fileName;
+			FString filePath = NZonePathCacheFormat::GetCacheFilePath(zoneData.zoneIdentifier);/*modify_261016_: 바이너리 캐시 경로 공용 함수 사용*/
 
 			if (FPaths::FileExists(filePath))
 			{
@@ -49,15 +46,9 @@ void UZoneLevelInstanceComponent::EndPlay(const EEndPlayReason::Type inEndPlayRe
 		// 경로 캐시 저장
 		if (compPathScoreCache && compPathScoreCache->IsGridGenerated())
 		{
-			FString saveDir = FPaths::ProjectSavedDir() / TEXT("PathFindingCache");
-			IFileManager::Get().MakeDirectory(*saveDir, true);
-
-			FString fileName = FString::Printf(TEXT("%s_%d.json"),
-				*zoneData.zoneIdentifier.zoneName.ToString(),
-				zoneData.zoneIdentifier.zoneID);
-			FString filePath = saveDir / fileName;
-
-			compPathScoreCache->SaveCacheToFile(filePath);
+			/*modify_261016_: 진행 중인 백그라운드 저장과 겹치지 않도록 비동기 요청 후 완료 대기*/
+			compPathScoreCache->SaveCacheToFileAsync(NZonePathCacheFormat::GetCacheFilePath(zoneData.zoneIdentifier));
+			compPathScoreCache->WaitForPendingSave();
 		}
 		UnloadZone();
 	}
@@ -158,6 +149,12 @@ void UZoneLevelInstanceComponent::UnloadZone()
 
 	SetLoadState(EZoneLoadState::Unloading);
 
+	// 언로드되는 레벨에 대한 분할 베이크는 더 이상 의미 없음
+	if (compPathScoreCache)
+	{
+		compPathScoreCache->CancelGeneration();
+	}
+
 	if (compLevelStreamingInstance)
 	{
 		compLevelStreamingInstance->SetShouldBeLoaded(false);
@@ -187,12 +184,25 @@ void UZoneLevelInstanceComponent::GeneratePathCache()
 
 	if (compPathScoreCache)
 	{
+		/*modify_261016_: 분할 생성 시 준비 완료 이벤트는 OnPathCacheGenerationCompleted에서 발생*/
+		if (zoneData.pathSettings.bTimeSlicedGeneration)
+		{
+			compPathScoreCache->BeginTimeSlicedGeneration(zoneData);
+			return;
+		}
+
 		compPathScoreCache->GeneratePathGrid(zoneData);
 		OnZonePathCacheReady.Broadcast(zoneData.zoneIdentifier);
 		UE_LOG(LogTemp, Log, TEXT("Path cache generated for zone: %s"), *zoneData.zoneIdentifier.ToString());
 	}
 }
 
+void UZoneLevelInstanceComponent::OnPathCacheGenerationCompleted(const FZoneIdentifier& inZoneID)
+{
+	OnZonePathCacheReady.Broadcast(zoneData.zoneIdentifier);
+	UE_LOG(LogTemp, Log, TEXT("Path cache generated for zone: %s"), *zoneData.zoneIdentifier.ToString());
+}
+
 bool UZoneLevelInstanceComponent::IsPathCacheReady() const
 {
 	return compPathScoreCache && compPathScoreCache->IsGridGenerated();
@@ -283,7 +293,16 @@ void UZoneLevelInstanceComponent::OnLevelLoaded()
 
 	if (bGeneratePathCacheOnLoad)
 	{
-		GeneratePathCache();
+		/*modify_261016_: 같은 레벨 내용으로 베이크된 그리드가 남아 있으면 콜리전 베이크 생략*/
+		if (compPathScoreCache && compPathScoreCache->CanReuseGrid(zoneData))
+		{
+			OnZonePathCacheReady.Broadcast(zoneData.zoneIdentifier);
+			UE_LOG(LogTemp, Log, TEXT("Path cache reused for zone: %s"), *zoneData.zoneIdentifier.ToString());
+		}
+		else
+		{
+			GeneratePathCache();
+		}
 	}
 }
 
@@ -347,10 +366,42 @@ void UZoneLevelInstanceComponent::CreateLevelStreamingInstance()
 	}
 }
 
+void UZoneLevelInstanceComponent::SetPathScoreCache(UZonePathScoreCache* inPathScoreCache)
+{
+	if (compPathScoreCache == inPathScoreCache)
+	{
+		return;
+	}
+
+	if (compPathScoreCache)
+	{
+		compPathScoreCache->OnZonePathGenerationCompleted.RemoveDynamic(this, &UZoneLevelInstanceComponent::OnPathCacheGenerationCompleted);
+	}
+
+	compPathScoreCache = inPathScoreCache;
+
+	if (compPathScoreCache)
+	{
+		compPathScoreCache->OnZonePathGenerationCompleted.AddUniqueDynamic(this, &UZoneLevelInstanceComponent::OnPathCacheGenerationCompleted);
+		compPathScoreCache->SetPathSettings(zoneData.pathSettings);
+	}
+}
+
+UZonePathScoreCache* UZoneLevelInstanceComponent::DetachPathScoreCache()
+{
+	UZonePathScoreCache* detachedCache = compPathScoreCache;
+	SetPathScoreCache(nullptr);
+	return detachedCache;
+}
+
 void UZoneLevelInstanceComponent::SetupPathCache()
 {
 	if (!compPathScoreCache)
 	{
 		compPathScoreCache = NewObject<UZonePathScoreCache>(this);
+		compPathScoreCache->OnZonePathGenerationCompleted.AddDynamic(this, &UZoneLevelInstanceComponent::OnPathCacheGenerationCompleted);
 	}
+
+	// 경로 탐색 옵션(대각선/수직 이동) 전달
+	compPathScoreCache->SetPathSettings(zoneData.pathSettings);
 }
\ No newline at end of file
@@ -1,11 +1,56 @@
 #include "Zone/ZoneManager.h"
 #include "Zone/ZoneLevelInstanceComponent.h"
 #include "Zone/ZonePathScoreCache.h"
+#include "Zone/ZonePathCacheFormat.h"
 #include "Engine/World.h"
 #include "Engine/Engine.h"
 #include "Engine/DataTable.h"
 #include "TimerManager.h"
 #include "DrawDebugHelpers.h"
+#include "Algo/Reverse.h"
+#include "Async/Async.h"
+#include "Async/ParallelFor.h"
+#include "HAL/FileManager.h"
+
+namespace
+{
+	/** @Brief Heap ordering for AZoneManager::loadingQueue (lowest score first, then oldest) */
+	struct FLoadRequestPredicate
+	{
+		FORCEINLINE bool operator()(const FZoneLoadRequest& inA, const FZoneLoadRequest& inB) const
+		{
+			return inA.loadScore < inB.loadScore || (inA.loadScore == inB.loadScore && inA.sequence < inB.sequence);
+		}
+	};
+
+	/** @Brief Bytes per MB for FZoneManagerSettings::memoryBudgetMB and FZoneLevelData::estimatedLevelMemoryMB */
+	constexpr double BYTES_PER_MB = 1024.0 * 1024.0;
+
+	/** @Brief Zone level or path cache that may be evicted to meet the memory budget */
+	struct FZoneEvictionCandidate
+	{
+		FZoneIdentifier zoneIdentifier;
+		UZoneLevelInstanceComponent* zoneComponent;
+		UZonePathScoreCache* pathScoreCache;
+		double lastUsedTime;
+		int64 bytes;
+	};
+
+	/** @Brief Cache files decoded per worker thread in each AZoneManager::WarmLoadZoneCaches batch */
+	constexpr int32 WARM_LOAD_FILES_PER_WORKER = 2;
+
+	/** @Brief Zone whose cache file AZoneManager::WarmLoadZoneCaches may install */
+	struct FZoneCacheWarmLoadTarget
+	{
+		UZoneLevelInstanceComponent* zoneComponent = nullptr;
+		FString filePath;
+		bool bPersistent = false;
+		int32 priority = 0;
+		float sourceDistance = 0.0f;
+	};
+}
+
+const FName AZoneManager::DEFAULT_STREAMING_SOURCE(TEXT("Player"));
 
 AZoneManager::AZoneManager()
 {
@@ -13,13 +58,24 @@ AZoneManager::AZoneManager()
 	PrimaryActorTick.TickInterval = 1.0f;
 
 	bIsInitialized = false;
+	bPathHierarchyLinksDirty = false;
+	bZoneAdjacencyDirty = true;
 	playerPosition = FVector::ZeroVector;
+	playerVelocity = FVector::ZeroVector;
+	nextLoadRequestSequence = 0;
+	maxAutoLoadDistance = 0.0f;
+	bMemoryBudgetExceeded = false;
+	lastCacheWarmUpSeconds = 0.0f;
+	bDefaultStreamingSourceSampled = false;/*modify_261016_: 첫 갱신에서 기본 소스 등록*/
 }
 
 void AZoneManager::BeginPlay()
 {
 	Super::BeginPlay();
 
+	// 에디터에서 설정한 공간 인덱스 셀 크기 반영
+	zoneSpatialIndex.SetCellSize(settings.spatialIndexCellSize);
+
 	// 기본 데이터 테이블이 설정되어 있다면 자동 초기화
 	if (defaultZoneDataTable)
 	{
@@ -63,6 +119,7 @@ void AZoneManager::EndPlay(const EEndPlayReason::Type inEndPlayReason)
 	if (settings.bSaveZoneCachesToDisk)
 	{
 		SaveAllZoneCaches();
+		WaitForZoneCacheSaves();
 	}
 
 	// Zone 컴포넌트 정리
@@ -76,6 +133,9 @@ void AZoneManager::Tick(float inDeltaTime)
 	Super::Tick(inDeltaTime);
 
 	ProcessLoadingQueue();
+	ProcessDeferredCacheEvictions();/*modify_261016_: 저장 완료를 기다리던 캐시 축출*/
+	ProcessPendingCacheDecodes();/*modify_261016_: 로드 시작 시 요청한 캐시 디코딩 결과 설치*/
+	EnforceMemoryBudget();
 
 	if (settings.bEnableDebugDisplay)
 	{
@@ -109,6 +169,12 @@ void AZoneManager::InitializeFromDataTable(UDataTable* inZoneDataTable)
 
 	bIsInitialized = (successCount > 0);
 
+	// 레벨 로드 전에 디스크 캐시를 병렬로 미리 디코딩
+	if (settings.bWarmLoadZoneCaches && successCount > 0)
+	{
+		WarmLoadZoneCaches();
+	}
+
 	UE_LOG(LogTemp, Log, TEXT("Zone Manager initialized: %d zones registered from DataTable"), successCount);
 	OnZoneManagerInitialized.Broadcast(bIsInitialized);
 }
@@ -144,6 +210,9 @@ bool AZoneManager::RegisterZone(const FZoneLevelData& inZoneData)
 		return false;
 	}
 
+	// 풀에 남은 같은 레벨 내용의 캐시를 재사용 (없으면 새로 생성)
+	zoneComponent->SetPathScoreCache(AcquirePathCache(inZoneData));
+
 	// Zone 초기화
 	zoneComponent->InitializeZone(inZoneData);
 
@@ -152,6 +221,23 @@ bool AZoneManager::RegisterZone(const FZoneLevelData& inZoneData)
 
 	// Zone 등록
 	zoneComponents.Add(inZoneData.zoneIdentifier, zoneComponent);
+	zoneSpatialIndex.AddZone(inZoneData.zoneIdentifier, inZoneData.zoneBounds);
+	if (inZoneData.bAutoLoad)
+	{
+		maxAutoLoadDistance = FMath::Max(maxAutoLoadDistance, inZoneData.loadDistance);
+		for (auto& sourcePair : streamingSources)
+		{
+			TrackZoneForSource(sourcePair.Value, inZoneData);
+		}
+	}
+
+	// 연결 대상 존은 도착 앵커가 늘어나므로 계층 그래프 재구축 대상
+	for (const FZoneConnectionPoint& connection : inZoneData.connectionPoints)
+	{
+		pathHierarchy.RemoveZoneGraph(connection.targetZone);
+	}
+	bPathHierarchyLinksDirty = true;
+	InvalidateZoneAdjacency();
 
 	UE_LOG(LogTemp, Log, TEXT("Zone registered: %s"), *inZoneData.zoneIdentifier.ToString());
 	OnZoneRegistered.Broadcast(inZoneData.zoneIdentifier, true);
@@ -169,6 +255,9 @@ bool AZoneManager::UnregisterZone(const FZoneIdentifier& inZoneIdentifier)
 
 	UZoneLevelInstanceComponent* zoneComponent = *zoneComponentPtr;
 
+	// 대기 중인 로드 요청 취소
+	CancelZoneLoad(inZoneIdentifier);
+
 	// Zone 언로드
 	if (zoneComponent->IsZoneLoaded())
 	{
@@ -178,8 +267,32 @@ bool AZoneManager::UnregisterZone(const FZoneIdentifier& inZoneIdentifier)
 	// 이벤트 언바인딩
 	zoneComponent->OnZoneLoadStateChanged.RemoveAll(this);
 
+	// 계층 그래프에서 제거 (연결 대상 존은 도착 앵커가 줄어드므로 재구축)
+	pathHierarchy.RemoveZoneGraph(inZoneIdentifier);
+	for (const FZoneConnectionPoint& connection : zoneComponent->GetZoneData().connectionPoints)
+	{
+		pathHierarchy.RemoveZoneGraph(connection.targetZone);
+	}
+	bPathHierarchyLinksDirty = true;
+
 	// Map에서 제거
 	zoneComponents.Remove(inZoneIdentifier);
+	zoneSpatialIndex.RemoveZone(inZoneIdentifier);
+	for (auto& sourcePair : streamingSources)
+	{
+		sourcePair.Value.proximityTracker.RemoveZone(inZoneIdentifier);
+		sourcePair.Value.interestedZones.Remove(inZoneIdentifier);
+		sourcePair.Value.prefetchedZones.Remove(inZoneIdentifier);
+	}
+	zoneInterestCounts.Remove(inZoneIdentifier);
+	interestLoadingZones.Remove(inZoneIdentifier);
+	pendingCacheDecodes.Remove(inZoneIdentifier);/*modify_261016_: 디코딩 결과는 버림 (워커는 객체를 건드리지 않음)*/
+	pendingPrefetches.Remove(inZoneIdentifier);
+	zoneLastUsedTimes.Remove(inZoneIdentifier);
+	InvalidateZoneAdjacency();
+
+	// 생성된 경로 캐시는 재등록 시 재사용하도록 풀로 이동
+	ReturnPathCacheToPool(zoneComponent);
 
 	// 컴포넌트 제거
 	zoneComponent->DestroyComponent();
@@ -202,6 +315,7 @@ void AZoneManager::UnregisterAllZones()
 
 	loadingQueue.Empty();
 	currentlyLoading.Empty();
+	interestLoadingZones.Empty();/*modify_261016_: 진행 중 로드 기록도 함께 비움*/
 }
 
 UZoneLevelInstanceComponent* AZoneManager::FindZoneByIdentifier(const FZoneIdentifier& inZoneIdentifier) const
@@ -212,16 +326,14 @@ UZoneLevelInstanceComponent* AZoneManager::FindZoneByIdentifier(const FZoneIdent
 
 UZoneLevelInstanceComponent* AZoneManager::FindZoneContainingPosition(const FVector& inWorldPosition) const
 {
-	for (const auto& zonePair : zoneComponents)
+	/*modify_261016_: 전체 순회 대신 공간 해시 그리드 조회*/
+	FZoneIdentifier containingZone;
+	if (!zoneSpatialIndex.FindZoneContainingPoint(inWorldPosition, containingZone))
 	{
-		UZoneLevelInstanceComponent* zoneComponent = zonePair.Value;
-		if (zoneComponent && zoneComponent->ContainsWorldPosition(inWorldPosition))
-		{
-			return zoneComponent;
-		}
+		return nullptr;
 	}
 
-	return nullptr;
+	return FindZoneByIdentifier(containingZone);
 }
 
 TArray<UZoneLevelInstanceComponent*> AZoneManager::FindZonesByType(EZoneType inZoneType) const
@@ -244,10 +356,14 @@ TArray<UZoneLevelInstanceComponent*> AZoneManager::FindZonesInRadius(const FVect
 {
 	TArray<UZoneLevelInstanceComponent*> result;
 
-	for (const auto& zonePair : zoneComponents)
+	/*modify_261016_: 전체 순회 대신 공간 해시 그리드 조회*/
+	TArray<FZoneIdentifier> zonesInRadius;
+	zoneSpatialIndex.FindZonesInRadius(inCenter, inRadius, zonesInRadius);
+
+	for (const FZoneIdentifier& zoneID : zonesInRadius)
 	{
-		UZoneLevelInstanceComponent* zoneComponent = zonePair.Value;
-		if (zoneComponent && zoneComponent->GetDistanceToZone(inCenter) <= inRadius)
+		UZoneLevelInstanceComponent* zoneComponent = FindZoneByIdentifier(zoneID);
+		if (zoneComponent)
 		{
 			result.Add(zoneComponent);
 		}
@@ -268,6 +384,9 @@ void AZoneManager::LoadZone(const FZoneIdentifier& inZoneIdentifier)
 	UZoneLevelInstanceComponent* zoneComponent = FindZoneByIdentifier(inZoneIdentifier);
 	if (zoneComponent)
 	{
+		TouchZone(inZoneIdentifier);
+
+		interestLoadingZones.Remove(inZoneIdentifier);/*modify_261016_: 명시적 로드는 참조가 없어도 유지*/
 		if (currentlyLoading.Num() < settings.maxConcurrentLoads)
 		{
 			zoneComponent->LoadZone();
@@ -275,185 +394,1679 @@ void AZoneManager::LoadZone(const FZoneIdentifier& inZoneIdentifier)
 		}
 		else
 		{
-			loadingQueue.AddUnique(inZoneIdentifier);
+			EnqueueZoneLoad(zoneComponent, true);/*modify_261016_: 우선순위 큐에 명시적 요청으로 등록*/
 		}
 	}
 }
 
 void AZoneManager::UpdateAutoLoading(const FVector& inPlayerPosition)
 {
-	this->playerPosition = inPlayerPosition;
+	/*modify_261016_: 첫 갱신에서는 원점이어도 기본 소스를 등록하고, 이후에는 위치가 바뀐 경우에만 샘플로 사용 (타이머의 재호출로 속도가 감쇠하지 않도록)*/
+	if (!bDefaultStreamingSourceSampled || !inPlayerPosition.Equals(playerPosition))
+	{
+		bDefaultStreamingSourceSampled = true;
+		UpdateStreamingSource(DEFAULT_STREAMING_SOURCE, inPlayerPosition);
+	}
 
 	if (!settings.bAutoLoadZones)
 	{
 		return;
 	}
 
+	/*modify_261016_: 전체 존 순회 대신 소스별로 경계를 넘었을 수 있는 존만 평가*/
+	UpdateStreamingInterest();
+
+	ReprioritizeLoadingQueue();
+	ProcessLoadingQueue();
+}
+
+void AZoneManager::RegisterStreamingSource(FName inSourceName, float inWeight, float inInterestRadius)
+{
+	if (inSourceName.IsNone())
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Cannot register streaming source without a name"));
+		return;
+	}
+
+	const float weight = FMath::Max(inWeight, 0.01f);
+	const float interestRadius = FMath::Max(inInterestRadius, 0.0f);
+
+	if (FZoneStreamingSourceState* existingState = streamingSources.Find(inSourceName))
+	{
+		const bool bRadiusChanged = !FMath::IsNearlyEqual(existingState->source.interestRadius, interestRadius);
+		existingState->source.weight = weight;
+		existingState->source.interestRadius = interestRadius;
+
+		// 관심 반경이 바뀌면 경계가 달라지므로 모든 존을 다시 추적 (보유 중인 존은 다음 평가에서 유지/해제)
+		if (bRadiusChanged)
+		{
+			for (const auto& zonePair : zoneComponents)
+			{
+				if (zonePair.Value && zonePair.Value->GetZoneData().bAutoLoad)
+				{
+					TrackZoneForSource(*existingState, zonePair.Value->GetZoneData());
+				}
+			}
+		}
+		return;
+	}
+
+	FZoneStreamingSourceState& newState = streamingSources.Add(inSourceName);
+	newState.source.sourceName = inSourceName;
+	newState.source.weight = weight;
+	newState.source.interestRadius = interestRadius;
+
 	for (const auto& zonePair : zoneComponents)
 	{
-		UZoneLevelInstanceComponent* zoneComponent = zonePair.Value;
-		if (zoneComponent && zoneComponent->IsAutoLoadingEnabled())
+		if (zonePair.Value && zonePair.Value->GetZoneData().bAutoLoad)
 		{
-			zoneComponent->UpdateAutoLoading(inPlayerPosition);
+			TrackZoneForSource(newState, zonePair.Value->GetZoneData());
 		}
 	}
 }
 
-TArray<FZoneConnectionPoint> AZoneManager::FindConnectionsBetweenZones(const FZoneIdentifier& inFromZone, const FZoneIdentifier& inToZone) const
+bool AZoneManager::UnregisterStreamingSource(FName inSourceName)
 {
-	TArray<FZoneConnectionPoint> connections;
+	FZoneStreamingSourceState removedState;
+	if (!streamingSources.RemoveAndCopyValue(inSourceName, removedState))
+	{
+		return false;
+	}
 
-	UZoneLevelInstanceComponent* fromZoneComponent = FindZoneByIdentifier(inFromZone);
-	if (!fromZoneComponent)
+	for (const FZoneIdentifier& zoneID : removedState.interestedZones)
 	{
-		return connections;
+		ReleaseZoneInterest(zoneID);
 	}
+	for (const FZoneIdentifier& zoneID : removedState.prefetchedZones)
+	{
+		ReleaseZoneInterest(zoneID);
+	}
+	return true;
+}
 
-	const FZoneLevelData& fromZoneData = fromZoneComponent->GetZoneData();
-	for (const FZoneConnectionPoint& connection : fromZoneData.connectionPoints)
+bool AZoneManager::SetStreamingSourceRoute(FName inSourceName, const TArray<FZoneIdentifier>& inZoneSequence)
+{
+	FZoneStreamingSourceState* sourceState = streamingSources.Find(inSourceName);
+	if (!sourceState)
 	{
-		if (connection.targetZone == inToZone)
-		{
-			connections.Add(connection);
-		}
+		UE_LOG(LogTemp, Warning, TEXT("Cannot set route of unknown streaming source: %s"), *inSourceName.ToString());
+		return false;
 	}
 
-	return connections;
+	sourceState->routeZones = inZoneSequence;
+	sourceState->routeProgress = INDEX_NONE;
+	return true;
 }
 
-int32 AZoneManager::GetLoadedZoneCount() const
+void AZoneManager::ClearStreamingSourceRoute(FName inSourceName)
 {
-	int32 count = 0;
-	for (const auto& zonePair : zoneComponents)
+	// 경로로 잡고 있던 예측 참조는 다음 갱신에서 해제됨
+	if (FZoneStreamingSourceState* sourceState = streamingSources.Find(inSourceName))
 	{
-		if (zonePair.Value && zonePair.Value->IsZoneLoaded())
+		sourceState->routeZones.Reset();
+		sourceState->routeProgress = INDEX_NONE;
+	}
+}
+
+void AZoneManager::UpdateStreamingSource(FName inSourceName, const FVector& inPosition)
+{
+	FZoneStreamingSourceState* sourceState = streamingSources.Find(inSourceName);
+	if (!sourceState)
+	{
+		RegisterStreamingSource(inSourceName);
+		sourceState = streamingSources.Find(inSourceName);
+		if (!sourceState)
 		{
-			count++;
+			return;
 		}
 	}
-	return count;
+
+	const UWorld* world = GetWorld();
+	const double sampleTime = world ? world->GetTimeSeconds() : 0.0;
+	FZoneStreamingSource& source = sourceState->source;
+
+	// 같은 프레임의 반복 호출은 위치만 갱신 (0으로 나누기 방지)
+	if (sourceState->bHasPosition && sourceState->lastSampleTime >= 0.0 && sampleTime > sourceState->lastSampleTime)
+	{
+		const FVector sampleVelocity = (inPosition - source.position) / static_cast<float>(sampleTime - sourceState->lastSampleTime);
+		source.velocity = FMath::Lerp(source.velocity, sampleVelocity, PLAYER_VELOCITY_SMOOTHING);
+	}
+
+	if (sampleTime > sourceState->lastSampleTime)
+	{
+		sourceState->lastSampleTime = sampleTime;
+	}
+	source.position = inPosition;
+	sourceState->bHasPosition = true;
+
+	if (inSourceName == DEFAULT_STREAMING_SOURCE)
+	{
+		playerPosition = source.position;
+		playerVelocity = source.velocity;
+	}
 }
 
-void AZoneManager::SetZoneManagerSettings(const FZoneManagerSettings& inNewSettings)
+TArray<FZoneStreamingSource> AZoneManager::GetStreamingSources() const
 {
-	settings = inNewSettings;
-
-	// 타이머 업데이트
-	if (GetWorld())
+	TArray<FZoneStreamingSource> sources;
+	for (const auto& sourcePair : streamingSources)
 	{
-		GetWorldTimerManager().ClearTimer(autoLoadTimerHandle);
-		GetWorldTimerManager().ClearTimer(cacheSaveTimerHandle);
+		sources.Add(sourcePair.Value.source);
+	}
+	return sources;
+}
 
-		if (settings.bAutoLoadZones)
+int32 AZoneManager::GetZoneInterestCount(const FZoneIdentifier& inZoneIdentifier) const
+{
+	const int32* interestCount = zoneInterestCounts.Find(inZoneIdentifier);
+	return interestCount ? *interestCount : 0;
+}
+
+void AZoneManager::UpdateStreamingInterest()
+{
+	TArray<FZoneProximityTransition> proximityTransitions;
+
+	for (auto& sourcePair : streamingSources)
+	{
+		FZoneStreamingSourceState& sourceState = sourcePair.Value;
+		if (!sourceState.bHasPosition)
 		{
-			GetWorldTimerManager().SetTimer(
-				autoLoadTimerHandle,
-				[this]() { UpdateAutoLoading(playerPosition); },
-				settings.autoLoadCheckInterval,
-				true
-			);
+			continue;
 		}
 
-		if (settings.bSaveZoneCachesToDisk)
+		sourceState.proximityTracker.Update(sourceState.source.position, proximityTransitions);
+
+		// 로드 거리 진입 시 참조 획득, 언로드 거리 이탈 시 참조 해제 (사이 구간은 유지)
+		for (const FZoneProximityTransition& transition : proximityTransitions)
 		{
-			GetWorldTimerManager().SetTimer(
-				cacheSaveTimerHandle,
-				this,
-				&AZoneManager::SaveAllZoneCaches,
-				settings.cacheSaveInterval,
-				true
-			);
+			if (transition.newBand == EZoneProximityBand::Inside)
+			{
+				bool bAlreadyInterested = false;
+				sourceState.interestedZones.Add(transition.zoneIdentifier, &bAlreadyInterested);
+				if (!bAlreadyInterested)
+				{
+					// 참조 획득 전 상태로 예측 적중/수요 로드 집계
+					const UZoneLevelInstanceComponent* zoneComponent = FindZoneByIdentifier(transition.zoneIdentifier);
+					if (pendingPrefetches.Remove(transition.zoneIdentifier) > 0)
+					{
+						++prefetchStats.prefetchHits;
+						if (zoneComponent && zoneComponent->IsZoneLoaded())
+						{
+							++prefetchStats.readyOnArrival;
+						}
+					}
+					else if (GetZoneInterestCount(transition.zoneIdentifier) == 0
+						&& zoneComponent && zoneComponent->IsAutoLoadingEnabled() && !zoneComponent->IsZoneLoaded())
+					{
+						++prefetchStats.demandLoads;
+					}
+
+					AcquireZoneInterest(transition.zoneIdentifier);
+
+					// 예측 참조는 근접 참조로 대체 (획득 후 해제하여 카운트가 0을 거치지 않도록)
+					if (sourceState.prefetchedZones.Remove(transition.zoneIdentifier) > 0)
+					{
+						ReleaseZoneInterest(transition.zoneIdentifier);
+					}
+				}
+			}
+			else if (transition.newBand == EZoneProximityBand::Outside)
+			{
+				if (sourceState.interestedZones.Remove(transition.zoneIdentifier) > 0)
+				{
+					ReleaseZoneInterest(transition.zoneIdentifier);
+				}
+			}
 		}
+
+		UpdateSourcePrefetch(sourceState);
 	}
 }
 
-void AZoneManager::SetDebugDisplayEnabled(bool bEnabled)
+void AZoneManager::UpdateSourcePrefetch(FZoneStreamingSourceState& inOutSourceState)
 {
-	settings.bEnableDebugDisplay = bEnabled;
-}
+	// 경로 진행 위치는 앞으로만 갱신 (경로 밖으로 벗어나도 유지)
+	if (inOutSourceState.routeZones.Num() > 0)
+	{
+		FZoneIdentifier currentZone;
+		if (zoneSpatialIndex.FindZoneContainingPoint(inOutSourceState.source.position, currentZone))
+		{
+			const int32 routeIndex = inOutSourceState.routeZones.Find(currentZone);
+			if (routeIndex > inOutSourceState.routeProgress)
+			{
+				inOutSourceState.routeProgress = routeIndex;
+			}
+		}
+	}
 
-void AZoneManager::DrawDebugInfo() const
-{
-	if (!GetWorld())
+	// 메모리 예산 초과 중에는 예측 로드를 중단하여 예측 참조만 남은 존이 해제되도록 함
+	TSet<FZoneIdentifier> predictedZones;
+	if (settings.bEnablePrefetch && !bMemoryBudgetExceeded)
 	{
-		return;
+		GatherPrefetchZones(inOutSourceState, predictedZones);
 	}
 
-	for (const auto& zonePair : zoneComponents)
+	// 더 이상 예측되지 않는 존의 참조 해제
+	for (TSet<FZoneIdentifier>::TIterator zoneIt(inOutSourceState.prefetchedZones); zoneIt; ++zoneIt)
 	{
-		UZoneLevelInstanceComponent* zoneComponent = zonePair.Value;
-		if (zoneComponent)
+		if (!predictedZones.Contains(*zoneIt))
 		{
-			zoneComponent->DrawDebugInfo(false, 0.1f);
+			const FZoneIdentifier zoneID = *zoneIt;
+			zoneIt.RemoveCurrent();
+			ReleaseZoneInterest(zoneID);
 		}
 	}
 
-	// Zone Manager 정보 표시
-	FVector textLocation = GetActorLocation() + FVector(0, 0, 500.0f);
-	FString statsText = FString::Printf(TEXT("ZoneManager: %d total, %d loaded"),
-		GetTotalZoneCount(), GetLoadedZoneCount());
+	for (const FZoneIdentifier& zoneID : predictedZones)
+	{
+		bool bAlreadyPrefetched = false;
+		inOutSourceState.prefetchedZones.Add(zoneID, &bAlreadyPrefetched);
+		if (bAlreadyPrefetched)
+		{
+			continue;
+		}
 
-	DrawDebugString(GetWorld(), textLocation, statsText, nullptr, FColor::White, 0.1f);
+		// 아무도 원하지 않던 언로드 존만 예측 로드로 집계
+		const UZoneLevelInstanceComponent* zoneComponent = FindZoneByIdentifier(zoneID);
+		if (zoneComponent && zoneComponent->IsAutoLoadingEnabled() && GetZoneInterestCount(zoneID) == 0)
+		{
+			const EZoneLoadState loadState = zoneComponent->GetZoneLoadState();
+			if (loadState == EZoneLoadState::Unloaded || loadState == EZoneLoadState::Error)
+			{
+				pendingPrefetches.Add(zoneID);
+				++prefetchStats.prefetchedZones;
+			}
+		}
+
+		AcquireZoneInterest(zoneID);
+	}
 }
 
-void AZoneManager::ProcessLoadingQueue()
+void AZoneManager::GatherPrefetchZones(const FZoneStreamingSourceState& inSourceState, TSet<FZoneIdentifier>& outZones) const
 {
-	while (loadingQueue.Num() > 0 && currentlyLoading.Num() < settings.maxConcurrentLoads)
+	const FZoneStreamingSource& source = inSourceState.source;
+
+	auto AddPredictedZone = [&](const FZoneIdentifier& inZoneIdentifier)
 	{
-		FZoneIdentifier zoneID = loadingQueue[0];
-		loadingQueue.RemoveAt(0);
+		const UZoneLevelInstanceComponent* zoneComponent = FindZoneByIdentifier(inZoneIdentifier);
+		if (zoneComponent && zoneComponent->GetZoneData().bAutoLoad && !inSourceState.interestedZones.Contains(inZoneIdentifier))
+		{
+			outZones.Add(inZoneIdentifier);
+		}
+	};
 
-		UZoneLevelInstanceComponent* zoneComponent = FindZoneByIdentifier(zoneID);
-		if (zoneComponent && !zoneComponent->IsZoneLoaded())
+	// 속도 외삽: 예측 이동 구간이 (관심 반경을 더한) 로드 거리 안을 지나는 존
+	const FVector predictedPosition = source.position + source.velocity * settings.prefetchLookaheadSeconds;
+	const float travelDistance = FVector::Dist(source.position, predictedPosition);
+	if (travelDistance > KINDA_SMALL_NUMBER)
+	{
+		TArray<FZoneIdentifier> candidateZones;
+		zoneSpatialIndex.FindZonesInRadius((source.position + predictedPosition) * 0.5f,
+			travelDistance * 0.5f + maxAutoLoadDistance + source.interestRadius, candidateZones);
+
+		for (const FZoneIdentifier& zoneID : candidateZones)
 		{
-			zoneComponent->LoadZone();
-			currentlyLoading.Add(zoneID);
+			const UZoneLevelInstanceComponent* zoneComponent = FindZoneByIdentifier(zoneID);
+			if (!zoneComponent)
+			{
+				continue;
+			}
+
+			const FZoneLevelData& zoneData = zoneComponent->GetZoneData();
+			const float segmentDistance = FMath::PointDistToSegment(zoneData.zoneBounds.center, source.position, predictedPosition);
+			if (segmentDistance <= zoneData.loadDistance + source.interestRadius)
+			{
+				AddPredictedZone(zoneID);
+			}
 		}
 	}
+
+	// 경로: 마지막으로 지난 경로 존 다음부터 지정 개수만큼 (진행 전이면 첫 존부터)
+	const int32 firstRouteIndex = inSourceState.routeProgress + 1;
+	const int32 endRouteIndex = FMath::Min(firstRouteIndex + settings.prefetchRouteZoneCount, inSourceState.routeZones.Num());
+	for (int32 routeIndex = firstRouteIndex; routeIndex < endRouteIndex; ++routeIndex)
+	{
+		AddPredictedZone(inSourceState.routeZones[routeIndex]);
+	}
 }
 
-void AZoneManager::OnZoneComponentLoadStateChanged(const FZoneIdentifier& inZoneID, EZoneLoadState inNewState)
+void AZoneManager::TrackZoneForSource(FZoneStreamingSourceState& inOutSourceState, const FZoneLevelData& inZoneData) const
 {
-	if (inNewState == EZoneLoadState::Loaded || inNewState == EZoneLoadState::Unloaded || inNewState == EZoneLoadState::Error)
+	const float interestRadius = inOutSourceState.source.interestRadius;
+	inOutSourceState.proximityTracker.AddZone(inZoneData.zoneIdentifier, inZoneData.zoneBounds.center,
+		inZoneData.loadDistance + interestRadius, inZoneData.unloadDistance + interestRadius);
+}
+
+void AZoneManager::AcquireZoneInterest(const FZoneIdentifier& inZoneIdentifier)
+{
+	TouchZone(inZoneIdentifier);
+
+	int32& interestCount = zoneInterestCounts.FindOrAdd(inZoneIdentifier);
+	if (++interestCount > 1)
 	{
-		currentlyLoading.Remove(inZoneID);
+		return;
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("Zone %s state changed to %s"),
-		*inZoneID.ToString(), *UEnum::GetValueAsString(inNewState));
+	UZoneLevelInstanceComponent* zoneComponent = FindZoneByIdentifier(inZoneIdentifier);
+	if (!zoneComponent || !zoneComponent->IsAutoLoadingEnabled())
+	{
+		return;
+	}
+
+	const EZoneLoadState loadState = zoneComponent->GetZoneLoadState();
+	if (loadState == EZoneLoadState::Unloaded || loadState == EZoneLoadState::Error)
+	{
+		EnqueueZoneLoad(zoneComponent, false);
+	}
 }
 
-void AZoneManager::SaveAllZoneCaches()
+void AZoneManager::ReleaseZoneInterest(const FZoneIdentifier& inZoneIdentifier)
 {
-	for (const auto& zonePair : zoneComponents)
+	int32* interestCount = zoneInterestCounts.Find(inZoneIdentifier);
+	if (!interestCount || --(*interestCount) > 0)
 	{
-		UZoneLevelInstanceComponent* zoneComponent = zonePair.Value;
-		if (zoneComponent && zoneComponent->IsPathCacheReady())
-		{
-			UZonePathScoreCache* cache = zoneComponent->GetPathScoreCache();
-			if (cache)
-			{
-				FString saveDir = FPaths::ProjectSavedDir() / TEXT("PathFindingCache");
-				FString fileName = FString::Printf(TEXT("%s_%d.json"),
-					*zonePair.Key.zoneName.ToString(), zonePair.Key.zoneID);
-				FString filePath = saveDir / fileName;
+		return;
+	}
+	zoneInterestCounts.Remove(inZoneIdentifier);
+	TouchZone(inZoneIdentifier);
 
-				cache->SaveCacheToFile(filePath);
-			}
-		}
+	if (pendingPrefetches.Remove(inZoneIdentifier) > 0)
+	{
+		++prefetchStats.wastedLoads;
+	}
+
+	// 원하는 소스가 없으면 근접 요청은 취소 (명시적 요청은 유지)
+	const int32 requestIndex = loadingQueue.IndexOfByPredicate([&inZoneIdentifier](const FZoneLoadRequest& inRequest)
+	{
+		return inRequest.zoneIdentifier == inZoneIdentifier;
+	});
+	if (requestIndex != INDEX_NONE && !loadingQueue[requestIndex].bExplicit)
+	{
+		loadingQueue.HeapRemoveAt(requestIndex, FLoadRequestPredicate(), EAllowShrinking::No);
+	}
+
+	UZoneLevelInstanceComponent* zoneComponent = FindZoneByIdentifier(inZoneIdentifier);
+	if (zoneComponent && zoneComponent->IsAutoLoadingEnabled()
+		&& zoneComponent->GetZoneLoadState() == EZoneLoadState::Loaded && !zoneComponent->GetZoneData().bPersistent)
+	{
+		zoneComponent->UnloadZone();
 	}
 }
 
-void AZoneManager::CleanupZoneComponents()
+bool AZoneManager::CancelZoneLoad(const FZoneIdentifier& inZoneIdentifier)
 {
-	for (const auto& zonePair : zoneComponents)
+	const int32 requestIndex = loadingQueue.IndexOfByPredicate([&inZoneIdentifier](const FZoneLoadRequest& inRequest)
 	{
-		UZoneLevelInstanceComponent* zoneComponent = zonePair.Value;
-		if (zoneComponent)
-		{
-			zoneComponent->OnZoneLoadStateChanged.RemoveAll(this);
-		}
+		return inRequest.zoneIdentifier == inZoneIdentifier;
+	});
+
+	if (requestIndex == INDEX_NONE)
+	{
+		return false;
 	}
 
-	zoneComponents.Empty();
+	loadingQueue.HeapRemoveAt(requestIndex, FLoadRequestPredicate(), EAllowShrinking::No);
+	return true;
+}
+
+bool AZoneManager::IsZoneLoadQueued(const FZoneIdentifier& inZoneIdentifier) const
+{
+	return loadingQueue.ContainsByPredicate([&inZoneIdentifier](const FZoneLoadRequest& inRequest)
+	{
+		return inRequest.zoneIdentifier == inZoneIdentifier;
+	});
+}
+
+TArray<FZoneConnectionPoint> AZoneManager::FindConnectionsBetweenZones(const FZoneIdentifier& inFromZone, const FZoneIdentifier& inToZone) const
+{
+	TArray<FZoneConnectionPoint> connections;
+
+	UZoneLevelInstanceComponent* fromZoneComponent = FindZoneByIdentifier(inFromZone);
+	if (!fromZoneComponent)
+	{
+		return connections;
+	}
+
+	const FZoneLevelData& fromZoneData = fromZoneComponent->GetZoneData();
+	for (const FZoneConnectionPoint& connection : fromZoneData.connectionPoints)
+	{
+		if (connection.targetZone == inToZone)
+		{
+			connections.Add(connection);
+		}
+	}
+
+	return connections;
+}
+
+bool AZoneManager::FindZoneSequence(const FZoneIdentifier& inFromZone, const FZoneIdentifier& inToZone,
+	TArray<FZoneIdentifier>& outZoneSequence, float& outTotalCost) const
+{
+	outZoneSequence.Reset();
+	outTotalCost = 0.0f;
+
+	if (!zoneComponents.Contains(inFromZone) || !zoneComponents.Contains(inToZone))
+	{
+		return false;
+	}
+
+	const FZoneRouteTree& routeTree = GetZoneRouteTree(inFromZone);
+	const float* routeCost = routeTree.routeCosts.Find(inToZone);
+	if (!routeCost)
+	{
+		return false;
+	}
+
+	// 목표에서 출발 존까지 선행 존을 따라 역추적
+	for (FZoneIdentifier zoneID = inToZone; ; )
+	{
+		outZoneSequence.Add(zoneID);
+		const FZoneIdentifier* previousZone = routeTree.previousZones.Find(zoneID);
+		if (!previousZone)
+		{
+			break;
+		}
+		zoneID = *previousZone;
+	}
+	Algo::Reverse(outZoneSequence);
+
+	outTotalCost = *routeCost;
+	return true;
+}
+
+TArray<FZoneIdentifier> AZoneManager::GetAdjacentZones(const FZoneIdentifier& inZoneIdentifier) const
+{
+	UpdateZoneAdjacency();
+
+	TArray<FZoneIdentifier> adjacentZones;
+	if (const TArray<FZoneAdjacencyEdge>* edges = zoneAdjacency.Find(inZoneIdentifier))
+	{
+		for (const FZoneAdjacencyEdge& edge : *edges)
+		{
+			adjacentZones.Add(edge.targetZone);
+		}
+	}
+	return adjacentZones;
+}
+
+bool AZoneManager::FindHierarchicalRoute(const FVector& inStartPosition, const FVector& inGoalPosition, TArray<FVector>& outWaypoints)
+{
+	outWaypoints.Reset();
+
+	FZonePathHierarchyRoute route;
+	if (!FindZoneRoute(inStartPosition, inGoalPosition, route))
+	{
+		return false;
+	}
+
+	for (const FZonePathHierarchyWaypoint& waypoint : route.waypoints)
+	{
+		outWaypoints.Add(waypoint.worldPosition);
+	}
+	return true;
+}
+
+bool AZoneManager::FindHierarchicalPath(const FVector& inStartPosition, const FVector& inGoalPosition, TArray<FVector>& outPath)
+{
+	outPath.Reset();
+
+	FZonePathHierarchyRoute route;
+	if (!FindZoneRoute(inStartPosition, inGoalPosition, route))
+	{
+		return false;
+	}
+
+	// 모든 구간을 정제하여 이어 붙임 (구간 경계 셀은 한 번만 추가)
+	TArray<FVector> segmentPositions;
+	for (int32 segmentIndex = 0; segmentIndex < route.GetSegmentCount(); ++segmentIndex)
+	{
+		if (!RefineZoneRouteSegment(route, segmentIndex, segmentPositions))
+		{
+			outPath.Reset();
+			return false;
+		}
+
+		for (const FVector& position : segmentPositions)
+		{
+			if (outPath.Num() == 0 || !outPath.Last().Equals(position))
+			{
+				outPath.Add(position);
+			}
+		}
+	}
+
+	if (outPath.Num() == 0 && route.waypoints.Num() > 0)
+	{
+		outPath.Add(route.waypoints[0].worldPosition);
+	}
+	return true;
+}
+
+bool AZoneManager::FindZoneRoute(const FVector& inStartPosition, const FVector& inGoalPosition, FZonePathHierarchyRoute& outRoute)
+{
+	outRoute = FZonePathHierarchyRoute();
+
+	UpdatePathHierarchy();
+
+	UZoneLevelInstanceComponent* startZone = FindZoneContainingPosition(inStartPosition);
+	UZoneLevelInstanceComponent* goalZone = FindZoneContainingPosition(inGoalPosition);
+	if (!startZone || !goalZone)
+	{
+		return false;
+	}
+
+	const FZonePathClusterGraphPtr startGraph = pathHierarchy.FindZoneGraph(startZone->GetZoneIdentifier());
+	const FZonePathClusterGraphPtr goalGraph = pathHierarchy.FindZoneGraph(goalZone->GetZoneIdentifier());
+	if (!startGraph.IsValid() || !goalGraph.IsValid())
+	{
+		UE_LOG(LogTemp, Verbose, TEXT("Hierarchical route unavailable - path cache not ready for %s or %s"),
+			*startZone->GetZoneIdentifier().ToString(), *goalZone->GetZoneIdentifier().ToString());
+		return false;
+	}
+
+	if (!pathHierarchy.FindRoute(
+		startZone->GetZoneIdentifier(), startGraph->GetGrid().WorldToGrid(inStartPosition),
+		goalZone->GetZoneIdentifier(), goalGraph->GetGrid().WorldToGrid(inGoalPosition),
+		outRoute))
+	{
+		return false;
+	}
+
+	// 경로가 지나는 존은 사용 중으로 간주 (LRU 축출 순서)
+	for (const FZonePathHierarchyWaypoint& waypoint : outRoute.waypoints)
+	{
+		TouchZone(waypoint.zoneIdentifier);
+	}
+	return true;
+}
+
+bool AZoneManager::RefineZoneRouteSegment(const FZonePathHierarchyRoute& inRoute, int32 inSegmentIndex, TArray<FVector>& outPositions) const
+{
+	outPositions.Reset();
+
+	TArray<FIntVector> segmentCells;
+	if (!pathHierarchy.RefineSegment(inRoute, inSegmentIndex, segmentCells))
+	{
+		return false;
+	}
+
+	if (segmentCells.Num() > 0)
+	{
+		const FZonePathClusterGraphPtr graph = pathHierarchy.FindZoneGraph(inRoute.waypoints[inSegmentIndex].zoneIdentifier);
+		const FZonePathGrid& grid = graph->GetGrid();
+		for (const FIntVector& cell : segmentCells)
+		{
+			outPositions.Add(grid.GridToWorld(cell));
+		}
+	}
+	return true;
+}
+
+int32 AZoneManager::GetLoadedZoneCount() const
+{
+	int32 count = 0;
+	for (const auto& zonePair : zoneComponents)
+	{
+		if (zonePair.Value && zonePair.Value->IsZoneLoaded())
+		{
+			count++;
+		}
+	}
+	return count;
+}
+
+void AZoneManager::SetZoneManagerSettings(const FZoneManagerSettings& inNewSettings)
+{
+	settings = inNewSettings;
+	zoneSpatialIndex.SetCellSize(settings.spatialIndexCellSize);
+	TrimPathCachePool();
+
+	// 자동 로딩 설정이 바뀌었을 수 있으므로 다음 갱신에서 전체 재평가
+	for (auto& sourcePair : streamingSources)
+	{
+		sourcePair.Value.proximityTracker.InvalidateAll();
+	}
+
+	// 타이머 업데이트
+	if (GetWorld())
+	{
+		GetWorldTimerManager().ClearTimer(autoLoadTimerHandle);
+		GetWorldTimerManager().ClearTimer(cacheSaveTimerHandle);
+
+		if (settings.bAutoLoadZones)
+		{
+			GetWorldTimerManager().SetTimer(
+				autoLoadTimerHandle,
+				[this]() { UpdateAutoLoading(playerPosition); },
+				settings.autoLoadCheckInterval,
+				true
+			);
+		}
+
+		if (settings.bSaveZoneCachesToDisk)
+		{
+			GetWorldTimerManager().SetTimer(
+				cacheSaveTimerHandle,
+				this,
+				&AZoneManager::SaveAllZoneCaches,
+				settings.cacheSaveInterval,
+				true
+			);
+		}
+	}
+}
+
+void AZoneManager::SetDebugDisplayEnabled(bool bEnabled)
+{
+	settings.bEnableDebugDisplay = bEnabled;
+}
+
+void AZoneManager::DrawDebugInfo() const
+{
+	if (!GetWorld())
+	{
+		return;
+	}
+
+	for (const auto& zonePair : zoneComponents)
+	{
+		UZoneLevelInstanceComponent* zoneComponent = zonePair.Value;
+		if (zoneComponent)
+		{
+			zoneComponent->DrawDebugInfo(false, 0.1f);
+		}
+	}
+
+	// Zone Manager 정보 표시
+	FVector textLocation = GetActorLocation() + FVector(0, 0, 500.0f);
+	FString statsText = FString::Printf(TEXT("ZoneManager: %d total, %d loaded"),
+		GetTotalZoneCount(), GetLoadedZoneCount());
+
+	DrawDebugString(GetWorld(), textLocation, statsText, nullptr, FColor::White, 0.1f);
+}
+
+void AZoneManager::ProcessLoadingQueue()
+{
+	while (loadingQueue.Num() > 0 && currentlyLoading.Num() < settings.maxConcurrentLoads)
+	{
+		/*modify_261016_: FIFO 대신 점수가 가장 낮은 요청부터 처리*/
+		FZoneLoadRequest loadRequest;
+		loadingQueue.HeapPop(loadRequest, FLoadRequestPredicate(), EAllowShrinking::No);
+		const FZoneIdentifier& zoneID = loadRequest.zoneIdentifier;
+
+		UZoneLevelInstanceComponent* zoneComponent = FindZoneByIdentifier(zoneID);
+		if (zoneComponent && !zoneComponent->IsZoneLoaded())
+		{
+			RequestZoneCacheDecode(zoneComponent);/*modify_261016_: 웜 로드되지 않은 캐시를 레벨 스트리밍과 병행 디코딩*/
+			zoneComponent->LoadZone();
+			currentlyLoading.Add(zoneID);
+			/*modify_261016_: 근접 요청으로 시작한 로드는 완료 시 참조가 남아 있는지 다시 확인*/
+			if (!loadRequest.bExplicit)
+			{
+				interestLoadingZones.Add(zoneID);
+			}
+		}
+	}
+}
+
+void AZoneManager::EnqueueZoneLoad(UZoneLevelInstanceComponent* inZoneComponent, bool bExplicit)
+{
+	const FZoneIdentifier& zoneID = inZoneComponent->GetZoneIdentifier();
+
+	// 이미 대기 중이면 점수만 갱신
+	for (FZoneLoadRequest& existingRequest : loadingQueue)
+	{
+		if (existingRequest.zoneIdentifier == zoneID)
+		{
+			existingRequest.bExplicit |= bExplicit;
+			ScoreLoadRequest(existingRequest, inZoneComponent);
+			loadingQueue.Heapify(FLoadRequestPredicate());
+			return;
+		}
+	}
+
+	FZoneLoadRequest newRequest;
+	newRequest.zoneIdentifier = zoneID;
+	newRequest.bExplicit = bExplicit;
+	newRequest.sequence = nextLoadRequestSequence++;
+	ScoreLoadRequest(newRequest, inZoneComponent);
+
+	loadingQueue.HeapPush(newRequest, FLoadRequestPredicate());
+}
+
+void AZoneManager::ScoreLoadRequest(FZoneLoadRequest& inOutRequest, const UZoneLevelInstanceComponent* inZoneComponent) const
+{
+	const FZoneLevelData& zoneData = inZoneComponent->GetZoneData();
+
+	inOutRequest.priority = zoneData.priority;
+	inOutRequest.distance = 0.0f;
+	inOutRequest.timeToArrival = 0.0f;
+
+	// 소스별 도착 시간을 가중치로 나눈 값 중 가장 급한 소스 기준
+	float weightedArrival = 0.0f;
+	bool bHasSource = false;
+	for (const auto& sourcePair : streamingSources)
+	{
+		const FZoneStreamingSourceState& sourceState = sourcePair.Value;
+		if (!sourceState.bHasPosition)
+		{
+			continue;
+		}
+
+		const FZoneStreamingSource& source = sourceState.source;
+		const FVector toZone = zoneData.zoneBounds.center - source.position;
+		const float distance = toZone.Size();
+
+		// 존 방향 속도 성분으로 도착 시간 추정 (멀어지거나 정지 중이면 최소 접근 속도 가정)
+		const float closingSpeed = distance > KINDA_SMALL_NUMBER ? FVector::DotProduct(source.velocity, toZone / distance) : 0.0f;
+		const float timeToArrival = distance / FMath::Max(closingSpeed, settings.minimumApproachSpeed);
+		const float sourceWeightedArrival = timeToArrival / source.weight;
+
+		if (!bHasSource || sourceWeightedArrival < weightedArrival)
+		{
+			bHasSource = true;
+			weightedArrival = sourceWeightedArrival;
+			inOutRequest.distance = distance;
+			inOutRequest.timeToArrival = timeToArrival;
+		}
+	}
+
+	inOutRequest.loadScore = weightedArrival - inOutRequest.priority * settings.loadPrioritySeconds;
+}
+
+void AZoneManager::ReprioritizeLoadingQueue()
+{
+	for (int32 requestIndex = loadingQueue.Num() - 1; requestIndex >= 0; --requestIndex)
+	{
+		FZoneLoadRequest& loadRequest = loadingQueue[requestIndex];
+		UZoneLevelInstanceComponent* zoneComponent = FindZoneByIdentifier(loadRequest.zoneIdentifier);
+
+		// 이미 로드(중)이거나 근접 요청인데 원하는 소스가 없는 존은 취소
+		const bool bNoLongerNeeded = !zoneComponent
+			|| zoneComponent->IsZoneLoaded()
+			|| zoneComponent->GetZoneLoadState() == EZoneLoadState::Loading
+			|| (!loadRequest.bExplicit && !zoneInterestCounts.Contains(loadRequest.zoneIdentifier));
+
+		if (bNoLongerNeeded)
+		{
+			UE_LOG(LogTemp, Verbose, TEXT("Zone load request cancelled: %s"), *loadRequest.zoneIdentifier.ToString());
+			loadingQueue.RemoveAtSwap(requestIndex, 1, EAllowShrinking::No);
+			continue;
+		}
+
+		ScoreLoadRequest(loadRequest, zoneComponent);
+	}
+
+	loadingQueue.Heapify(FLoadRequestPredicate());
+}
+
+void AZoneManager::OnZoneComponentLoadStateChanged(const FZoneIdentifier& inZoneID, EZoneLoadState inNewState)
+{
+	bool bInterestLoad = false;/*modify_261016_: 참조 때문에 시작한 로드인지 기록*/
+	if (inNewState == EZoneLoadState::Loaded || inNewState == EZoneLoadState::Unloaded || inNewState == EZoneLoadState::Error)
+	{
+		currentlyLoading.Remove(inZoneID);
+		bInterestLoad = interestLoadingZones.Remove(inZoneID) > 0;/*modify_261016_: 참조 때문에 시작한 로드인지 기록*/
+	}
+
+	if (inNewState == EZoneLoadState::Loaded || inNewState == EZoneLoadState::Unloaded)
+	{
+		TouchZone(inZoneID);
+	}
+
+	/*modify_261016_: 컴포넌트가 재사용 여부를 판단하기 전에 진행 중인 캐시 디코딩을 설치*/
+	if (inNewState == EZoneLoadState::Loaded)
+	{
+		FinishZoneCacheDecode(inZoneID);
+	}
+
+	// 아직 원하는 소스가 있는데 언로드된 존은 대역 변화 이벤트가 없으므로 여기서 다시 요청
+	if (inNewState == EZoneLoadState::Unloaded && settings.bAutoLoadZones && GetZoneInterestCount(inZoneID) > 0)
+	{
+		UZoneLevelInstanceComponent* zoneComponent = FindZoneByIdentifier(inZoneID);
+		if (zoneComponent && zoneComponent->IsAutoLoadingEnabled())
+		{
+			EnqueueZoneLoad(zoneComponent, false);
+		}
+	}
+
+	/*modify_261016_: 로드 중에 모든 소스가 참조를 해제한 존은 해제 시점에 언로드할 수 없었으므로 완료 시 언로드*/
+	if (inNewState == EZoneLoadState::Loaded && bInterestLoad && GetZoneInterestCount(inZoneID) == 0)
+	{
+		UZoneLevelInstanceComponent* zoneComponent = FindZoneByIdentifier(inZoneID);
+		if (zoneComponent && zoneComponent->IsAutoLoadingEnabled() && !zoneComponent->GetZoneData().bPersistent)
+		{
+			UE_LOG(LogTemp, Verbose, TEXT("Zone %s finished loading after its interest was released, unloading"), *inZoneID.ToString());
+			zoneComponent->UnloadZone();
+		}
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("Zone %s state changed to %s"),
+		*inZoneID.ToString(), *UEnum::GetValueAsString(inNewState));
+}
+
+FZoneMemoryUsage AZoneManager::GetMemoryUsage() const
+{
+	FZoneMemoryUsage usage = memoryUsage;
+	MeasureMemoryUsage(usage);
+	return usage;
+}
+
+void AZoneManager::TouchZone(const FZoneIdentifier& inZoneIdentifier)
+{
+	const UWorld* world = GetWorld();
+	zoneLastUsedTimes.Add(inZoneIdentifier, world ? world->GetTimeSeconds() : 0.0);
+}
+
+void AZoneManager::MeasureMemoryUsage(FZoneMemoryUsage& outUsage) const
+{
+	outUsage.levelBytes = 0;
+	outUsage.cacheBytes = 0;
+	outUsage.residentZoneCount = 0;
+	outUsage.cachedZoneCount = 0;
+	outUsage.budgetBytes = static_cast<int64>(settings.memoryBudgetMB * BYTES_PER_MB);
+
+	for (const auto& zonePair : zoneComponents)
+	{
+		const UZoneLevelInstanceComponent* zoneComponent = zonePair.Value;
+		if (!zoneComponent)
+		{
+			continue;
+		}
+
+		// 언로드 중인 레벨은 곧 해제되므로 제외 (중복 축출 방지)
+		const EZoneLoadState loadState = zoneComponent->GetZoneLoadState();
+		if (loadState == EZoneLoadState::Loaded || loadState == EZoneLoadState::Loading)
+		{
+			outUsage.levelBytes += static_cast<int64>(zoneComponent->GetZoneData().estimatedLevelMemoryMB * BYTES_PER_MB);
+			++outUsage.residentZoneCount;
+		}
+
+		if (const UZonePathScoreCache* cache = zoneComponent->GetPathScoreCache())
+		{
+			outUsage.cacheBytes += cache->GetMemoryFootprint();
+			if (cache->IsGridGenerated())
+			{
+				++outUsage.cachedZoneCount;
+			}
+		}
+	}
+
+	for (const auto& poolPair : pathCachePool)
+	{
+		if (const UZonePathScoreCache* cache = poolPair.Value.cache)
+		{
+			outUsage.cacheBytes += cache->GetMemoryFootprint();
+			++outUsage.cachedZoneCount;
+		}
+	}
+}
+
+void AZoneManager::EnforceMemoryBudget()
+{
+	if (settings.memoryBudgetMB <= 0.0f)
+	{
+		bMemoryBudgetExceeded = false;
+		return;
+	}
+
+	MeasureMemoryUsage(memoryUsage);
+	if (!memoryUsage.IsOverBudget())
+	{
+		bMemoryBudgetExceeded = false;
+		return;
+	}
+
+	// 풀/언로드된 존의 캐시 → 아무 소스도 원하지 않는 로드된 존 순으로, 각각 오래 사용하지 않은 것부터 축출
+	TArray<FZoneEvictionCandidate> cacheCandidates;
+	TArray<FZoneEvictionCandidate> levelCandidates;
+	for (const auto& poolPair : pathCachePool)
+	{
+		if (UZonePathScoreCache* cache = poolPair.Value.cache)
+		{
+			cacheCandidates.Add({ poolPair.Key, nullptr, cache, poolPair.Value.releaseTime, cache->GetMemoryFootprint() });
+		}
+	}
+
+	for (const auto& zonePair : zoneComponents)
+	{
+		UZoneLevelInstanceComponent* zoneComponent = zonePair.Value;
+		if (!zoneComponent)
+		{
+			continue;
+		}
+
+		const double lastUsedTime = zoneLastUsedTimes.FindRef(zonePair.Key);
+		const EZoneLoadState loadState = zoneComponent->GetZoneLoadState();
+		if (loadState == EZoneLoadState::Unloaded || loadState == EZoneLoadState::Error)
+		{
+			UZonePathScoreCache* cache = zoneComponent->GetPathScoreCache();
+			if (cache && cache->IsGridGenerated())
+			{
+				cacheCandidates.Add({ zonePair.Key, zoneComponent, cache, lastUsedTime, cache->GetMemoryFootprint() });
+			}
+		}
+		else if (loadState == EZoneLoadState::Loaded && !zoneComponent->GetZoneData().bPersistent
+			&& GetZoneInterestCount(zonePair.Key) == 0)
+		{
+			const int64 levelBytes = static_cast<int64>(zoneComponent->GetZoneData().estimatedLevelMemoryMB * BYTES_PER_MB);
+			levelCandidates.Add({ zonePair.Key, zoneComponent, nullptr, lastUsedTime, levelBytes });
+		}
+	}
+
+	auto LeastRecentlyUsed = [](const FZoneEvictionCandidate& inA, const FZoneEvictionCandidate& inB)
+	{
+		return inA.lastUsedTime < inB.lastUsedTime;
+	};
+	cacheCandidates.Sort(LeastRecentlyUsed);
+	levelCandidates.Sort(LeastRecentlyUsed);
+
+	for (const FZoneEvictionCandidate& candidate : cacheCandidates)
+	{
+		if (!memoryUsage.IsOverBudget())
+		{
+			break;
+		}
+
+		// 저장 중인 캐시는 게임 스레드를 막지 않도록 건너뜀 (예산 초과가 남으면 다음 틱에 다시 후보가 됨)
+		if (candidate.pathScoreCache->IsSaveInFlight())
+		{
+			continue;
+		}
+
+		EvictPathCache(candidate.pathScoreCache, candidate.zoneIdentifier);
+		if (!candidate.zoneComponent)
+		{
+			pathCachePool.Remove(candidate.zoneIdentifier);
+		}
+		memoryUsage.cacheBytes -= candidate.bytes;
+		--memoryUsage.cachedZoneCount;
+		++memoryUsage.evictedCacheCount;
+	}
+
+	for (const FZoneEvictionCandidate& candidate : levelCandidates)
+	{
+		if (!memoryUsage.IsOverBudget())
+		{
+			break;
+		}
+
+		UE_LOG(LogTemp, Log, TEXT("Evicting zone %s to meet memory budget"), *candidate.zoneComponent->GetZoneIdentifier().ToString());
+		candidate.zoneComponent->UnloadZone();
+		memoryUsage.levelBytes -= candidate.bytes;
+		--memoryUsage.residentZoneCount;
+		++memoryUsage.evictedZoneCount;
+	}
+
+	// 남은 초과분은 소스가 사용 중인 존이므로 축출하지 않음 (예측 로드만 중단)
+	const bool bStillOverBudget = memoryUsage.IsOverBudget();
+	if (bStillOverBudget && !bMemoryBudgetExceeded)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("Zone memory budget exceeded by zones in use: %.1f / %.1f MB"),
+			memoryUsage.GetTotalBytes() / BYTES_PER_MB, settings.memoryBudgetMB);
+	}
+	bMemoryBudgetExceeded = bStillOverBudget;
+}
+
+bool AZoneManager::EvictPathCache(UZonePathScoreCache* inPathScoreCache, const FZoneIdentifier& inZoneIdentifier)
+{
+	if (!inPathScoreCache)
+	{
+		return true;
+	}
+
+	// 진행 중인 저장 뒤에 예약된 저장이 비워진 그리드를 캡처하지 않도록, 저장이 끝날 때까지 축출을 미룸 (대기하지 않음)
+	if (inPathScoreCache->IsSaveInFlight())
+	{
+		deferredCacheEvictions.Add(inPathScoreCache, inZoneIdentifier);
+		return false;
+	}
+
+	if (settings.bSaveZoneCachesToDisk && inPathScoreCache->IsGridGenerated())
+	{
+		inPathScoreCache->SaveCacheToFileAsync(NZonePathCacheFormat::GetCacheFilePath(inZoneIdentifier));
+	}
+	inPathScoreCache->ClearCache();
+	return true;
+}
+
+void AZoneManager::ProcessDeferredCacheEvictions()
+{
+	for (auto evictionIt = deferredCacheEvictions.CreateIterator(); evictionIt; ++evictionIt)
+	{
+		UZonePathScoreCache* cache = evictionIt.Key();
+		if (cache && cache->IsSaveInFlight())
+		{
+			continue;
+		}
+
+		const FZoneIdentifier zoneID = evictionIt.Value();
+		evictionIt.RemoveCurrent();
+		EvictPathCache(cache, zoneID);
+	}
+}
+
+UZonePathScoreCache* AZoneManager::AcquirePathCache(const FZoneLevelData& inZoneData)
+{
+	FZonePathCachePoolEntry pooledEntry;
+	pathCachePool.RemoveAndCopyValue(inZoneData.zoneIdentifier, pooledEntry);
+
+	// 저장 완료를 기다리며 축출 대기 중인 캐시가 가장 최신이므로 우선 회수 (늦게 끝난 축출 저장이 새 캐시 파일을 덮어쓰지 않도록)
+	UZonePathScoreCache* deferredCache = nullptr;
+	for (auto evictionIt = deferredCacheEvictions.CreateIterator(); evictionIt; ++evictionIt)
+	{
+		if (evictionIt.Key() && evictionIt.Value() == inZoneData.zoneIdentifier)
+		{
+			deferredCache = evictionIt.Key();
+			evictionIt.RemoveCurrent();
+			break;
+		}
+	}
+	if (deferredCache)
+	{
+		EvictPathCache(pooledEntry.cache, inZoneData.zoneIdentifier);
+		pooledEntry.cache = deferredCache;
+	}
+
+	if (pooledEntry.cache)
+	{
+		if (pooledEntry.cache->CanReuseGrid(inZoneData))
+		{
+			UE_LOG(LogTemp, Log, TEXT("Reusing pooled path cache for zone: %s"), *inZoneData.zoneIdentifier.ToString());
+			return pooledEntry.cache;
+		}
+
+		// 레벨 내용이 바뀐 캐시는 폐기 (저장은 새 베이크가 덮어씀)
+		pooledEntry.cache->WaitForPendingSave();
+		pooledEntry.cache->ClearCache();
+	}
+
+	return NewObject<UZonePathScoreCache>(this);
+}
+
+void AZoneManager::ReturnPathCacheToPool(UZoneLevelInstanceComponent* inZoneComponent)
+{
+	UZonePathScoreCache* cache = inZoneComponent->DetachPathScoreCache();
+	if (!cache)
+	{
+		return;
+	}
+
+	const FZoneIdentifier& zoneID = inZoneComponent->GetZoneIdentifier();
+	if (settings.pathCachePoolSize <= 0 || !cache->IsGridGenerated())
+	{
+		// 재사용하지 않는 캐시도 미저장 변경분은 기록
+		EvictPathCache(cache, zoneID);
+		return;
+	}
+
+	const UWorld* world = GetWorld();
+	FZonePathCachePoolEntry& poolEntry = pathCachePool.Add(zoneID);
+	poolEntry.cache = cache;
+	poolEntry.releaseTime = world ? world->GetTimeSeconds() : 0.0;
+
+	TrimPathCachePool();
+}
+
+void AZoneManager::TrimPathCachePool()
+{
+	while (pathCachePool.Num() > FMath::Max(settings.pathCachePoolSize, 0))
+	{
+		// 가장 오래 풀에 있던 캐시부터 제거
+		const FZoneIdentifier* oldestZone = nullptr;
+		double oldestTime = MAX_dbl;
+		for (const auto& poolPair : pathCachePool)
+		{
+			if (poolPair.Value.releaseTime < oldestTime)
+			{
+				oldestTime = poolPair.Value.releaseTime;
+				oldestZone = &poolPair.Key;
+			}
+		}
+
+		const FZoneIdentifier zoneID = *oldestZone;
+		EvictPathCache(pathCachePool[zoneID].cache, zoneID);
+		pathCachePool.Remove(zoneID);
+	}
+}
+
+int32 AZoneManager::WarmLoadZoneCaches()
+{
+	const double startTime = FPlatformTime::Seconds();
+
+	// 디렉터리를 한 번만 스캔 (존마다 FileExists 호출하지 않음)
+	const FString cacheDirectory = NZonePathCacheFormat::GetCacheDirectory();
+	TArray<FString> foundFiles;
+	IFileManager::Get().FindFiles(foundFiles, *(cacheDirectory / TEXT("*.zpcache")), true, false);
+
+	TSet<FString> availableFiles;
+	availableFiles.Reserve(foundFiles.Num());
+	for (const FString& fileName : foundFiles)
+	{
+		availableFiles.Add(fileName);
+	}
+
+	// 파일이 있고 아직 그리드가 없는 존만 대상 (풀에서 재사용된 캐시는 제외)
+	TArray<FZoneCacheWarmLoadTarget> targets;
+	for (const auto& zonePair : zoneComponents)
+	{
+		UZoneLevelInstanceComponent* zoneComponent = zonePair.Value;
+		UZonePathScoreCache* cache = zoneComponent ? zoneComponent->GetPathScoreCache() : nullptr;
+		if (!cache || cache->IsGridGenerated())
+		{
+			continue;
+		}
+
+		const FString filePath = NZonePathCacheFormat::GetCacheFilePath(zonePair.Key);
+		if (availableFiles.Contains(FPaths::GetCleanFilename(filePath)))
+		{
+			const FZoneLevelData& zoneData = zoneComponent->GetZoneData();
+			FZoneCacheWarmLoadTarget& target = targets.AddDefaulted_GetRef();
+			target.zoneComponent = zoneComponent;
+			target.filePath = filePath;
+			target.bPersistent = zoneData.bPersistent;
+			target.priority = zoneData.priority;
+			target.sourceDistance = TNumericLimits<float>::Max();
+			for (const auto& sourcePair : streamingSources)
+			{
+				if (sourcePair.Value.bHasPosition)
+				{
+					const float sourceDistance = static_cast<float>(
+						FVector::Dist(zoneData.zoneBounds.center, sourcePair.Value.source.position) - zoneData.loadDistance);
+					target.sourceDistance = FMath::Min(target.sourceDistance, sourceDistance);
+				}
+			}
+		}
+	}
+
+	// 상주/우선순위/소스 근접 순으로 설치해 한도에 걸려도 곧 필요한 존이 먼저 채워지도록 함
+	targets.Sort([](const FZoneCacheWarmLoadTarget& inA, const FZoneCacheWarmLoadTarget& inB)
+	{
+		if (inA.bPersistent != inB.bPersistent)
+		{
+			return inA.bPersistent;
+		}
+		if (inA.priority != inB.priority)
+		{
+			return inA.priority > inB.priority;
+		}
+		return inA.sourceDistance < inB.sourceDistance;
+	});
+
+	MeasureMemoryUsage(memoryUsage);
+	int64 residentBytes = memoryUsage.GetTotalBytes();
+	const int32 installLimit = settings.warmLoadZoneCacheLimit > 0 ? settings.warmLoadZoneCacheLimit : targets.Num();
+	const int32 batchSize = FMath::Max(1, FPlatformMisc::NumberOfWorkerThreadsToSpawn()) * WARM_LOAD_FILES_PER_WORKER;
+
+	// 배치 단위로 디코딩/설치를 반복해 디코딩 결과가 한꺼번에 메모리에 올라가지 않도록 함
+	double decodeSeconds = 0.0;
+	int32 loadedCount = 0;
+	int32 staleCount = 0;
+	int32 nextTarget = 0;
+	bool bBudgetReached = false;
+	TArray<FZonePathCacheLoadResult> loadResults;
+	while (nextTarget < targets.Num() && loadedCount < installLimit && !bBudgetReached)
+	{
+		const int32 batchCount = FMath::Min3(batchSize, targets.Num() - nextTarget, installLimit - loadedCount);
+
+		// 파일 읽기/디코딩/스냅샷 복사는 워커 스레드에서 (캐시 객체는 건드리지 않음)
+		const double decodeStartTime = FPlatformTime::Seconds();
+		loadResults.Reset();
+		loadResults.SetNum(batchCount);
+		ParallelFor(batchCount, [&targets, &loadResults, nextTarget](int32 inIndex)
+		{
+			loadResults[inIndex] = UZonePathScoreCache::DecodeCacheFile(targets[nextTarget + inIndex].filePath);
+		}, EParallelForFlags::Unbalanced);
+		decodeSeconds += FPlatformTime::Seconds() - decodeStartTime;
+
+		// 교체는 게임 스레드에서 순차 수행 (포인터 교체와 메타데이터 갱신만 남음)
+		for (int32 resultIndex = 0; resultIndex < batchCount; ++resultIndex)
+		{
+			const FZoneCacheWarmLoadTarget& target = targets[nextTarget + resultIndex];
+			FZonePathCacheLoadResult& loadResult = loadResults[resultIndex];
+			if (!loadResult.bSuccess)
+			{
+				UE_LOG(LogTemp, Warning, TEXT("Failed to warm-load zone path cache: %s"), *target.filePath);
+				continue;
+			}
+
+			if (memoryUsage.budgetBytes > 0 && residentBytes >= memoryUsage.budgetBytes)
+			{
+				bBudgetReached = true;
+				break;
+			}
+
+			if (InstallDecodedZoneCache(target.zoneComponent, MoveTemp(loadResult)))
+			{
+				loadedCount++;
+				residentBytes += target.zoneComponent->GetPathScoreCache()->GetMemoryFootprint();
+			}
+			else
+			{
+				// 레벨 내용이 바뀐 파일은 어차피 재베이크되므로 상주시키지 않음
+				staleCount++;
+			}
+		}
+		nextTarget += batchCount;
+	}
+
+	lastCacheWarmUpSeconds = static_cast<float>(FPlatformTime::Seconds() - startTime);
+
+	UE_LOG(LogTemp, Log, TEXT("Zone path caches warm-loaded: %d/%d in %.2f ms (decode %.2f ms, %d stale, %d left for zone load)"),
+		loadedCount, targets.Num(), lastCacheWarmUpSeconds * 1000.0f, decodeSeconds * 1000.0, staleCount,
+		targets.Num() - loadedCount - staleCount);
+	return loadedCount;
+}
+
+void AZoneManager::RequestZoneCacheDecode(UZoneLevelInstanceComponent* inZoneComponent)
+{
+	const UZonePathScoreCache* cache = inZoneComponent->GetPathScoreCache();
+	const FZoneIdentifier& zoneID = inZoneComponent->GetZoneIdentifier();
+	if (!cache || cache->IsGridGenerated() || cache->IsGenerating() || pendingCacheDecodes.Contains(zoneID))
+	{
+		return;
+	}
+
+	// 레벨 스트리밍과 겹치도록 워커 스레드에서 디코딩 (파일이 없으면 실패 결과만 남음)
+	const FString filePath = NZonePathCacheFormat::GetCacheFilePath(zoneID);
+	pendingCacheDecodes.Add(zoneID, Async(EAsyncExecution::ThreadPool, [filePath]()
+	{
+		return UZonePathScoreCache::DecodeCacheFile(filePath);
+	}));
+}
+
+void AZoneManager::ProcessPendingCacheDecodes()
+{
+	for (auto decodeIt = pendingCacheDecodes.CreateIterator(); decodeIt; ++decodeIt)
+	{
+		if (!decodeIt.Value().IsReady())
+		{
+			continue;
+		}
+
+		FZonePathCacheLoadResult loadResult = decodeIt.Value().Consume();
+		const FZoneIdentifier zoneID = decodeIt.Key();
+		decodeIt.RemoveCurrent();
+		if (UZoneLevelInstanceComponent* zoneComponent = FindZoneByIdentifier(zoneID))
+		{
+			InstallDecodedZoneCache(zoneComponent, MoveTemp(loadResult));
+		}
+	}
+}
+
+void AZoneManager::FinishZoneCacheDecode(const FZoneIdentifier& inZoneIdentifier)
+{
+	TFuture<FZonePathCacheLoadResult>* decodeFuture = pendingCacheDecodes.Find(inZoneIdentifier);
+	if (!decodeFuture)
+	{
+		return;
+	}
+
+	// 레벨 로드 완료 직후 컴포넌트가 CanReuseGrid를 확인하므로 남은 디코딩을 기다려 설치 (대부분 이미 완료됨)
+	FZonePathCacheLoadResult loadResult = decodeFuture->Consume();
+	pendingCacheDecodes.Remove(inZoneIdentifier);
+	if (UZoneLevelInstanceComponent* zoneComponent = FindZoneByIdentifier(inZoneIdentifier))
+	{
+		InstallDecodedZoneCache(zoneComponent, MoveTemp(loadResult));
+	}
+}
+
+bool AZoneManager::InstallDecodedZoneCache(UZoneLevelInstanceComponent* inZoneComponent, FZonePathCacheLoadResult&& inLoadResult)
+{
+	UZonePathScoreCache* cache = inZoneComponent->GetPathScoreCache();
+	if (!cache || !inLoadResult.bSuccess || cache->IsGridGenerated() || cache->IsGenerating())
+	{
+		return false;
+	}
+
+	// 저장된 베이크 입력 해시가 현재 존 설정과 다르면 설치하지 않음 (재사용 불가)
+	if (inLoadResult.levelContentHash != NZonePathCacheFormat::ComputeLevelContentHash(inZoneComponent->GetZoneData()))
+	{
+		UE_LOG(LogTemp, Verbose, TEXT("Zone path cache is stale, skipped: %s"), *inLoadResult.filePath);
+		return false;
+	}
+
+	return cache->ApplyDecodedCache(MoveTemp(inLoadResult));
+}
+
+void AZoneManager::SaveAllZoneCaches()
+{
+	for (const auto& zonePair : zoneComponents)
+	{
+		UZoneLevelInstanceComponent* zoneComponent = zonePair.Value;
+		if (zoneComponent && zoneComponent->IsPathCacheReady())
+		{
+			UZonePathScoreCache* cache = zoneComponent->GetPathScoreCache();
+			if (cache)
+			{
+				cache->SaveCacheToFileAsync(NZonePathCacheFormat::GetCacheFilePath(zonePair.Key));/*modify_261016_: 직렬화/파일 I/O를 백그라운드로 이동*/
+			}
+		}
+	}
+
+	// 풀에 있는 캐시도 등록 해제 이후의 변경분 저장
+	for (const auto& poolPair : pathCachePool)
+	{
+		if (poolPair.Value.cache && poolPair.Value.cache->IsGridGenerated())
+		{
+			poolPair.Value.cache->SaveCacheToFileAsync(NZonePathCacheFormat::GetCacheFilePath(poolPair.Key));
+		}
+	}
+}
+
+void AZoneManager::WaitForZoneCacheSaves()
+{
+	for (const auto& zonePair : zoneComponents)
+	{
+		UZoneLevelInstanceComponent* zoneComponent = zonePair.Value;
+		UZonePathScoreCache* cache = zoneComponent ? zoneComponent->GetPathScoreCache() : nullptr;
+		if (cache)
+		{
+			cache->WaitForPendingSave();
+		}
+	}
+
+	for (const auto& poolPair : pathCachePool)
+	{
+		if (poolPair.Value.cache)
+		{
+			poolPair.Value.cache->WaitForPendingSave();
+		}
+	}
+
+	// 축출 대기 중인 캐시는 남은 저장을 마친 뒤 축출하고, 축출 저장까지 기다림
+	const TMap<TObjectPtr<UZonePathScoreCache>, FZoneIdentifier> evictions = MoveTemp(deferredCacheEvictions);
+	deferredCacheEvictions.Reset();
+	for (const auto& evictionPair : evictions)
+	{
+		if (UZonePathScoreCache* cache = evictionPair.Key)
+		{
+			cache->WaitForPendingSave();
+			EvictPathCache(cache, evictionPair.Value);
+			cache->WaitForPendingSave();
+		}
+	}
+}
+
+void AZoneManager::CleanupZoneComponents()
+{
+	for (const auto& zonePair : zoneComponents)
+	{
+		UZoneLevelInstanceComponent* zoneComponent = zonePair.Value;
+		if (zoneComponent)
+		{
+			zoneComponent->OnZoneLoadStateChanged.RemoveAll(this);
+		}
+	}
+
+	zoneComponents.Empty();
+	zoneSpatialIndex.Reset();
+	streamingSources.Reset();
+	bDefaultStreamingSourceSampled = false;
+	zoneInterestCounts.Reset();
+	pendingPrefetches.Reset();
+	maxAutoLoadDistance = 0.0f;
+	zoneLastUsedTimes.Reset();
+	bMemoryBudgetExceeded = false;
+	pathCachePool.Reset();
+	deferredCacheEvictions.Reset();
+	pendingCacheDecodes.Reset();
+	pathHierarchy = FZonePathHierarchy();
+	pathGraphSources.Reset();
+	bPathHierarchyLinksDirty = false;
+	InvalidateZoneAdjacency();
+}
+
+void AZoneManager::InvalidateZoneAdjacency()
+{
+	zoneAdjacency.Reset();
+	zoneRouteTrees.Reset();
+	bZoneAdjacencyDirty = true;
+}
+
+void AZoneManager::UpdateZoneAdjacency() const
+{
+	if (!bZoneAdjacencyDirty)
+	{
+		return;
+	}
+
+	zoneAdjacency.Reset();
+	zoneRouteTrees.Reset();
+
+	// 같은 존 쌍 사이 연결이 여럿이면 가장 싼 전환 비용만 유지
+	auto AddEdge = [this](const FZoneIdentifier& inFromZone, const FZoneIdentifier& inToZone, float inCost)
+	{
+		TArray<FZoneAdjacencyEdge>& edges = zoneAdjacency.FindOrAdd(inFromZone);
+		for (FZoneAdjacencyEdge& edge : edges)
+		{
+			if (edge.targetZone == inToZone)
+			{
+				edge.transitionCost = FMath::Min(edge.transitionCost, inCost);
+				return;
+			}
+		}
+		edges.Add({ inToZone, inCost });
+	};
+
+	for (const auto& zonePair : zoneComponents)
+	{
+		if (!zonePair.Value)
+		{
+			continue;
+		}
+
+		for (const FZoneConnectionPoint& connection : zonePair.Value->GetZoneData().connectionPoints)
+		{
+			// 등록되지 않은 존으로의 연결은 무시
+			if (connection.targetZone == zonePair.Key || !zoneComponents.Contains(connection.targetZone))
+			{
+				continue;
+			}
+
+			const float transitionCost = FMath::Max(0.0f, connection.transitionCost);
+			AddEdge(zonePair.Key, connection.targetZone, transitionCost);
+			if (connection.bBidirectional)
+			{
+				AddEdge(connection.targetZone, zonePair.Key, transitionCost);
+			}
+		}
+	}
+
+	bZoneAdjacencyDirty = false;
+}
+
+const FZoneRouteTree& AZoneManager::GetZoneRouteTree(const FZoneIdentifier& inSourceZone) const
+{
+	UpdateZoneAdjacency();
+
+	if (const FZoneRouteTree* cachedTree = zoneRouteTrees.Find(inSourceZone))
+	{
+		return *cachedTree;
+	}
+
+	struct FZoneOpenEntry
+	{
+		float routeCost;
+		FZoneIdentifier zoneID;
+	};
+
+	auto OpenPredicate = [](const FZoneOpenEntry& inA, const FZoneOpenEntry& inB)
+	{
+		return inA.routeCost < inB.routeCost;
+	};
+
+	// 출발 존 기준 다익스트라로 전체 최단 경로 트리 구성 (이후 같은 출발 질의는 트리 조회만)
+	FZoneRouteTree& routeTree = zoneRouteTrees.Add(inSourceZone);
+	TSet<FZoneIdentifier> settledZones;
+	TArray<FZoneOpenEntry> openHeap;
+
+	routeTree.routeCosts.Add(inSourceZone, 0.0f);
+	openHeap.HeapPush({ 0.0f, inSourceZone }, OpenPredicate);
+
+	while (openHeap.Num() > 0)
+	{
+		FZoneOpenEntry current;
+		openHeap.HeapPop(current, OpenPredicate, EAllowShrinking::No);
+
+		bool bAlreadySettled = false;
+		settledZones.Add(current.zoneID, &bAlreadySettled);
+		if (bAlreadySettled)
+		{
+			continue;
+		}
+
+		const TArray<FZoneAdjacencyEdge>* edges = zoneAdjacency.Find(current.zoneID);
+		if (!edges)
+		{
+			continue;
+		}
+
+		for (const FZoneAdjacencyEdge& edge : *edges)
+		{
+			if (settledZones.Contains(edge.targetZone))
+			{
+				continue;
+			}
+
+			const float tentativeCost = current.routeCost + edge.transitionCost;
+			const float* knownCost = routeTree.routeCosts.Find(edge.targetZone);
+			if (knownCost && tentativeCost >= *knownCost)
+			{
+				continue;
+			}
+
+			routeTree.routeCosts.Add(edge.targetZone, tentativeCost);
+			routeTree.previousZones.Add(edge.targetZone, current.zoneID);
+			openHeap.HeapPush({ tentativeCost, edge.targetZone }, OpenPredicate);
+		}
+	}
+
+	return routeTree;
+}
+
+void AZoneManager::UpdatePathHierarchy()
+{
+	bool bGraphsChanged = false;
+	for (const auto& zonePair : zoneComponents)
+	{
+		if (zonePair.Value)
+		{
+			bGraphsChanged |= UpdateZonePathGraph(zonePair.Value);
+		}
+	}
+
+	if (bGraphsChanged || bPathHierarchyLinksDirty)
+	{
+		RebuildPathHierarchyLinks();
+	}
+}
+
+bool AZoneManager::UpdateZonePathGraph(UZoneLevelInstanceComponent* inZoneComponent)
+{
+	const FZoneIdentifier& zoneID = inZoneComponent->GetZoneIdentifier();
+	UZonePathScoreCache* cache = inZoneComponent->GetPathScoreCache();
+	const FZonePathClusterGraphPtr currentGraph = pathHierarchy.FindZoneGraph(zoneID);
+
+	FZonePathGridSnapshotPtr snapshot;
+	uint32 snapshotVersion = 0;
+	if (cache && inZoneComponent->IsPathCacheReady())
+	{
+		snapshot = cache->GetGridSnapshot(snapshotVersion);
+	}
+
+	// 캐시가 준비되지 않은 존은 라우팅에서 제외
+	if (!snapshot.IsValid() || !snapshot->bIsGenerated)
+	{
+		if (currentGraph.IsValid())
+		{
+			pathHierarchy.RemoveZoneGraph(zoneID);
+			return true;
+		}
+		return false;
+	}
+
+	// 그리드 스냅샷이 바뀌지 않았으면 재사용
+	if (currentGraph.IsValid() && currentGraph->GetGridSnapshot() == snapshot)
+	{
+		return false;
+	}
+
+	// 앵커: 이 존에서 나가는 연결 지점 + 다른 존에서 들어오는 도착 지점
+	TArray<FIntVector> anchorCells;
+	for (const FZoneConnectionPoint& connection : inZoneComponent->GetZoneData().connectionPoints)
+	{
+		anchorCells.Add(snapshot->WorldToGrid(connection.connectionLocation));
+	}
+	for (const auto& zonePair : zoneComponents)
+	{
+		if (!zonePair.Value || zonePair.Key == zoneID)
+		{
+			continue;
+		}
+		for (const FZoneConnectionPoint& connection : zonePair.Value->GetZoneData().connectionPoints)
+		{
+			if (connection.targetZone == zoneID)
+			{
+				anchorCells.Add(snapshot->WorldToGrid(connection.targetLocation));
+			}
+		}
+	}
+
+	const FZonePathSearchParams searchParams(inZoneComponent->GetZoneData().pathSettings);
+
+	// 같은 캐시의 셀 갱신만 있었으면 변경 셀이 든 클러스터만 다시 계산
+	TArray<FIntVector> changedCells;
+	const FZonePathGraphSource* graphSource = pathGraphSources.Find(zoneID);
+	const bool bPartialRebuild = currentGraph.IsValid() && graphSource && graphSource->cache.Get() == cache
+		&& currentGraph->CanUpdateIncrementally(*snapshot, searchParams, settings.hierarchyClusterSize)
+		&& cache->GetChangedCellsBetween(graphSource->snapshotVersion, snapshotVersion, changedCells);
+
+	const double buildStartTime = FPlatformTime::Seconds();
+	FZonePathClusterGraphPtr newGraph = bPartialRebuild
+		? MakeShared<FZonePathClusterGraph, ESPMode::ThreadSafe>(*currentGraph, snapshot, changedCells, anchorCells)
+		: MakeShared<FZonePathClusterGraph, ESPMode::ThreadSafe>(snapshot, searchParams, settings.hierarchyClusterSize, anchorCells);
+
+	UE_LOG(LogTemp, Verbose, TEXT("Path hierarchy %s for zone %s: %d clusters, %d nodes, %d changed cells (%.2f ms)"),
+		bPartialRebuild ? TEXT("updated") : TEXT("built"), *zoneID.ToString(), newGraph->GetClusterCount(), newGraph->GetNodes().Num(),
+		changedCells.Num(), (FPlatformTime::Seconds() - buildStartTime) * 1000.0);
+
+	pathHierarchy.SetZoneGraph(zoneID, MoveTemp(newGraph));
+	pathGraphSources.Add(zoneID, { cache, snapshotVersion });
+	return true;
+}
+
+void AZoneManager::RebuildPathHierarchyLinks()
+{
+	pathHierarchy.ClearZoneLinks();
+
+	for (const auto& zonePair : zoneComponents)
+	{
+		const FZonePathClusterGraphPtr fromGraph = pathHierarchy.FindZoneGraph(zonePair.Key);
+		if (!zonePair.Value || !fromGraph.IsValid())
+		{
+			continue;
+		}
+
+		for (const FZoneConnectionPoint& connection : zonePair.Value->GetZoneData().connectionPoints)
+		{
+			const FZonePathClusterGraphPtr toGraph = pathHierarchy.FindZoneGraph(connection.targetZone);
+			if (!toGraph.IsValid())
+			{
+				continue;
+			}
+
+			const FIntVector fromCell = fromGraph->GetGrid().WorldToGrid(connection.connectionLocation);
+			const FIntVector toCell = toGraph->GetGrid().WorldToGrid(connection.targetLocation);
+			const float linkSpan = FVector::Dist(connection.connectionLocation, connection.targetLocation);
+
+			pathHierarchy.AddZoneLink(zonePair.Key, fromCell, connection.targetZone, toCell, connection.transitionCost, linkSpan);
+			if (connection.bBidirectional)
+			{
+				pathHierarchy.AddZoneLink(connection.targetZone, toCell, zonePair.Key, fromCell, connection.transitionCost, linkSpan);
+			}
+		}
+	}
+
+	bPathHierarchyLinksDirty = false;
 }
\ No newline at end of file
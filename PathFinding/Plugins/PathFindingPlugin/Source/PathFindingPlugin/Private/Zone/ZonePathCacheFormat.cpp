@@ -0,0 +1,519 @@
+#include "Zone/ZonePathCacheFormat.h"
+#include "Zone/ZonePathScoreCache.h"
+
+#include "Misc/Crc.h"
+#include "Misc/Paths.h"
+#include "Misc/FileHelper.h"
+#include "HAL/FileManager.h"
+#include "HAL/PlatformFileManager.h"
+#include "Async/MappedFileHandle.h"
+#include "Misc/PackageName.h"
+
+namespace
+{
+	/**
+	* @Brief Computes checksum of a file image (header prefix + payload)
+	* @inBytes      : uint8* - File image start
+	* @inTotalSize  : int64  - File image size
+	* @inNodeOffset : uint64 - Payload start offset
+	* @Return       : uint32 - CRC32 value
+	*/
+	uint32 ComputeChecksum(const uint8* inBytes, int64 inTotalSize, uint64 inNodeOffset)
+	{
+		uint32 crc = FCrc::MemCrc32(inBytes, STRUCT_OFFSET(FZonePathCacheHeader, checksum));
+		return FCrc::MemCrc32(inBytes + inNodeOffset, static_cast<int32>(inTotalSize - static_cast<int64>(inNodeOffset)), crc);
+	}
+
+	/**
+	* @Brief Checks that [inOffset, inOffset + inSize) lies inside an image
+	* @inOffset    : uint64 - Range start
+	* @inSize      : uint64 - Range size
+	* @inImageSize : int64  - Image size
+	* @Return      : bool   - True if range is inside
+	*/
+	FORCEINLINE bool IsRangeInside(uint64 inOffset, uint64 inSize, int64 inImageSize)
+	{
+		const uint64 imageSize = static_cast<uint64>(inImageSize);
+		return inOffset <= imageSize && inSize <= imageSize - inOffset;
+	}
+
+	/**
+	* @Brief Decodes the name table ([uint16 length][UTF-8 bytes] per entry, count from header)
+	* @inData     : uint8*         - Name table start
+	* @inSize     : uint64         - Name table size
+	* @inCount    : uint32         - Expected entry count
+	* @outNames   : TArray<FName>& - Decoded names
+	* @Return     : bool           - True if table is well-formed
+	*/
+	bool DecodeNameTable(const uint8* inData, uint64 inSize, uint32 inCount, TArray<FName>& outNames)
+	{
+		outNames.Reset(inCount);
+		uint64 cursor = 0;
+		for (uint32 nameIndex = 0; nameIndex < inCount; ++nameIndex)
+		{
+			uint16 nameLength = 0;
+			if (cursor + sizeof(uint16) > inSize)
+			{
+				return false;
+			}
+			FMemory::Memcpy(&nameLength, inData + cursor, sizeof(uint16));
+			cursor += sizeof(uint16);
+
+			if (cursor + nameLength > inSize)
+			{
+				return false;
+			}
+			const FUTF8ToTCHAR nameConverter(reinterpret_cast<const UTF8CHAR*>(inData + cursor), nameLength);
+			outNames.Add(FName(nameConverter.Length(), nameConverter.Get()));
+			cursor += nameLength;
+		}
+		return cursor == inSize;
+	}
+}
+
+FString NZonePathCacheFormat::GetDeltaFilePath(const FString& inCacheFilePath)
+{
+	return inCacheFilePath + TEXT(".delta");
+}
+
+FString NZonePathCacheFormat::GetCacheDirectory()
+{
+	return FPaths::ProjectSavedDir() / TEXT("PathFindingCache");
+}
+
+FString NZonePathCacheFormat::GetCacheFilePath(const FZoneIdentifier& inZoneIdentifier)
+{
+	const FString fileName = FString::Printf(TEXT("%s_%d.zpcache"),
+		*inZoneIdentifier.zoneName.ToString(), inZoneIdentifier.zoneID);
+	return GetCacheDirectory() / fileName;
+}
+
+uint32 NZonePathCacheFormat::ComputeLevelContentHash(const FZoneLevelData& inZoneData)
+{
+	const FString packageName = inZoneData.levelAsset.GetLongPackageName();
+	uint32 crc = FCrc::StrCrc32(*packageName);
+
+	auto MixBytes = [&crc](const void* inData, int32 inSize)
+	{
+		crc = FCrc::MemCrc32(inData, inSize, crc);
+	};
+
+	// 디스크의 레벨 패키지가 바뀌면 다시 베이크 (쿠킹 빌드 등 파일이 없으면 경로만 사용)
+	FString packageFileName;
+	if (FPackageName::TryConvertLongPackageNameToFilename(packageName, packageFileName, FPackageName::GetMapPackageExtension()))
+	{
+		const int64 timestampTicks = IFileManager::Get().GetTimeStamp(*packageFileName).GetTicks();
+		MixBytes(&timestampTicks, sizeof(timestampTicks));
+	}
+
+	const FVector location = inZoneData.levelTransform.GetLocation();
+	const FQuat rotation = inZoneData.levelTransform.GetRotation();
+	const FVector scale = inZoneData.levelTransform.GetScale3D();
+	MixBytes(&location, sizeof(location));
+	MixBytes(&rotation, sizeof(rotation));
+	MixBytes(&scale, sizeof(scale));
+
+	const FZoneBounds& zoneBounds = inZoneData.zoneBounds;
+	MixBytes(&zoneBounds.center, sizeof(zoneBounds.center));
+	MixBytes(&zoneBounds.extent, sizeof(zoneBounds.extent));
+	MixBytes(&zoneBounds.height, sizeof(zoneBounds.height));
+
+	// 베이크가 읽는 설정: 지면 없는 셀의 차단 여부(pathType), 저장 비용 배율, 차단 태그
+	const FZonePathSettings& pathSettings = inZoneData.pathSettings;
+	MixBytes(&pathSettings.gridCellSize, sizeof(pathSettings.gridCellSize));
+	MixBytes(&pathSettings.gridStorage, sizeof(pathSettings.gridStorage));
+	MixBytes(&pathSettings.pathType, sizeof(pathSettings.pathType));
+	MixBytes(&pathSettings.movementCostMultiplier, sizeof(pathSettings.movementCostMultiplier));
+
+	const int32 blockedTagCount = pathSettings.blockedActorTags.Num();
+	MixBytes(&blockedTagCount, sizeof(blockedTagCount));
+	for (const FName& blockedTag : pathSettings.blockedActorTags)
+	{
+		crc = FCrc::StrCrc32(*blockedTag.ToString(), crc);
+	}
+
+	// 연결 지점은 베이크 후 노드에 기록되므로 포함 (대상 식별자 전체와 전환 비용)
+	const int32 connectionCount = inZoneData.connectionPoints.Num();
+	MixBytes(&connectionCount, sizeof(connectionCount));
+	for (const FZoneConnectionPoint& connection : inZoneData.connectionPoints)
+	{
+		MixBytes(&connection.connectionLocation, sizeof(connection.connectionLocation));
+		MixBytes(&connection.transitionCost, sizeof(connection.transitionCost));
+		crc = FCrc::StrCrc32(*connection.targetZone.zoneName.ToString(), crc);
+		MixBytes(&connection.targetZone.zoneType, sizeof(connection.targetZone.zoneType));
+		MixBytes(&connection.targetZone.zoneID, sizeof(connection.targetZone.zoneID));
+	}
+
+	// 0은 "해시 없음"으로 예약
+	return crc != 0 ? crc : 1;
+}
+
+bool NZonePathCacheFormat::WriteToBuffer(const FZonePathGrid& inGrid, uint32 inLevelContentHash, TArray<uint8>& outBytes)
+{
+	outBytes.Reset();
+
+	// 이름 테이블: 0번은 소유 존 이름, 이후 연결 대상 존 이름 (중복 제거)
+	TArray<FName> nameTable;
+	TMap<FName, int32> nameIndices;
+	auto findOrAddName = [&nameTable, &nameIndices](FName inName) -> int32
+	{
+		if (const int32* existingIndex = nameIndices.Find(inName))
+		{
+			return *existingIndex;
+		}
+		const int32 newIndex = nameTable.Add(inName);
+		nameIndices.Add(inName, newIndex);
+		return newIndex;
+	};
+	findOrAddName(inGrid.zoneIdentifier.zoneName);
+
+	TArray<FZonePathCacheNodeRecord> records;
+	records.Reserve(inGrid.pathNodes.Num());
+	bool bNameTableOverflow = false;
+
+	// Compact 그리드는 pathNodes 대신 레이어에서 기본값이 아닌 셀을 복원
+	inGrid.ForEachStoredNode([&](const FPathNode& node)
+	{
+		const int32 cellIndex = inGrid.GetNodeIndex(node.gridPosition);
+		if (cellIndex == INDEX_NONE || bNameTableOverflow)
+		{
+			return;
+		}
+
+		const FVector localPosition = node.worldPosition - inGrid.gridOrigin;
+
+		FZonePathCacheNodeRecord& record = records.AddZeroed_GetRef();
+		record.cellIndex = cellIndex;
+		record.movementCost = node.movementCost;
+		record.localPosition[0] = static_cast<float>(localPosition.X);
+		record.localPosition[1] = static_cast<float>(localPosition.Y);
+		record.localPosition[2] = static_cast<float>(localPosition.Z);
+		record.flags = static_cast<uint8>((node.bIsBlocked ? EZonePathNodeFlags::Blocked : EZonePathNodeFlags::None)
+			| (node.bIsConnectionPoint ? EZonePathNodeFlags::ConnectionPoint : EZonePathNodeFlags::None));
+		record.connectedZoneType = static_cast<uint8>(node.connectedZone.zoneType);
+		record.connectedZoneID = node.connectedZone.zoneID;
+		record.connectedZoneNameIndex = NO_NAME_INDEX;
+
+		if (node.connectedZone.zoneName != NAME_None)
+		{
+			const int32 nameIndex = findOrAddName(node.connectedZone.zoneName);
+			if (nameIndex >= NO_NAME_INDEX)
+			{
+				UE_LOG(LogTemp, Error, TEXT("NZonePathCacheFormat::WriteToBuffer - Too many connected zone names in %s"),
+					*inGrid.zoneIdentifier.ToString());
+				bNameTableOverflow = true;
+				return;
+			}
+			record.connectedZoneNameIndex = static_cast<uint16>(nameIndex);
+		}
+	});
+
+	if (bNameTableOverflow)
+	{
+		return false;
+	}
+
+	// 셀 인덱스 순 정렬: 로드 시 Dense 레이어 구성이 순차 접근이 되도록
+	records.Sort([](const FZonePathCacheNodeRecord& inA, const FZonePathCacheNodeRecord& inB)
+	{
+		return inA.cellIndex < inB.cellIndex;
+	});
+
+	TArray<uint8> nameTableBytes;
+	for (const FName& name : nameTable)
+	{
+		const FString nameString = name.ToString();
+		const FTCHARToUTF8 nameConverter(*nameString, nameString.Len());
+		const uint16 nameLength = static_cast<uint16>(FMath::Min(nameConverter.Length(), static_cast<int32>(MAX_uint16)));
+		nameTableBytes.Append(reinterpret_cast<const uint8*>(&nameLength), sizeof(uint16));
+		nameTableBytes.Append(reinterpret_cast<const uint8*>(nameConverter.Get()), nameLength);
+	}
+
+	FZonePathCacheHeader header;
+	FMemory::Memzero(header);
+	header.magic = FILE_MAGIC;
+	header.version = FILE_VERSION;
+	header.headerSize = sizeof(FZonePathCacheHeader);
+	header.recordSize = sizeof(FZonePathCacheNodeRecord);
+	header.gridDimensions[0] = inGrid.gridDimensions.X;
+	header.gridDimensions[1] = inGrid.gridDimensions.Y;
+	header.gridDimensions[2] = inGrid.gridDimensions.Z;
+	header.cellSize = inGrid.cellSize;
+	header.gridOrigin[0] = inGrid.gridOrigin.X;
+	header.gridOrigin[1] = inGrid.gridOrigin.Y;
+	header.gridOrigin[2] = inGrid.gridOrigin.Z;
+	header.lastUpdateTicks = inGrid.lastUpdateTime.GetTicks();
+	header.zoneID = inGrid.zoneIdentifier.zoneID;
+	header.zoneType = static_cast<uint8>(inGrid.zoneIdentifier.zoneType);
+	header.storageMode = static_cast<uint8>(inGrid.storageMode);
+	header.bIsGenerated = inGrid.bIsGenerated ? 1 : 0;
+	header.nodeCount = static_cast<uint32>(records.Num());
+	header.nameCount = static_cast<uint32>(nameTable.Num());
+	header.nodeOffset = sizeof(FZonePathCacheHeader);
+	header.nameTableOffset = header.nodeOffset + static_cast<uint64>(records.Num()) * sizeof(FZonePathCacheNodeRecord);
+	header.nameTableSize = nameTableBytes.Num();
+	header.levelContentHash = inLevelContentHash;
+
+	const int64 totalSize = static_cast<int64>(header.nameTableOffset + header.nameTableSize);
+	outBytes.SetNumUninitialized(totalSize);
+	FMemory::Memcpy(outBytes.GetData(), &header, sizeof(FZonePathCacheHeader));
+	FMemory::Memcpy(outBytes.GetData() + header.nodeOffset, records.GetData(), records.Num() * sizeof(FZonePathCacheNodeRecord));
+	FMemory::Memcpy(outBytes.GetData() + header.nameTableOffset, nameTableBytes.GetData(), nameTableBytes.Num());
+
+	header.checksum = ComputeChecksum(outBytes.GetData(), totalSize, header.nodeOffset);
+	FMemory::Memcpy(outBytes.GetData() + STRUCT_OFFSET(FZonePathCacheHeader, checksum), &header.checksum, sizeof(uint32));
+	return true;
+}
+
+bool NZonePathCacheFormat::ReadFromMemory(TConstArrayView<uint8> inBytes, FZonePathGrid& outGrid, uint32& outChecksum,
+	uint32& outLevelContentHash)
+{
+	outChecksum = 0;
+	outLevelContentHash = 0;
+	const int64 imageSize = inBytes.Num();
+	if (imageSize < static_cast<int64>(sizeof(FZonePathCacheHeader)))
+	{
+		return false;
+	}
+
+	FZonePathCacheHeader header;
+	FMemory::Memcpy(&header, inBytes.GetData(), sizeof(FZonePathCacheHeader));
+
+	if (header.magic != FILE_MAGIC || header.version != FILE_VERSION
+		|| header.headerSize != sizeof(FZonePathCacheHeader) || header.recordSize != sizeof(FZonePathCacheNodeRecord))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("NZonePathCacheFormat::ReadFromMemory - Unsupported cache format (magic 0x%08X, version %u)"),
+			header.magic, header.version);
+		return false;
+	}
+
+	const uint64 recordBytes = static_cast<uint64>(header.nodeCount) * sizeof(FZonePathCacheNodeRecord);
+	if (!IsRangeInside(header.nodeOffset, recordBytes, imageSize)
+		|| !IsRangeInside(header.nameTableOffset, header.nameTableSize, imageSize)
+		|| header.nameCount == 0 || header.nodeOffset < sizeof(FZonePathCacheHeader))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("NZonePathCacheFormat::ReadFromMemory - Truncated cache image"));
+		return false;
+	}
+
+	if (ComputeChecksum(inBytes.GetData(), imageSize, header.nodeOffset) != header.checksum)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("NZonePathCacheFormat::ReadFromMemory - Checksum mismatch"));
+		return false;
+	}
+	outChecksum = header.checksum;
+	outLevelContentHash = header.levelContentHash;
+
+	TArray<FName> nameTable;
+	if (!DecodeNameTable(inBytes.GetData() + header.nameTableOffset, header.nameTableSize, header.nameCount, nameTable))
+	{
+		UE_LOG(LogTemp, Warning, TEXT("NZonePathCacheFormat::ReadFromMemory - Malformed name table"));
+		return false;
+	}
+
+	outGrid = FZonePathGrid();
+	outGrid.zoneIdentifier = FZoneIdentifier(nameTable[0], static_cast<EZoneType>(header.zoneType), header.zoneID);
+	outGrid.gridDimensions = FIntVector(header.gridDimensions[0], header.gridDimensions[1], header.gridDimensions[2]);
+	outGrid.cellSize = header.cellSize;
+	outGrid.gridOrigin = FVector(header.gridOrigin[0], header.gridOrigin[1], header.gridOrigin[2]);
+	outGrid.lastUpdateTime = FDateTime(header.lastUpdateTicks);
+	outGrid.storageMode = static_cast<EZonePathGridStorage>(header.storageMode);
+	outGrid.bIsGenerated = header.bIsGenerated != 0;
+
+	const int64 cellCount = outGrid.GetCellCount();
+	if (outGrid.gridDimensions.X < 0 || outGrid.gridDimensions.Y < 0 || outGrid.gridDimensions.Z < 0 || cellCount > MAX_int32)
+	{
+		return false;
+	}
+
+	// 레코드는 매핑된 뷰에서 직접 디코딩 (중간 버퍼 없음)
+	const uint8* recordCursor = inBytes.GetData() + header.nodeOffset;
+	outGrid.pathNodes.Reserve(header.nodeCount);
+	for (uint32 recordIndex = 0; recordIndex < header.nodeCount; ++recordIndex, recordCursor += sizeof(FZonePathCacheNodeRecord))
+	{
+		FZonePathCacheNodeRecord record;
+		FMemory::Memcpy(&record, recordCursor, sizeof(FZonePathCacheNodeRecord));
+
+		if (record.cellIndex < 0 || record.cellIndex >= cellCount)
+		{
+			return false;
+		}
+
+		const FIntVector gridPos = outGrid.GetGridPosition(record.cellIndex);
+		const FVector worldPos = outGrid.gridOrigin + FVector(record.localPosition[0], record.localPosition[1], record.localPosition[2]);
+
+		FPathNode& node = outGrid.pathNodes.Add(gridPos, FPathNode(worldPos, gridPos, record.movementCost));
+		node.bIsBlocked = EnumHasAnyFlags(static_cast<EZonePathNodeFlags>(record.flags), EZonePathNodeFlags::Blocked);
+		node.bIsConnectionPoint = EnumHasAnyFlags(static_cast<EZonePathNodeFlags>(record.flags), EZonePathNodeFlags::ConnectionPoint);
+
+		if (record.connectedZoneNameIndex != NO_NAME_INDEX || record.connectedZoneID >= 0)
+		{
+			const FName connectedName = nameTable.IsValidIndex(record.connectedZoneNameIndex) ? nameTable[record.connectedZoneNameIndex] : FName(NAME_None);
+			node.connectedZone = FZoneIdentifier(connectedName, static_cast<EZoneType>(record.connectedZoneType), record.connectedZoneID);
+		}
+	}
+	return true;
+}
+
+bool NZonePathCacheFormat::WriteToFile(const FZonePathGrid& inGrid, uint32 inLevelContentHash, const FString& inFilePath,
+	uint32& outChecksum)
+{
+	TArray<uint8> fileBytes;
+	if (!WriteToBuffer(inGrid, inLevelContentHash, fileBytes))
+	{
+		return false;
+	}
+	FMemory::Memcpy(&outChecksum, fileBytes.GetData() + STRUCT_OFFSET(FZonePathCacheHeader, checksum), sizeof(uint32));
+
+	IFileManager::Get().MakeDirectory(*FPaths::GetPath(inFilePath), true);
+
+	// 임시 파일에 기록 후 교체: 기록 도중 중단되어도 이전 캐시가 유지됨
+	const FString tempFilePath = inFilePath + TEXT(".tmp");
+	if (!FFileHelper::SaveArrayToFile(fileBytes, *tempFilePath))
+	{
+		return false;
+	}
+	return IFileManager::Get().Move(*inFilePath, *tempFilePath, true, true);
+}
+
+bool NZonePathCacheFormat::ReadFromFile(const FString& inFilePath, FZonePathGrid& outGrid, uint32& outChecksum,
+	uint32& outLevelContentHash)
+{
+	IPlatformFile& platformFile = FPlatformFileManager::Get().GetPlatformFile();
+
+	// 매핑 가능한 플랫폼이면 파일 전체를 매핑하여 복사 없이 디코딩
+	FOpenMappedResult mappedResult = platformFile.OpenMappedEx(*inFilePath);
+	if (mappedResult.HasValue())
+	{
+		TUniquePtr<IMappedFileHandle> mappedHandle = mappedResult.StealValue();
+		TUniquePtr<IMappedFileRegion> mappedRegion(mappedHandle->MapRegion());
+		if (mappedRegion.IsValid() && mappedRegion->GetMappedSize() <= MAX_int32)
+		{
+			const TConstArrayView<uint8> mappedBytes(mappedRegion->GetMappedPtr(), mappedRegion->GetMappedSize());
+			return ReadFromMemory(mappedBytes, outGrid, outChecksum, outLevelContentHash);
+		}
+	}
+
+	TArray<uint8> fileBytes;
+	if (!FFileHelper::LoadFileToArray(fileBytes, *inFilePath, FILEREAD_Silent))
+	{
+		return false;
+	}
+	return ReadFromMemory(fileBytes, outGrid, outChecksum, outLevelContentHash);
+}
+
+bool NZonePathCacheFormat::AppendDeltaToFile(const FZonePathGrid& inGrid, TConstArrayView<int32> inCellIndices,
+	uint32 inBaseChecksum, const FString& inDeltaFilePath)
+{
+	if (inCellIndices.Num() == 0)
+	{
+		return true;
+	}
+
+	// 블록 구성: [레코드 수][레코드 CRC][레코드...]
+	TArray<FZonePathCacheDeltaRecord> records;
+	records.Reserve(inCellIndices.Num());
+	for (const int32 cellIndex : inCellIndices)
+	{
+		if (cellIndex < 0 || cellIndex >= inGrid.GetCellCount())
+		{
+			continue;
+		}
+
+		FZonePathCacheDeltaRecord& record = records.AddZeroed_GetRef();
+		record.cellIndex = cellIndex;
+		record.movementCost = inGrid.GetMovementCostAtIndex(cellIndex);
+		record.flags = static_cast<uint8>(inGrid.IsBlockedAtIndex(cellIndex) ? EZonePathNodeFlags::Blocked : EZonePathNodeFlags::None);
+	}
+
+	uint32 recordCount = static_cast<uint32>(records.Num());
+	uint32 recordChecksum = FCrc::MemCrc32(records.GetData(), records.Num() * sizeof(FZonePathCacheDeltaRecord));
+
+	const bool bNewFile = IFileManager::Get().FileSize(*inDeltaFilePath) <= 0;
+	TUniquePtr<FArchive> fileWriter(IFileManager::Get().CreateFileWriter(*inDeltaFilePath, FILEWRITE_Append));
+	if (!fileWriter)
+	{
+		return false;
+	}
+
+	if (bNewFile)
+	{
+		FZonePathCacheDeltaHeader header;
+		header.magic = DELTA_MAGIC;
+		header.version = FILE_VERSION;
+		header.baseChecksum = inBaseChecksum;
+		header.recordSize = sizeof(FZonePathCacheDeltaRecord);
+		fileWriter->Serialize(&header, sizeof(FZonePathCacheDeltaHeader));
+	}
+
+	fileWriter->Serialize(&recordCount, sizeof(uint32));
+	fileWriter->Serialize(&recordChecksum, sizeof(uint32));
+	fileWriter->Serialize(records.GetData(), records.Num() * sizeof(FZonePathCacheDeltaRecord));
+	return fileWriter->Close();
+}
+
+bool NZonePathCacheFormat::ApplyDeltaFile(const FString& inDeltaFilePath, uint32 inBaseChecksum,
+	FZonePathGrid& inOutGrid, int32& outAppliedCount)
+{
+	outAppliedCount = 0;
+
+	TArray<uint8> fileBytes;
+	if (!FFileHelper::LoadFileToArray(fileBytes, *inDeltaFilePath, FILEREAD_Silent))
+	{
+		// 델타 파일이 없으면 적용할 변경도 없음
+		return !IFileManager::Get().FileExists(*inDeltaFilePath);
+	}
+
+	FZonePathCacheDeltaHeader header;
+	if (fileBytes.Num() < static_cast<int32>(sizeof(FZonePathCacheDeltaHeader)))
+	{
+		return false;
+	}
+	FMemory::Memcpy(&header, fileBytes.GetData(), sizeof(FZonePathCacheDeltaHeader));
+
+	if (header.magic != DELTA_MAGIC || header.version != FILE_VERSION
+		|| header.recordSize != sizeof(FZonePathCacheDeltaRecord) || header.baseChecksum != inBaseChecksum)
+	{
+		UE_LOG(LogTemp, Warning, TEXT("NZonePathCacheFormat::ApplyDeltaFile - Stale or unsupported delta file: %s"), *inDeltaFilePath);
+		return false;
+	}
+
+	const int64 fileSize = fileBytes.Num();
+	int64 cursor = sizeof(FZonePathCacheDeltaHeader);
+	const int64 cellCount = inOutGrid.GetCellCount();
+
+	while (cursor < fileSize)
+	{
+		uint32 blockHeader[2];
+		if (!IsRangeInside(cursor, sizeof(blockHeader), fileSize))
+		{
+			return false;
+		}
+		FMemory::Memcpy(blockHeader, fileBytes.GetData() + cursor, sizeof(blockHeader));
+		cursor += sizeof(blockHeader);
+
+		// 기록 도중 중단된 꼬리 블록은 CRC로 걸러냄 (이전 블록까지만 적용)
+		const uint64 blockSize = static_cast<uint64>(blockHeader[0]) * sizeof(FZonePathCacheDeltaRecord);
+		if (!IsRangeInside(cursor, blockSize, fileSize)
+			|| FCrc::MemCrc32(fileBytes.GetData() + cursor, static_cast<int32>(blockSize)) != blockHeader[1])
+		{
+			UE_LOG(LogTemp, Warning, TEXT("NZonePathCacheFormat::ApplyDeltaFile - Torn delta block in %s"), *inDeltaFilePath);
+			return false;
+		}
+
+		for (uint32 recordIndex = 0; recordIndex < blockHeader[0]; ++recordIndex, cursor += sizeof(FZonePathCacheDeltaRecord))
+		{
+			FZonePathCacheDeltaRecord record;
+			FMemory::Memcpy(&record, fileBytes.GetData() + cursor, sizeof(FZonePathCacheDeltaRecord));
+			if (record.cellIndex < 0 || record.cellIndex >= cellCount)
+			{
+				continue;
+			}
+
+			inOutGrid.SetNodeState(inOutGrid.GetGridPosition(record.cellIndex), record.movementCost,
+				EnumHasAnyFlags(static_cast<EZonePathNodeFlags>(record.flags), EZonePathNodeFlags::Blocked));
+			++outAppliedCount;
+		}
+	}
+	return true;
+}
@@ -0,0 +1,143 @@
+#include "Zone/ZonePathFlowField.h"
+#include "Zone/ZonePathScoreCache.h"
+
+FZonePathFlowField::FZonePathFlowField(const FZonePathGrid& inGrid, const FZonePathSearchParams& inParams, const FIntVector& inGoal)
+	: searchParams(inParams)
+	, neighborVisitor(inGrid.gridDimensions, FZonePathNeighborVisitor::MakeDirectionMask(inParams.bAllowDiagonal, inParams.bAllowVertical))
+	, goalGridPosition(inGoal)
+	, gridDimensions(inGrid.gridDimensions)
+	, gridOrigin(inGrid.gridOrigin)
+	, cellSize(inGrid.cellSize)
+	, integrationCostStep(1.0f)
+	, reachedCellCount(0)
+{
+	const int32 cellCount = static_cast<int32>(inGrid.GetCellCount());
+	flowDirections.Init(NO_DIRECTION, cellCount);
+	integrationCostCodes.Init(UNREACHABLE_COST_CODE, cellCount);
+
+	// 확정 순서대로 비용을 모아두고 최대 비용이 정해진 뒤 양자화
+	TArray<TPair<int32, float>> settledCosts;
+	NZonePathSearch::SettleCellsFromGoal(inGrid, inParams, inGoal,
+		[&](int32 inCellIndex, int32 inNextIndex, float inCostToGoal)
+	{
+		FIntVector offset = FIntVector::ZeroValue;
+		if (inNextIndex != INDEX_NONE)
+		{
+			offset = inGrid.GetGridPosition(inNextIndex) - inGrid.GetGridPosition(inCellIndex);
+		}
+		flowDirections[inCellIndex] = static_cast<uint8>((offset.X + 1) + (offset.Y + 1) * 3 + (offset.Z + 1) * 9);
+		settledCosts.Add({ inCellIndex, inCostToGoal });
+	});
+
+	reachedCellCount = settledCosts.Num();
+	if (reachedCellCount == 0)
+	{
+		return;
+	}
+
+	// 다익스트라는 비용 비감소 순으로 확정하므로 마지막 셀이 최대 비용
+	integrationCostStep = FMath::Max(settledCosts.Last().Value, 1.0f) / MAX_COST_CODE;
+	for (const TPair<int32, float>& settled : settledCosts)
+	{
+		integrationCostCodes[settled.Key] = static_cast<uint16>(
+			FMath::Clamp(FMath::CeilToInt(settled.Value / integrationCostStep), 0, static_cast<int32>(MAX_COST_CODE)));
+	}
+}
+
+FVector FZonePathFlowField::SampleDirection(const FVector& inWorldPos) const
+{
+	const int32 cellIndex = GetCellIndex(WorldToGrid(inWorldPos));
+	if (cellIndex == INDEX_NONE || flowDirections[cellIndex] == NO_DIRECTION || flowDirections[cellIndex] == GOAL_DIRECTION)
+	{
+		return FVector::ZeroVector;
+	}
+
+	// 셀 중심 간 방향은 오프셋 방향과 같으므로 정규화만 수행
+	return FVector(DecodeDirection(flowDirections[cellIndex])).GetSafeNormal();
+}
+
+FIntVector FZonePathFlowField::WorldToGrid(const FVector& inWorldPos) const
+{
+	FVector relativePos = inWorldPos - gridOrigin;
+	return FIntVector(
+		FMath::FloorToInt(relativePos.X / cellSize),
+		FMath::FloorToInt(relativePos.Y / cellSize),
+		FMath::FloorToInt(relativePos.Z / cellSize)
+	);
+}
+
+bool FZonePathFlowField::IsAffectedByCellChange(const FZonePathCellTransition& inTransition) const
+{
+	const FIntVector& gridPos = inTransition.gridPos;
+	const int32 cellIndex = GetCellIndex(gridPos);
+	if (cellIndex == INDEX_NONE || !searchParams.IsInsideBounds(gridPos))
+	{
+		return false;
+	}
+
+	// 계속 막혀 있거나 실제로 바뀐 것이 없는 셀
+	if (!inTransition.bWasTraversable && !inTransition.bIsTraversable)
+	{
+		return false;
+	}
+	if (inTransition.bWasTraversable == inTransition.bIsTraversable && inTransition.oldCost == inTransition.newCost)
+	{
+		return false;
+	}
+
+	if (flowDirections[cellIndex] == NO_DIRECTION)
+	{
+		// 열려 있었는데 도달하지 못한 셀은 다른 연결 요소라 비용이 바뀌어도 무관
+		if (inTransition.bWasTraversable)
+		{
+			return false;
+		}
+		if (gridPos == goalGridPosition)
+		{
+			return true;
+		}
+
+		// 새로 열린 셀은 도달 영역과 맞닿을 때만 방향을 얻음
+		bool bTouchesReached = false;
+		neighborVisitor.VisitNeighborsBy(gridPos, cellIndex,
+			[&](int32 inDirection, const FIntVector& inNeighborPos, int32 inNeighborIndex)
+		{
+			bTouchesReached |= flowDirections[inNeighborIndex] != NO_DIRECTION;
+		});
+		return bTouchesReached;
+	}
+
+	// 도달하던 셀이 막히면 이 셀부터 방향을 잃음
+	if (!inTransition.bIsTraversable)
+	{
+		return true;
+	}
+
+	// 이 셀의 비용은 이 셀로 진입하는 이웃의 적분 비용에만 반영됨
+	const float cellCostToGoal = GetIntegrationCost(gridPos);
+	const bool bCostDecreased = inTransition.newCost < inTransition.oldCost;
+	bool bAffected = false;
+	neighborVisitor.VisitNeighborsBy(gridPos, cellIndex,
+		[&](int32 inDirection, const FIntVector& inNeighborPos, int32 inNeighborIndex)
+	{
+		if (bAffected || flowDirections[inNeighborIndex] == NO_DIRECTION)
+		{
+			return;
+		}
+
+		// 이 셀을 거쳐 가는 이웃은 비용 변화를 그대로 물려받음
+		if (inNeighborPos + DecodeDirection(flowDirections[inNeighborIndex]) == gridPos)
+		{
+			bAffected = true;
+			return;
+		}
+
+		// 비용이 내려가면 이 셀을 거치는 편이 더 싸질 수 있음 (양자화 오차 한 단계만큼 재빌드 쪽으로 판단)
+		if (bCostDecreased)
+		{
+			const float viaCost = cellCostToGoal - integrationCostStep + FZonePathNeighborVisitor::GetStepLength(inDirection) * inTransition.newCost;
+			bAffected = viaCost < GetIntegrationCost(inNeighborPos);
+		}
+	});
+	return bAffected;
+}
@@ -0,0 +1,784 @@
+#include "Zone/ZonePathHierarchy.h"
+#include "Algo/Reverse.h"
+
+namespace
+{
+	/**
+	* @Brief Checks whether a cell can be entered by a search
+	* @inGrid    : FZonePathGrid - Grid being searched
+	* @inGridPos : FIntVector    - Grid position
+	* @Return    : bool          - True if cell is inside the grid, open and has positive cost
+	*/
+	FORCEINLINE bool IsCellTraversable(const FZonePathGrid& inGrid, const FIntVector& inGridPos)
+	{
+		const int32 nodeIndex = inGrid.GetNodeIndex(inGridPos);
+		return nodeIndex != INDEX_NONE && !inGrid.IsBlockedAtIndex(nodeIndex) && inGrid.GetMovementCostAtIndex(nodeIndex) > 0.0f;
+	}
+
+	/** @Brief Open-set entry of the abstract search */
+	struct FAbstractOpenEntry
+	{
+		float fScore;
+		int32 nodeIndex;
+	};
+
+	/** @Brief Abstract search state of the start cell, the goal cell or one abstract node of a zone */
+	struct FAbstractSearchNode
+	{
+		int32 zoneSlot;
+		int32 localNode;
+		float gScore;
+		int32 parentNode;
+		bool bClosed;
+	};
+
+	/**
+	* @Brief Packs a zone slot and a node index of that zone into a search lookup key
+	* @inZoneSlot  : int32  - Zone slot of the search
+	* @inLocalNode : int32  - Node index in the zone cluster graph
+	* @Return      : uint64 - Lookup key
+	*/
+	FORCEINLINE uint64 MakeAbstractNodeKey(int32 inZoneSlot, int32 inLocalNode)
+	{
+		return (static_cast<uint64>(static_cast<uint32>(inZoneSlot)) << 32) | static_cast<uint32>(inLocalNode);
+	}
+
+	/** @Brief Heap ordering for the abstract open set (lowest fScore first) */
+	struct FAbstractOpenPredicate
+	{
+		FORCEINLINE bool operator()(const FAbstractOpenEntry& inA, const FAbstractOpenEntry& inB) const
+		{
+			return inA.fScore < inB.fScore;
+		}
+	};
+}
+
+FZonePathClusterGraph::FZonePathClusterGraph(FZonePathGridSnapshotPtr inGrid, const FZonePathSearchParams& inParams,
+	int32 inClusterSize, TConstArrayView<FIntVector> inAnchorCells)
+	: gridSnapshot(MoveTemp(inGrid))
+	, searchParams(inParams)
+	, neighborVisitor(gridSnapshot->gridDimensions, FZonePathNeighborVisitor::MakeDirectionMask(inParams.bAllowDiagonal, inParams.bAllowVertical))
+	, clusterSize(FMath::Max(2, inClusterSize))
+	, clusterCountX(0)
+	, clusterCountY(0)
+{
+	check(gridSnapshot.IsValid());
+
+	// 영역 제한은 그래프가 직접 설정
+	searchParams.bRestrictToBounds = false;
+
+	const FIntVector& gridDimensions = gridSnapshot->gridDimensions;
+	if (gridDimensions.X <= 0 || gridDimensions.Y <= 0 || gridDimensions.Z <= 0)
+	{
+		return;
+	}
+
+	clusterCountX = FMath::DivideAndRoundUp(gridDimensions.X, clusterSize);
+	clusterCountY = FMath::DivideAndRoundUp(gridDimensions.Y, clusterSize);
+	clusterNodes.SetNum(clusterCountX * clusterCountY);
+
+	// 인접 클러스터 경계마다 입구 생성
+	for (int32 clusterY = 0; clusterY < clusterCountY; ++clusterY)
+	{
+		for (int32 clusterX = 0; clusterX < clusterCountX; ++clusterX)
+		{
+			if (clusterX + 1 < clusterCountX)
+			{
+				BuildEntrances(clusterX, clusterY, true);
+			}
+			if (clusterY + 1 < clusterCountY)
+			{
+				BuildEntrances(clusterX, clusterY, false);
+			}
+		}
+	}
+
+	// 연결 지점 등 고정 노드 추가
+	for (const FIntVector& anchorCell : inAnchorCells)
+	{
+		if (gridSnapshot->IsValidGridPosition(anchorCell))
+		{
+			FindOrAddNode(anchorCell);
+		}
+	}
+
+	for (int32 clusterIndex = 0; clusterIndex < clusterNodes.Num(); ++clusterIndex)
+	{
+		BuildIntraClusterEdges(clusterIndex);
+	}
+}
+
+FZonePathClusterGraph::FZonePathClusterGraph(const FZonePathClusterGraph& inPrevious, FZonePathGridSnapshotPtr inGrid,
+	TConstArrayView<FIntVector> inChangedCells, TConstArrayView<FIntVector> inAnchorCells)
+	: gridSnapshot(MoveTemp(inGrid))
+	, searchParams(inPrevious.searchParams)
+	, neighborVisitor(inPrevious.neighborVisitor)
+	, clusterSize(inPrevious.clusterSize)
+	, clusterCountX(inPrevious.clusterCountX)
+	, clusterCountY(inPrevious.clusterCountY)
+{
+	check(gridSnapshot.IsValid());
+	check(gridSnapshot->gridDimensions == inPrevious.gridSnapshot->gridDimensions);
+
+	clusterNodes.SetNum(clusterCountX * clusterCountY);
+	if (clusterNodes.Num() == 0)
+	{
+		return;
+	}
+
+	TBitArray<> dirtyClusters(false, clusterNodes.Num());
+	for (const FIntVector& changedCell : inChangedCells)
+	{
+		const int32 clusterIndex = GetClusterIndex(changedCell);
+		if (clusterIndex != INDEX_NONE)
+		{
+			dirtyClusters[clusterIndex] = true;
+		}
+	}
+
+	// 양쪽 클러스터가 모두 그대로인 경계의 입구는 이전 그래프에서 복사 (낮은 인덱스 쪽에서 한 번만)
+	for (const FZonePathAbstractNode& previousNode : inPrevious.nodes)
+	{
+		if (dirtyClusters[previousNode.clusterIndex])
+		{
+			continue;
+		}
+
+		for (const FZonePathAbstractEdge& edge : previousNode.edges)
+		{
+			const FZonePathAbstractNode& previousTarget = inPrevious.nodes[edge.targetNode];
+			if (previousTarget.clusterIndex > previousNode.clusterIndex && !dirtyClusters[previousTarget.clusterIndex])
+			{
+				AddEntrance(previousNode.gridPosition, previousTarget.gridPosition);
+			}
+		}
+	}
+
+	// 변경된 클러스터에 닿은 경계만 입구 재생성
+	for (int32 clusterY = 0; clusterY < clusterCountY; ++clusterY)
+	{
+		for (int32 clusterX = 0; clusterX < clusterCountX; ++clusterX)
+		{
+			const int32 clusterIndex = clusterX + clusterY * clusterCountX;
+			if (clusterX + 1 < clusterCountX && (dirtyClusters[clusterIndex] || dirtyClusters[clusterIndex + 1]))
+			{
+				BuildEntrances(clusterX, clusterY, true);
+			}
+			if (clusterY + 1 < clusterCountY && (dirtyClusters[clusterIndex] || dirtyClusters[clusterIndex + clusterCountX]))
+			{
+				BuildEntrances(clusterX, clusterY, false);
+			}
+		}
+	}
+
+	for (const FIntVector& anchorCell : inAnchorCells)
+	{
+		if (gridSnapshot->IsValidGridPosition(anchorCell))
+		{
+			FindOrAddNode(anchorCell);
+		}
+	}
+
+	// 셀이 그대로이고 노드 구성도 같은 클러스터는 내부 비용 재사용
+	for (int32 clusterIndex = 0; clusterIndex < clusterNodes.Num(); ++clusterIndex)
+	{
+		if (dirtyClusters[clusterIndex] || !CopyIntraClusterEdges(inPrevious, clusterIndex))
+		{
+			BuildIntraClusterEdges(clusterIndex);
+		}
+	}
+}
+
+bool FZonePathClusterGraph::CanUpdateIncrementally(const FZonePathGrid& inGrid, const FZonePathSearchParams& inParams, int32 inClusterSize) const
+{
+	return clusterSize == FMath::Max(2, inClusterSize)
+		&& inGrid.gridDimensions == gridSnapshot->gridDimensions
+		&& inParams.bAllowDiagonal == searchParams.bAllowDiagonal
+		&& inParams.bAllowVertical == searchParams.bAllowVertical
+		&& inParams.maxExpansions == searchParams.maxExpansions
+		&& inParams.searchMode == searchParams.searchMode;
+}
+
+int32 FZonePathClusterGraph::FindNode(const FIntVector& inGridPos) const
+{
+	const int32* nodeIndexPtr = nodeLookup.Find(inGridPos);
+	return nodeIndexPtr ? *nodeIndexPtr : INDEX_NONE;
+}
+
+int32 FZonePathClusterGraph::GetClusterIndex(const FIntVector& inGridPos) const
+{
+	if (clusterCountX == 0 || !gridSnapshot->IsValidGridPosition(inGridPos))
+	{
+		return INDEX_NONE;
+	}
+	return (inGridPos.X / clusterSize) + (inGridPos.Y / clusterSize) * clusterCountX;
+}
+
+void FZonePathClusterGraph::GetClusterBounds(int32 inClusterIndex, FIntVector& outMin, FIntVector& outMax) const
+{
+	const FIntVector& gridDimensions = gridSnapshot->gridDimensions;
+	const int32 clusterX = inClusterIndex % clusterCountX;
+	const int32 clusterY = inClusterIndex / clusterCountX;
+
+	outMin = FIntVector(clusterX * clusterSize, clusterY * clusterSize, 0);
+	outMax = FIntVector(
+		FMath::Min((clusterX + 1) * clusterSize, gridDimensions.X) - 1,
+		FMath::Min((clusterY + 1) * clusterSize, gridDimensions.Y) - 1,
+		gridDimensions.Z - 1
+	);
+}
+
+bool FZonePathClusterGraph::ConnectCell(const FIntVector& inGridPos, bool bFromCell, TArray<FZonePathAbstractEdge>& outEdges) const
+{
+	outEdges.Reset();
+
+	const int32 clusterIndex = GetClusterIndex(inGridPos);
+	if (clusterIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	const TArray<int32>& candidateNodes = clusterNodes[clusterIndex];
+	if (candidateNodes.Num() == 0)
+	{
+		return true;
+	}
+
+	const FZonePathSearchParams regionParams = MakeRegionParams(inGridPos, inGridPos);
+
+	TArray<FIntVector, TInlineAllocator<32>> nodeCells;
+	for (int32 nodeIndex : candidateNodes)
+	{
+		nodeCells.Add(nodes[nodeIndex].gridPosition);
+	}
+
+	// 셀->노드는 정방향, 노드->셀은 셀에서 역방향으로 한 번의 다익스트라 (이동 비용이 진입 셀 기준이라 방향별로 구분)
+	TArray<float> nodeCosts;
+	if (bFromCell)
+	{
+		NZonePathSearch::FindCostsToTargets(*gridSnapshot, regionParams, inGridPos, nodeCells, nodeCosts, &neighborVisitor);
+	}
+	else
+	{
+		NZonePathSearch::FindCostsFromStarts(*gridSnapshot, regionParams, inGridPos, nodeCells, nodeCosts, &neighborVisitor);
+	}
+
+	for (int32 slot = 0; slot < candidateNodes.Num(); ++slot)
+	{
+		if (nodeCosts[slot] < MAX_flt)
+		{
+			outEdges.Add({ candidateNodes[slot], nodeCosts[slot] });
+		}
+	}
+	return true;
+}
+
+bool FZonePathClusterGraph::RefineEdge(const FIntVector& inFrom, const FIntVector& inTo, TArray<FIntVector>& outCells, float& outCost) const
+{
+	return NZonePathSearch::FindPath(*gridSnapshot, MakeRegionParams(inFrom, inTo), inFrom, inTo, outCells, outCost, &neighborVisitor);
+}
+
+int32 FZonePathClusterGraph::FindOrAddNode(const FIntVector& inGridPos)
+{
+	if (const int32* existingIndex = nodeLookup.Find(inGridPos))
+	{
+		return *existingIndex;
+	}
+
+	const int32 clusterIndex = GetClusterIndex(inGridPos);
+	const int32 nodeIndex = nodes.Num();
+
+	FZonePathAbstractNode& newNode = nodes.AddDefaulted_GetRef();
+	newNode.gridPosition = inGridPos;
+	newNode.clusterIndex = clusterIndex;
+
+	nodeLookup.Add(inGridPos, nodeIndex);
+	clusterNodes[clusterIndex].Add(nodeIndex);
+	return nodeIndex;
+}
+
+void FZonePathClusterGraph::BuildEntrances(int32 inClusterX, int32 inClusterY, bool bAlongX)
+{
+	const FZonePathGrid& grid = *gridSnapshot;
+	const FIntVector& gridDimensions = grid.gridDimensions;
+
+	// +X 경계는 Y를 따라, +Y 경계는 X를 따라 진행
+	const int32 borderCoord = (bAlongX ? inClusterX + 1 : inClusterY + 1) * clusterSize - 1;
+	const int32 runStart = (bAlongX ? inClusterY : inClusterX) * clusterSize;
+	const int32 runEnd = FMath::Min(runStart + clusterSize, bAlongX ? gridDimensions.Y : gridDimensions.X);
+
+	auto MakeCellPair = [bAlongX, borderCoord](int32 inRunCoord, int32 inZ, FIntVector& outA, FIntVector& outB)
+	{
+		outA = bAlongX ? FIntVector(borderCoord, inRunCoord, inZ) : FIntVector(inRunCoord, borderCoord, inZ);
+		outB = bAlongX ? FIntVector(borderCoord + 1, inRunCoord, inZ) : FIntVector(inRunCoord, borderCoord + 1, inZ);
+	};
+
+	auto EmitRun = [&](int32 inFirst, int32 inLength, int32 inZ)
+	{
+		FIntVector cellA;
+		FIntVector cellB;
+		if (inLength <= MAX_SINGLE_ENTRANCE_RUN)
+		{
+			MakeCellPair(inFirst + inLength / 2, inZ, cellA, cellB);
+			AddEntrance(cellA, cellB);
+			return;
+		}
+
+		// 긴 구간은 양 끝에 입구를 두어 우회 비용 과대평가 완화
+		MakeCellPair(inFirst, inZ, cellA, cellB);
+		AddEntrance(cellA, cellB);
+		MakeCellPair(inFirst + inLength - 1, inZ, cellA, cellB);
+		AddEntrance(cellA, cellB);
+	};
+
+	for (int32 z = 0; z < gridDimensions.Z; ++z)
+	{
+		int32 openRunFirst = INDEX_NONE;
+		for (int32 runCoord = runStart; runCoord < runEnd; ++runCoord)
+		{
+			FIntVector cellA;
+			FIntVector cellB;
+			MakeCellPair(runCoord, z, cellA, cellB);
+
+			const bool bOpenPair = IsCellTraversable(grid, cellA) && IsCellTraversable(grid, cellB);
+			if (bOpenPair && openRunFirst == INDEX_NONE)
+			{
+				openRunFirst = runCoord;
+			}
+			else if (!bOpenPair && openRunFirst != INDEX_NONE)
+			{
+				EmitRun(openRunFirst, runCoord - openRunFirst, z);
+				openRunFirst = INDEX_NONE;
+			}
+		}
+
+		if (openRunFirst != INDEX_NONE)
+		{
+			EmitRun(openRunFirst, runEnd - openRunFirst, z);
+		}
+	}
+}
+
+void FZonePathClusterGraph::AddEntrance(const FIntVector& inCellA, const FIntVector& inCellB)
+{
+	const FZonePathGrid& grid = *gridSnapshot;
+	const int32 nodeA = FindOrAddNode(inCellA);
+	const int32 nodeB = FindOrAddNode(inCellB);
+
+	// 한 칸 직선 이동: 비용은 진입 셀의 이동 비용
+	nodes[nodeA].edges.Add({ nodeB, grid.GetMovementCostAtIndex(grid.GetNodeIndex(inCellB)) });
+	nodes[nodeB].edges.Add({ nodeA, grid.GetMovementCostAtIndex(grid.GetNodeIndex(inCellA)) });
+}
+
+void FZonePathClusterGraph::BuildIntraClusterEdges(int32 inClusterIndex)
+{
+	const TArray<int32>& memberNodes = clusterNodes[inClusterIndex];
+	if (memberNodes.Num() < 2)
+	{
+		return;
+	}
+
+	TArray<FIntVector, TInlineAllocator<32>> targetCells;
+	for (int32 nodeIndex : memberNodes)
+	{
+		targetCells.Add(nodes[nodeIndex].gridPosition);
+	}
+
+	FIntVector clusterMin;
+	FIntVector clusterMax;
+	GetClusterBounds(inClusterIndex, clusterMin, clusterMax);
+
+	FZonePathSearchParams regionParams = searchParams;
+	regionParams.SetBounds(clusterMin, clusterMax);
+
+	// 노드마다 클러스터 안에서 다른 노드 전체까지의 비용 계산
+	TArray<float> targetCosts;
+	for (int32 sourceSlot = 0; sourceSlot < memberNodes.Num(); ++sourceSlot)
+	{
+		const int32 sourceNode = memberNodes[sourceSlot];
+		NZonePathSearch::FindCostsToTargets(*gridSnapshot, regionParams, nodes[sourceNode].gridPosition, targetCells, targetCosts, &neighborVisitor);
+
+		for (int32 targetSlot = 0; targetSlot < memberNodes.Num(); ++targetSlot)
+		{
+			if (targetSlot != sourceSlot && targetCosts[targetSlot] < MAX_flt)
+			{
+				nodes[sourceNode].edges.Add({ memberNodes[targetSlot], targetCosts[targetSlot] });
+			}
+		}
+	}
+}
+
+bool FZonePathClusterGraph::CopyIntraClusterEdges(const FZonePathClusterGraph& inPrevious, int32 inClusterIndex)
+{
+	const TArray<int32>& memberNodes = clusterNodes[inClusterIndex];
+	if (memberNodes.Num() != inPrevious.clusterNodes[inClusterIndex].Num())
+	{
+		return false;
+	}
+
+	// 셀 위치는 노드마다 유일하므로 개수가 같고 모두 이전에도 있었으면 같은 구성
+	for (int32 nodeIndex : memberNodes)
+	{
+		if (inPrevious.FindNode(nodes[nodeIndex].gridPosition) == INDEX_NONE)
+		{
+			return false;
+		}
+	}
+
+	for (int32 nodeIndex : memberNodes)
+	{
+		const FZonePathAbstractNode& previousNode = inPrevious.nodes[inPrevious.FindNode(nodes[nodeIndex].gridPosition)];
+		for (const FZonePathAbstractEdge& edge : previousNode.edges)
+		{
+			const FZonePathAbstractNode& previousTarget = inPrevious.nodes[edge.targetNode];
+			if (previousTarget.clusterIndex == inClusterIndex)
+			{
+				nodes[nodeIndex].edges.Add({ FindNode(previousTarget.gridPosition), edge.cost });
+			}
+		}
+	}
+	return true;
+}
+
+FZonePathSearchParams FZonePathClusterGraph::MakeRegionParams(const FIntVector& inA, const FIntVector& inB) const
+{
+	FZonePathSearchParams regionParams = searchParams;
+
+	const int32 clusterA = GetClusterIndex(inA);
+	const int32 clusterB = GetClusterIndex(inB);
+	if (clusterA == INDEX_NONE || clusterB == INDEX_NONE)
+	{
+		return regionParams;
+	}
+
+	FIntVector minA, maxA, minB, maxB;
+	GetClusterBounds(clusterA, minA, maxA);
+	GetClusterBounds(clusterB, minB, maxB);
+
+	regionParams.SetBounds(
+		FIntVector(FMath::Min(minA.X, minB.X), FMath::Min(minA.Y, minB.Y), FMath::Min(minA.Z, minB.Z)),
+		FIntVector(FMath::Max(maxA.X, maxB.X), FMath::Max(maxA.Y, maxB.Y), FMath::Max(maxA.Z, maxB.Z))
+	);
+	return regionParams;
+}
+
+void FZonePathHierarchy::SetZoneGraph(const FZoneIdentifier& inZoneIdentifier, FZonePathClusterGraphPtr inGraph)
+{
+	zoneGraphs.Add(inZoneIdentifier, MoveTemp(inGraph));
+}
+
+void FZonePathHierarchy::RemoveZoneGraph(const FZoneIdentifier& inZoneIdentifier)
+{
+	zoneGraphs.Remove(inZoneIdentifier);
+}
+
+FZonePathClusterGraphPtr FZonePathHierarchy::FindZoneGraph(const FZoneIdentifier& inZoneIdentifier) const
+{
+	const FZonePathClusterGraphPtr* graphPtr = zoneGraphs.Find(inZoneIdentifier);
+	return graphPtr ? *graphPtr : FZonePathClusterGraphPtr();
+}
+
+void FZonePathHierarchy::AddZoneLink(const FZoneIdentifier& inFromZone, const FIntVector& inFromCell,
+	const FZoneIdentifier& inToZone, const FIntVector& inToCell, float inCost, float inSpan)
+{
+	zoneLinks.FindOrAdd(inFromZone).Add({ inFromCell, inToZone, inToCell, FMath::Max(0.0f, inCost), inSpan });
+}
+
+void FZonePathHierarchy::ClearZoneLinks()
+{
+	zoneLinks.Reset();
+}
+
+bool FZonePathHierarchy::FindRoute(const FZoneIdentifier& inStartZone, const FIntVector& inStartCell,
+	const FZoneIdentifier& inGoalZone, const FIntVector& inGoalCell, FZonePathHierarchyRoute& outRoute) const
+{
+	outRoute.waypoints.Reset();
+	outRoute.totalCost = 0.0f;
+
+	const FZonePathClusterGraphPtr startGraph = FindZoneGraph(inStartZone);
+	const FZonePathClusterGraphPtr goalGraph = FindZoneGraph(inGoalZone);
+	if (!startGraph.IsValid() || !goalGraph.IsValid() || !IsCellTraversable(goalGraph->GetGrid(), inGoalCell))
+	{
+		return false;
+	}
+
+	struct FLinkEdge
+	{
+		int32 targetSlot;
+		int32 targetNode;
+		float cost;
+	};
+
+	// 존 단위 슬롯만 구성 (추상 노드는 검색이 도달할 때 만듦)
+	TArray<FZoneIdentifier> slotZones;
+	TArray<const FZonePathClusterGraph*> slotGraphs;
+	TMap<FZoneIdentifier, int32> slotLookup;
+
+	float heuristicScale = MAX_flt;
+	for (const TPair<FZoneIdentifier, FZonePathClusterGraphPtr>& graphPair : zoneGraphs)
+	{
+		if (!graphPair.Value.IsValid())
+		{
+			continue;
+		}
+
+		slotLookup.Add(graphPair.Key, slotZones.Num());
+		slotZones.Add(graphPair.Key);
+		slotGraphs.Add(graphPair.Value.Get());
+
+		// 월드 거리 1당 최소 비용 (셀 크기가 존마다 다를 수 있음)
+		const FZonePathGrid& grid = graphPair.Value->GetGrid();
+		heuristicScale = FMath::Min(heuristicScale, grid.GetMinMovementCost() / FMath::Max(grid.cellSize, KINDA_SMALL_NUMBER));
+	}
+
+	// 존 링크를 출발 앵커 노드 키로 색인 (양 끝이 앵커 노드인 링크만)
+	TMap<uint64, TArray<FLinkEdge>> linkEdges;
+	for (const TPair<FZoneIdentifier, TArray<FZoneLink>>& linkPair : zoneLinks)
+	{
+		const int32* fromSlotPtr = slotLookup.Find(linkPair.Key);
+		if (!fromSlotPtr)
+		{
+			continue;
+		}
+
+		for (const FZoneLink& link : linkPair.Value)
+		{
+			const int32* toSlotPtr = slotLookup.Find(link.targetZone);
+			if (!toSlotPtr)
+			{
+				continue;
+			}
+
+			const int32 fromLocal = slotGraphs[*fromSlotPtr]->FindNode(link.fromCell);
+			const int32 toLocal = slotGraphs[*toSlotPtr]->FindNode(link.targetCell);
+			if (fromLocal == INDEX_NONE || toLocal == INDEX_NONE)
+			{
+				continue;
+			}
+
+			linkEdges.FindOrAdd(MakeAbstractNodeKey(*fromSlotPtr, fromLocal)).Add({ *toSlotPtr, toLocal, link.cost });
+
+			// 링크가 직선거리보다 싸면 휴리스틱 배율을 낮춰 허용성 유지
+			if (link.span > KINDA_SMALL_NUMBER)
+			{
+				heuristicScale = FMath::Min(heuristicScale, link.cost / link.span);
+			}
+		}
+	}
+	heuristicScale = heuristicScale < MAX_flt ? FMath::Max(0.0f, heuristicScale) : 0.0f;
+
+	// 시작/목표 셀을 소속 클러스터 노드에 임시 연결
+	const int32 startSlot = slotLookup.FindChecked(inStartZone);
+	const int32 goalSlot = slotLookup.FindChecked(inGoalZone);
+
+	TArray<FZonePathAbstractEdge> startEdges;
+	if (!startGraph->ConnectCell(inStartCell, true, startEdges))
+	{
+		return false;
+	}
+
+	TArray<FZonePathAbstractEdge> cellEdges;
+	if (!goalGraph->ConnectCell(inGoalCell, false, cellEdges))
+	{
+		return false;
+	}
+	TMap<int32, float> goalCosts;
+	for (const FZonePathAbstractEdge& edge : cellEdges)
+	{
+		goalCosts.Add(edge.targetNode, edge.cost);
+	}
+
+	// 같은 클러스터면 추상 노드를 거치지 않는 직행 간선도 고려
+	float directCost = MAX_flt;
+	if (inStartZone == inGoalZone && startGraph->GetClusterIndex(inStartCell) == startGraph->GetClusterIndex(inGoalCell))
+	{
+		TArray<FIntVector> directCells;
+		if (!startGraph->RefineEdge(inStartCell, inGoalCell, directCells, directCost))
+		{
+			directCost = MAX_flt;
+		}
+	}
+
+	// 검색 노드는 도달한 것만 생성 (0: 시작 셀, 1: 목표 셀)
+	const int32 startNode = 0;
+	const int32 goalNode = 1;
+	TArray<FAbstractSearchNode> searchNodes;
+	TMap<uint64, int32> searchNodeLookup;
+	searchNodes.Add({ startSlot, INDEX_NONE, 0.0f, INDEX_NONE, false });
+	searchNodes.Add({ goalSlot, INDEX_NONE, MAX_flt, INDEX_NONE, false });
+
+	auto GetNodeGridPosition = [&](int32 inSearchNode) -> FIntVector
+	{
+		if (inSearchNode == startNode)
+		{
+			return inStartCell;
+		}
+		if (inSearchNode == goalNode)
+		{
+			return inGoalCell;
+		}
+		const FAbstractSearchNode& searchNode = searchNodes[inSearchNode];
+		return slotGraphs[searchNode.zoneSlot]->GetNodes()[searchNode.localNode].gridPosition;
+	};
+
+	auto GetNodeWorldPosition = [&](int32 inSearchNode) -> FVector
+	{
+		return slotGraphs[searchNodes[inSearchNode].zoneSlot]->GetGrid().GridToWorld(GetNodeGridPosition(inSearchNode));
+	};
+
+	const FVector goalWorldPosition = GetNodeWorldPosition(goalNode);
+
+	const FAbstractOpenPredicate openPredicate;
+	TArray<FAbstractOpenEntry> openHeap;
+	openHeap.HeapPush({ 0.0f, startNode }, openPredicate);
+
+	auto RelaxEdge = [&](int32 inFromNode, int32 inToNode, float inCost)
+	{
+		const float tentativeG = searchNodes[inFromNode].gScore + inCost;
+		FAbstractSearchNode& toNode = searchNodes[inToNode];
+		if (toNode.bClosed || tentativeG >= toNode.gScore)
+		{
+			return;
+		}
+
+		toNode.gScore = tentativeG;
+		toNode.parentNode = inFromNode;
+		const float heuristic = FVector::Dist(GetNodeWorldPosition(inToNode), goalWorldPosition) * heuristicScale;
+		openHeap.HeapPush({ tentativeG + heuristic, inToNode }, openPredicate);
+	};
+
+	auto RelaxAbstractEdge = [&](int32 inFromNode, int32 inZoneSlot, int32 inLocalNode, float inCost)
+	{
+		const uint64 nodeKey = MakeAbstractNodeKey(inZoneSlot, inLocalNode);
+		int32 toNode = INDEX_NONE;
+		if (const int32* toNodePtr = searchNodeLookup.Find(nodeKey))
+		{
+			toNode = *toNodePtr;
+		}
+		else
+		{
+			toNode = searchNodes.Add({ inZoneSlot, inLocalNode, MAX_flt, INDEX_NONE, false });
+			searchNodeLookup.Add(nodeKey, toNode);
+		}
+		RelaxEdge(inFromNode, toNode, inCost);
+	};
+
+	bool bFound = false;
+	while (openHeap.Num() > 0)
+	{
+		FAbstractOpenEntry current;
+		openHeap.HeapPop(current, openPredicate, EAllowShrinking::No);
+
+		if (searchNodes[current.nodeIndex].bClosed)
+		{
+			continue;
+		}
+		searchNodes[current.nodeIndex].bClosed = true;
+
+		if (current.nodeIndex == goalNode)
+		{
+			bFound = true;
+			break;
+		}
+
+		if (current.nodeIndex == startNode)
+		{
+			for (const FZonePathAbstractEdge& edge : startEdges)
+			{
+				RelaxAbstractEdge(startNode, startSlot, edge.targetNode, edge.cost);
+			}
+			if (directCost < MAX_flt)
+			{
+				RelaxEdge(startNode, goalNode, directCost);
+			}
+			continue;
+		}
+
+		// 노드 배열이 늘어날 수 있으므로 값으로 복사
+		const int32 zoneSlot = searchNodes[current.nodeIndex].zoneSlot;
+		const int32 localNode = searchNodes[current.nodeIndex].localNode;
+
+		for (const FZonePathAbstractEdge& edge : slotGraphs[zoneSlot]->GetNodes()[localNode].edges)
+		{
+			RelaxAbstractEdge(current.nodeIndex, zoneSlot, edge.targetNode, edge.cost);
+		}
+
+		if (zoneSlot == goalSlot)
+		{
+			if (const float* goalCostPtr = goalCosts.Find(localNode))
+			{
+				RelaxEdge(current.nodeIndex, goalNode, *goalCostPtr);
+			}
+		}
+
+		if (const TArray<FLinkEdge>* nodeLinkEdges = linkEdges.Find(MakeAbstractNodeKey(zoneSlot, localNode)))
+		{
+			for (const FLinkEdge& edge : *nodeLinkEdges)
+			{
+				RelaxAbstractEdge(current.nodeIndex, edge.targetSlot, edge.targetNode, edge.cost);
+			}
+		}
+	}
+
+	if (!bFound)
+	{
+		return false;
+	}
+
+	// 목표에서 역추적하여 경유점 구성 (시작/목표가 앵커와 겹치면 중복 제거)
+	TArray<int32> routeNodes;
+	for (int32 nodeIndex = goalNode; nodeIndex != INDEX_NONE; nodeIndex = searchNodes[nodeIndex].parentNode)
+	{
+		routeNodes.Add(nodeIndex);
+	}
+	Algo::Reverse(routeNodes);
+
+	for (int32 nodeIndex : routeNodes)
+	{
+		FZonePathHierarchyWaypoint waypoint;
+		waypoint.zoneIdentifier = slotZones[searchNodes[nodeIndex].zoneSlot];
+		waypoint.gridPosition = GetNodeGridPosition(nodeIndex);
+		waypoint.worldPosition = GetNodeWorldPosition(nodeIndex);
+
+		if (outRoute.waypoints.Num() > 0)
+		{
+			const FZonePathHierarchyWaypoint& previous = outRoute.waypoints.Last();
+			if (previous.zoneIdentifier == waypoint.zoneIdentifier && previous.gridPosition == waypoint.gridPosition)
+			{
+				continue;
+			}
+		}
+		outRoute.waypoints.Add(waypoint);
+	}
+
+	outRoute.totalCost = searchNodes[goalNode].gScore;
+	return true;
+}
+
+bool FZonePathHierarchy::RefineSegment(const FZonePathHierarchyRoute& inRoute, int32 inSegmentIndex, TArray<FIntVector>& outCells) const
+{
+	outCells.Reset();
+
+	if (inSegmentIndex < 0 || inSegmentIndex >= inRoute.GetSegmentCount())
+	{
+		return false;
+	}
+
+	// 존 전환 구간은 셀 경로 없음
+	if (inRoute.IsZoneTransition(inSegmentIndex))
+	{
+		return true;
+	}
+
+	const FZonePathHierarchyWaypoint& fromWaypoint = inRoute.waypoints[inSegmentIndex];
+	const FZonePathHierarchyWaypoint& toWaypoint = inRoute.waypoints[inSegmentIndex + 1];
+
+	const FZonePathClusterGraphPtr graph = FindZoneGraph(fromWaypoint.zoneIdentifier);
+	if (!graph.IsValid())
+	{
+		return false;
+	}
+
+	float segmentCost = 0.0f;
+	return graph->RefineEdge(fromWaypoint.gridPosition, toWaypoint.gridPosition, outCells, segmentCost);
+}
@@ -0,0 +1,443 @@
+#include "Zone/ZonePathIncrementalPlanner.h"
+
+namespace
+{
+	/**
+	* @Brief Admissible distance estimate in cells between two grid positions
+	* @inFrom          : FIntVector - Source position
+	* @inTo            : FIntVector - Target position
+	* @bAllowDiagonal  : bool       - Whether diagonal steps are available
+	* @Return          : float      - Lower bound on step length between the positions
+	*/
+	FORCEINLINE float EstimateDistance(const FIntVector& inFrom, const FIntVector& inTo, bool bAllowDiagonal)
+	{
+		const FIntVector delta = inTo - inFrom;
+		if (bAllowDiagonal)
+		{
+			return FMath::Sqrt(static_cast<float>(delta.X * delta.X + delta.Y * delta.Y + delta.Z * delta.Z));
+		}
+		return static_cast<float>(FMath::Abs(delta.X) + FMath::Abs(delta.Y) + FMath::Abs(delta.Z));
+	}
+}
+
+FZonePathIncrementalPlanner::FZonePathIncrementalPlanner(UZonePathScoreCache* inCache, const FIntVector& inStart, const FIntVector& inGoal)
+	: cache(inCache)
+	, heuristicScale(1.0f)
+	, startPosition(inStart)
+	, lastStartPosition(inStart)
+	, goalPosition(inGoal)
+	, goalIndex(INDEX_NONE)
+	, keyModifier(0.0f)
+	, notifiedVersion(0)
+	, bResetRequired(true)
+	, bSearchIncomplete(false)
+	, lastExpansionCount(0)
+	, bLastReplanFull(false)
+{
+	check(inCache);
+	searchParams = FZonePathSearchParams(inCache->GetPathSettings());
+	gridChangedHandle = inCache->OnZonePathGridChangedNative.AddRaw(this, &FZonePathIncrementalPlanner::HandleGridChanged);
+}
+
+FZonePathIncrementalPlanner::~FZonePathIncrementalPlanner()
+{
+	if (UZonePathScoreCache* cachePtr = cache.Get())
+	{
+		cachePtr->OnZonePathGridChangedNative.Remove(gridChangedHandle);
+	}
+}
+
+void FZonePathIncrementalPlanner::SetStart(const FIntVector& inStart)
+{
+	startPosition = inStart;
+}
+
+void FZonePathIncrementalPlanner::SetGoal(const FIntVector& inGoal)
+{
+	if (inGoal == goalPosition)
+	{
+		return;
+	}
+
+	goalPosition = inGoal;
+	FScopeLock Lock(&changeMutex);
+	bResetRequired = true;
+}
+
+void FZonePathIncrementalPlanner::SetSearchParams(const FZonePathSearchParams& inParams)
+{
+	searchParams = inParams;
+	FScopeLock Lock(&changeMutex);
+	bResetRequired = true;
+}
+
+bool FZonePathIncrementalPlanner::NeedsReplan() const
+{
+	const UZonePathScoreCache* cachePtr = cache.Get();
+	if (!cachePtr)
+	{
+		return false;
+	}
+
+	FScopeLock Lock(&changeMutex);
+	return bResetRequired || bSearchIncomplete || pendingChangedCells.Num() > 0
+		|| startPosition != lastStartPosition || cachePtr->GetSnapshotVersion() != notifiedVersion;
+}
+
+void FZonePathIncrementalPlanner::HandleGridChanged(const FZonePathGridChange& inChange)
+{
+	FScopeLock Lock(&changeMutex);
+
+	// 재계획 시점에 이미 읽은 스냅샷에 포함된 변경
+	if (inChange.snapshotVersion <= notifiedVersion)
+	{
+		return;
+	}
+
+	// 이벤트 없이 게시된 버전(재생성/로드 등)이 끼어 있으면 변경 범위를 알 수 없으므로 재시작
+	if (inChange.previousSnapshotVersion != notifiedVersion)
+	{
+		bResetRequired = true;
+	}
+	else
+	{
+		pendingChangedCells.Append(inChange.changedCells);
+	}
+
+	// 목표 셀이 바뀌면 목표 가능 여부와 시드가 달라지므로 재시작 (막혀 있던 목표가 열리는 경우 포함)
+	if (inChange.changedCells.Contains(goalPosition))
+	{
+		bResetRequired = true;
+	}
+	notifiedVersion = inChange.snapshotVersion;
+}
+
+bool FZonePathIncrementalPlanner::Replan(TArray<FIntVector>& outPath, float& outPathCost)
+{
+	outPath.Reset();
+	outPathCost = 0.0f;
+	lastExpansionCount = 0;
+
+	UZonePathScoreCache* cachePtr = cache.Get();
+	if (!cachePtr)
+	{
+		return false;
+	}
+
+	uint32 snapshotVersion = 0;
+	FZonePathGridSnapshotPtr snapshot = cachePtr->GetGridSnapshot(snapshotVersion);
+	if (!snapshot.IsValid() || !snapshot->bIsGenerated)
+	{
+		return false;
+	}
+
+	TSet<FIntVector> changedCells;
+	bool bReset = false;
+	{
+		FScopeLock Lock(&changeMutex);
+
+		// 휴리스틱은 탐색 시작 시점의 최소 비용 기준이므로 더 싼 셀이 생기면 허용성 유지를 위해 재시작
+		// 목표가 막혀 시드가 없던 탐색은 증분으로 회복할 수 없으므로 매번 재시작
+		bReset = bResetRequired || !grid.IsValid() || goalIndex == INDEX_NONE || snapshotVersion != notifiedVersion
+			|| snapshot->gridDimensions != grid->gridDimensions || snapshot->GetMinMovementCost() < heuristicScale;
+		changedCells = MoveTemp(pendingChangedCells);
+		pendingChangedCells.Reset();
+		notifiedVersion = snapshotVersion;
+		bResetRequired = false;
+	}
+
+	bLastReplanFull = bReset;
+	if (bReset)
+	{
+		ResetSearch(MoveTemp(snapshot));
+	}
+	else
+	{
+		grid = MoveTemp(snapshot);
+
+		// 시작점 이동은 키 보정값(km)으로 흡수하여 큐를 다시 정렬하지 않음
+		if (startPosition != lastStartPosition)
+		{
+			keyModifier += EstimateDistance(lastStartPosition, startPosition, searchParams.bAllowDiagonal) * heuristicScale;
+
+			// 막힌 셀은 시작점일 때만 떠날 수 있으므로 이전/새 시작점의 비용을 다시 계산
+			for (const FIntVector& movedStart : { lastStartPosition, startPosition })
+			{
+				const int32 movedStartIndex = grid->GetNodeIndex(movedStart);
+				if (movedStartIndex != INDEX_NONE && searchParams.IsInsideBounds(movedStart))
+				{
+					UpdateVertex(movedStartIndex);
+				}
+			}
+			lastStartPosition = startPosition;
+		}
+
+		// 비용은 진입하는 셀 기준이므로 변경 셀로 들어오는 이웃만 다시 평가 (변경 셀 자신은 통과 가능 여부만 반영)
+		for (const FIntVector& changedCell : changedCells)
+		{
+			const int32 changedIndex = grid->GetNodeIndex(changedCell);
+			if (changedIndex == INDEX_NONE)
+			{
+				continue;
+			}
+
+			if (searchParams.IsInsideBounds(changedCell))
+			{
+				UpdateVertex(changedIndex);
+			}
+
+			neighborVisitor->VisitNeighborsBy(changedCell, changedIndex,
+				[this](int32 inDirection, const FIntVector& inNeighborPos, int32 inNeighborIndex)
+			{
+				if (searchParams.IsInsideBounds(inNeighborPos))
+				{
+					UpdateVertex(inNeighborIndex);
+				}
+			});
+		}
+	}
+
+	bSearchIncomplete = !ComputeShortestPath();
+	if (bSearchIncomplete)
+	{
+		return false;
+	}
+	return ExtractPath(outPath, outPathCost);
+}
+
+void FZonePathIncrementalPlanner::ResetSearch(FZonePathGridSnapshotPtr inGrid)
+{
+	grid = MoveTemp(inGrid);
+	neighborVisitor.Emplace(grid->gridDimensions,
+		FZonePathNeighborVisitor::MakeDirectionMask(searchParams.bAllowDiagonal, searchParams.bAllowVertical));
+	heuristicScale = grid->GetMinMovementCost();
+	keyModifier = 0.0f;
+	lastStartPosition = startPosition;
+
+	const int32 cellCount = static_cast<int32>(grid->GetCellCount());
+	gValues.Init(MAX_flt, cellCount);
+	rhsValues.Init(MAX_flt, cellCount);
+	queuedKeys.SetNumUninitialized(cellCount);
+	queuedFlags.Init(false, cellCount);
+	openHeap.Reset();
+
+	// 목표에 진입할 수 없으면 어떤 셀도 비용이 정해지지 않음 (FindPathAStar와 동일한 실패 조건)
+	goalIndex = grid->GetNodeIndex(goalPosition);
+	if (goalIndex == INDEX_NONE || !searchParams.IsInsideBounds(goalPosition)
+		|| grid->IsBlockedAtIndex(goalIndex) || grid->GetMovementCostAtIndex(goalIndex) <= 0.0f)
+	{
+		goalIndex = INDEX_NONE;
+		return;
+	}
+
+	rhsValues[goalIndex] = 0.0f;
+	UpdateQueue(goalIndex);
+}
+
+FZonePathIncrementalPlanner::FQueueKey FZonePathIncrementalPlanner::CalculateKey(int32 inIndex) const
+{
+	const float minValue = FMath::Min(gValues[inIndex], rhsValues[inIndex]);
+	if (minValue == MAX_flt)
+	{
+		return { MAX_flt, MAX_flt };
+	}
+	return { minValue + EstimateFromStart(inIndex) + keyModifier, minValue };
+}
+
+float FZonePathIncrementalPlanner::EstimateFromStart(int32 inIndex) const
+{
+	return EstimateDistance(startPosition, grid->GetGridPosition(inIndex), searchParams.bAllowDiagonal) * heuristicScale;
+}
+
+float FZonePathIncrementalPlanner::GetStepCost(int32 inDirection, const FIntVector& inToPos, int32 inToIndex) const
+{
+	if (!searchParams.IsInsideBounds(inToPos) || grid->IsBlockedAtIndex(inToIndex))
+	{
+		return MAX_flt;
+	}
+
+	const float movementCost = grid->GetMovementCostAtIndex(inToIndex);
+	return movementCost > 0.0f ? FZonePathNeighborVisitor::GetStepLength(inDirection) * movementCost : MAX_flt;
+}
+
+void FZonePathIncrementalPlanner::UpdateVertex(int32 inIndex)
+{
+	if (inIndex != goalIndex)
+	{
+		float bestCost = MAX_flt;
+		neighborVisitor->VisitNeighborsBy(grid->GetGridPosition(inIndex), inIndex,
+			[&](int32 inDirection, const FIntVector& inNeighborPos, int32 inNeighborIndex)
+		{
+			if (gValues[inNeighborIndex] == MAX_flt)
+			{
+				return;
+			}
+
+			const float stepCost = GetStepCost(inDirection, inNeighborPos, inNeighborIndex);
+			if (stepCost != MAX_flt)
+			{
+				bestCost = FMath::Min(bestCost, stepCost + gValues[inNeighborIndex]);
+			}
+		});
+
+		// 막힌 셀에서는 출발할 수 없으므로 비용을 갖지 않음 (시작점은 막혀도 떠날 수 있음)
+		rhsValues[inIndex] = CanLeaveAtIndex(inIndex) ? bestCost : MAX_flt;
+	}
+	UpdateQueue(inIndex);
+}
+
+void FZonePathIncrementalPlanner::UpdateQueue(int32 inIndex)
+{
+	if (gValues[inIndex] == rhsValues[inIndex])
+	{
+		queuedFlags[inIndex] = false;
+		return;
+	}
+
+	const FQueueKey key = CalculateKey(inIndex);
+	if (queuedFlags[inIndex] && queuedKeys[inIndex] == key)
+	{
+		return;
+	}
+
+	// 이전 항목은 키 불일치로 꺼낼 때 버려짐
+	queuedKeys[inIndex] = key;
+	queuedFlags[inIndex] = true;
+	openHeap.HeapPush({ key, inIndex }, FQueuePredicate());
+}
+
+bool FZonePathIncrementalPlanner::ComputeShortestPath()
+{
+	const int32 startIndex = grid->GetNodeIndex(startPosition);
+	if (startIndex == INDEX_NONE || goalIndex == INDEX_NONE)
+	{
+		return true;
+	}
+
+	const FQueuePredicate queuePredicate;
+	while (true)
+	{
+		while (openHeap.Num() > 0
+			&& (!queuedFlags[openHeap.HeapTop().cellIndex] || !(openHeap.HeapTop().key == queuedKeys[openHeap.HeapTop().cellIndex])))
+		{
+			openHeap.HeapPopDiscard(queuePredicate, EAllowShrinking::No);
+		}
+
+		if (openHeap.Num() == 0
+			|| (!(openHeap.HeapTop().key < CalculateKey(startIndex)) && gValues[startIndex] == rhsValues[startIndex]))
+		{
+			return true;
+		}
+
+		if (++lastExpansionCount > searchParams.maxExpansions && searchParams.maxExpansions > 0)
+		{
+			return false;
+		}
+
+		FQueueEntry top;
+		openHeap.HeapPop(top, queuePredicate, EAllowShrinking::No);
+		const int32 currentIndex = top.cellIndex;
+
+		// 시작점 이동으로 키가 커졌으면 새 키로 다시 넣음
+		const FQueueKey currentKey = CalculateKey(currentIndex);
+		if (top.key < currentKey)
+		{
+			queuedKeys[currentIndex] = currentKey;
+			openHeap.HeapPush({ currentKey, currentIndex }, queuePredicate);
+			continue;
+		}
+		queuedFlags[currentIndex] = false;
+
+		const FIntVector currentPos = grid->GetGridPosition(currentIndex);
+		if (gValues[currentIndex] > rhsValues[currentIndex])
+		{
+			// 과대 추정(비용 감소): 값을 확정하고 이 셀로 들어오는 이웃의 rhs만 낮춤
+			gValues[currentIndex] = rhsValues[currentIndex];
+			neighborVisitor->VisitNeighborsBy(currentPos, currentIndex,
+				[&](int32 inDirection, const FIntVector& inNeighborPos, int32 inNeighborIndex)
+			{
+				// 떠날 수 없는 선행 셀(시작점이 아닌 막힌 셀)에는 비용을 전파하지 않음
+				if (inNeighborIndex == goalIndex || !searchParams.IsInsideBounds(inNeighborPos) || !CanLeaveAtIndex(inNeighborIndex))
+				{
+					return;
+				}
+
+				const float stepCost = GetStepCost(inDirection, currentPos, currentIndex);
+				if (stepCost != MAX_flt && stepCost + gValues[currentIndex] < rhsValues[inNeighborIndex])
+				{
+					rhsValues[inNeighborIndex] = stepCost + gValues[currentIndex];
+					UpdateQueue(inNeighborIndex);
+				}
+			});
+		}
+		else
+		{
+			// 과소 추정(비용 증가/차단): 값을 무효화하고 자신과 이웃을 다시 평가
+			gValues[currentIndex] = MAX_flt;
+			UpdateVertex(currentIndex);
+			neighborVisitor->VisitNeighborsBy(currentPos, currentIndex,
+				[this](int32 inDirection, const FIntVector& inNeighborPos, int32 inNeighborIndex)
+			{
+				if (searchParams.IsInsideBounds(inNeighborPos))
+				{
+					UpdateVertex(inNeighborIndex);
+				}
+			});
+		}
+	}
+}
+
+bool FZonePathIncrementalPlanner::ExtractPath(TArray<FIntVector>& outPath, float& outPathCost) const
+{
+	const int32 startIndex = grid->GetNodeIndex(startPosition);
+	if (startIndex == INDEX_NONE || goalIndex == INDEX_NONE || !searchParams.IsInsideBounds(startPosition)
+		|| gValues[startIndex] == MAX_flt)
+	{
+		return false;
+	}
+
+	// 일관 상태에서는 후속 셀 중 (단계 비용 + g) 최소를 따라가면 최단 경로
+	const int32 maxSteps = static_cast<int32>(grid->GetCellCount());
+	int32 currentIndex = startIndex;
+	FIntVector currentPos = startPosition;
+	outPath.Add(currentPos);
+
+	while (currentIndex != goalIndex)
+	{
+		int32 nextIndex = INDEX_NONE;
+		FIntVector nextPos = FIntVector::ZeroValue;
+		float bestCost = MAX_flt;
+		float bestStepCost = 0.0f;
+
+		neighborVisitor->VisitNeighborsBy(currentPos, currentIndex,
+			[&](int32 inDirection, const FIntVector& inNeighborPos, int32 inNeighborIndex)
+		{
+			if (gValues[inNeighborIndex] == MAX_flt)
+			{
+				return;
+			}
+
+			const float stepCost = GetStepCost(inDirection, inNeighborPos, inNeighborIndex);
+			if (stepCost != MAX_flt && stepCost + gValues[inNeighborIndex] < bestCost)
+			{
+				bestCost = stepCost + gValues[inNeighborIndex];
+				bestStepCost = stepCost;
+				nextIndex = inNeighborIndex;
+				nextPos = inNeighborPos;
+			}
+		});
+
+		if (nextIndex == INDEX_NONE || outPath.Num() > maxSteps)
+		{
+			outPath.Reset();
+			outPathCost = 0.0f;
+			return false;
+		}
+
+		outPathCost += bestStepCost;
+		currentIndex = nextIndex;
+		currentPos = nextPos;
+		outPath.Add(currentPos);
+	}
+	return true;
+}
@@ -0,0 +1,106 @@
+#include "Zone/ZonePathNeighbors.h"
+
+const FIntVector FZonePathNeighborVisitor::directionOffsets[FZonePathNeighborVisitor::DIRECTION_COUNT] = {
+	FIntVector(1, 0, 0), FIntVector(-1, 0, 0),
+	FIntVector(0, 1, 0), FIntVector(0, -1, 0),
+	FIntVector(0, 0, 1), FIntVector(0, 0, -1),
+	FIntVector(1, 1, 0), FIntVector(1, -1, 0),
+	FIntVector(-1, 1, 0), FIntVector(-1, -1, 0),
+	FIntVector(1, 0, 1), FIntVector(1, 0, -1),
+	FIntVector(-1, 0, 1), FIntVector(-1, 0, -1),
+	FIntVector(0, 1, 1), FIntVector(0, 1, -1),
+	FIntVector(0, -1, 1), FIntVector(0, -1, -1)
+};
+
+namespace
+{
+	/**
+	* @Brief Builds boundary-code to valid-direction mask table
+	* @Return : const uint32* - 64-entry table (bit0:-X edge, bit1:+X edge, bit2:-Y, bit3:+Y, bit4:-Z, bit5:+Z)
+	*/
+	const uint32* GetBoundaryDirectionTable()
+	{
+		static const struct FBoundaryDirectionTable
+		{
+			uint32 masks[64];
+
+			FBoundaryDirectionTable()
+			{
+				for (uint32 boundaryCode = 0; boundaryCode < 64; ++boundaryCode)
+				{
+					uint32 validMask = 0;
+					for (int32 direction = 0; direction < FZonePathNeighborVisitor::DIRECTION_COUNT; ++direction)
+					{
+						const FIntVector& offset = FZonePathNeighborVisitor::GetDirectionOffset(direction);
+
+						// 해당 축 경계에 있는 셀은 바깥 방향으로 이동 불가
+						uint32 forbiddenCode = 0;
+						forbiddenCode |= offset.X < 0 ? 1u : (offset.X > 0 ? 2u : 0u);
+						forbiddenCode |= offset.Y < 0 ? 4u : (offset.Y > 0 ? 8u : 0u);
+						forbiddenCode |= offset.Z < 0 ? 16u : (offset.Z > 0 ? 32u : 0u);
+
+						if ((forbiddenCode & boundaryCode) == 0)
+						{
+							validMask |= 1u << direction;
+						}
+					}
+					masks[boundaryCode] = validMask;
+				}
+			}
+		} boundaryTable;
+
+		return boundaryTable.masks;
+	}
+}
+
+FZonePathNeighborVisitor::FZonePathNeighborVisitor(const FIntVector& inGridDimensions, uint32 inDirectionMask)
+	: maxPosition(inGridDimensions - FIntVector(1, 1, 1))
+	, directionMask(inDirectionMask)
+	, boundaryDirectionMasks(GetBoundaryDirectionTable())
+{
+	const int32 layerSize = inGridDimensions.X * inGridDimensions.Y;
+	for (int32 direction = 0; direction < DIRECTION_COUNT; ++direction)
+	{
+		const FIntVector& offset = GetDirectionOffset(direction);
+		indexOffsets[direction] = offset.X + offset.Y * inGridDimensions.X + offset.Z * layerSize;
+	}
+}
+
+uint32 FZonePathNeighborVisitor::MakeDirectionMask(bool bIncludeDiagonals, bool bIncludeVertical)
+{
+	// 검색마다 호출되므로 4가지 조합을 한 번만 계산
+	static const struct FDirectionMaskTable
+	{
+		uint32 masks[4];
+
+		FDirectionMaskTable()
+		{
+			for (uint32 ruleCode = 0; ruleCode < 4; ++ruleCode)
+			{
+				uint32 resultMask = 0;
+				for (int32 direction = 0; direction < DIRECTION_COUNT; ++direction)
+				{
+					const FIntVector& offset = GetDirectionOffset(direction);
+					const bool bDiagonal = direction >= DIRECT_DIRECTION_COUNT;
+					if ((bDiagonal && (ruleCode & 1u) == 0) || (offset.Z != 0 && (ruleCode & 2u) == 0))
+					{
+						continue;
+					}
+					resultMask |= 1u << direction;
+				}
+				masks[ruleCode] = resultMask;
+			}
+		}
+	} maskTable;
+
+	return maskTable.masks[(bIncludeDiagonals ? 1u : 0u) | (bIncludeVertical ? 2u : 0u)];
+}
+
+void FZonePathNeighborVisitor::GetNeighbors(const FIntVector& inGridPos, FZonePathNeighborArray& outNeighbors) const
+{
+	outNeighbors.Reset();
+	VisitNeighborsBy(inGridPos, 0, [&outNeighbors](int32, const FIntVector& inNeighborPos, int32)
+	{
+		outNeighbors.Add(inNeighborPos);
+	});
+}
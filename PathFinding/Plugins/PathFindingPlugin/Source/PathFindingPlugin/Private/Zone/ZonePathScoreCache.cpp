@@ -1,17 +1,191 @@
 #include "Zone/ZonePathScoreCache.h"
+#include "Zone/ZonePathSearch.h"
+#include "Zone/ZonePathCacheFormat.h"
 
 #include "JsonObjectConverter.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonSerializer.h"
 #include "Engine/World.h"
 #include "Engine/Engine.h"
 #include "Components/StaticMeshComponent.h"
 #include "Misc/FileHelper.h"
 #include "HAL/PlatformFilemanager.h"
+#include "HAL/FileManager.h"
 #include "TimerManager.h"
+#include "Async/Async.h"
+#include "Misc/ScopeRWLock.h"
+#include "Async/ParallelFor.h"
+#include "Tasks/Task.h"
+
+namespace
+{
+	/** @Brief Independent output buffer of one collision bake slab */
+	struct FZonePathBakeSlab
+	{
+		/** @Brief Non-default nodes produced by the slab */
+		TArray<FPathNode> nodes;
+
+		/** @Brief Blocked node count (same counting rules as the serial bake) */
+		int32 blockedNodes = 0;
+
+		/** @Brief Sampled cells traced by the slab */
+		int32 checkedNodes = 0;
+	};
+
+	/**
+	* @Brief Picks a power-of-two cost quantization step covering a cost range
+	*
+	* Power-of-two steps keep the default cost 1.0 and its binary fractions exact,
+	* which is the common case for baked grids (multipliers of the default cost).
+	* The step is capped at 1.0 so the default cost always has its own code; costs
+	* beyond the covered range are kept exactly in the outlier table instead
+	* @inMaxCost : float - Largest cost to represent
+	* @Return    : float - Step so that FZonePathGrid::MAX_COST_CODE steps reach inMaxCost (at most 1.0)
+	*/
+	float ComputeCostQuantizationStep(float inMaxCost)
+	{
+		const float requiredStep = FMath::Max(inMaxCost, 1.0f) / FZonePathGrid::MAX_COST_CODE;
+		return FMath::Min(FMath::Pow(2.0f, static_cast<float>(FMath::CeilToInt(FMath::Log2(requiredStep)))), 1.0f);
+	}
+
+	/**
+	* @Brief Checks whether queries sharing a goal may be answered by one reverse search
+	*
+	* Without a per-query expansion limit the reverse search reaches exactly the starts
+	* FindPath reaches, at the same optimal cost. Under Jump Point Search the path may be
+	* a different equal-cost route, which is accepted. Limited searches keep one task per
+	* query, since the limit would bound the shared search instead of each query
+	* @inParams : FZonePathSearchParams - Search options of the batch
+	* @Return   : bool                  - True if goal groups may be coalesced
+	*/
+	FORCEINLINE bool CanCoalescePathQueries(const FZonePathSearchParams& inParams)
+	{
+		return inParams.maxExpansions <= 0;
+	}
+
+	/** @Brief Shared state of one in-flight path batch */
+	struct FZonePathBatchWork
+	{
+		/** @Brief Grid version every query of the batch is answered on */
+		FZonePathGridSnapshotPtr grid;
+
+		/** @Brief Search options of the submitting cache */
+		FZonePathSearchParams searchParams;
+
+		/** @Brief Submitted queries */
+		TArray<FZonePathQuery> queries;
+
+		/** @Brief Results in query order (each work unit writes only its own slots) */
+		TArray<FZonePathQueryResult> results;
+
+		/** @Brief Query indices per work unit (one coalesced goal group or a single query) */
+		TArray<TArray<int32, TInlineAllocator<1>>> workUnits;
+
+		/** @Brief Work units not finished yet */
+		std::atomic<int32> remainingUnits{ 0 };
+
+		/** @Brief Completion handler run by the last finishing unit */
+		TFunction<void(TArray<FZonePathQueryResult>&&)> onFinished;
+	};
+
+	/**
+	* @Brief Answers the queries of one work unit
+	* @inWork      : FZonePathBatchWork - Batch state
+	* @inUnitIndex : int32              - Work unit index
+	*/
+	void RunPathBatchUnit(FZonePathBatchWork& inWork, int32 inUnitIndex)
+	{
+		const TArray<int32, TInlineAllocator<1>>& queryIndices = inWork.workUnits[inUnitIndex];
+		const FZonePathGrid& grid = *inWork.grid;
+
+		if (queryIndices.Num() == 1)
+		{
+			const FZonePathQuery& query = inWork.queries[queryIndices[0]];
+			FZonePathQueryResult& result = inWork.results[queryIndices[0]];
+			result.bSuccess = NZonePathSearch::FindPath(grid, inWork.searchParams,
+				query.startGridPosition, query.goalGridPosition, result.path, result.pathCost);
+			return;
+		}
+
+		// 같은 목표를 공유하는 묶음은 목표에서 역방향 탐색 한 번으로 처리
+		TArray<FIntVector, TInlineAllocator<16>> starts;
+		for (int32 queryIndex : queryIndices)
+		{
+			starts.Add(inWork.queries[queryIndex].startGridPosition);
+		}
+
+		TArray<TArray<FIntVector>> paths;
+		TArray<float> costs;
+		NZonePathSearch::FindPathsToGoal(grid, inWork.searchParams, inWork.queries[queryIndices[0]].goalGridPosition, starts, paths, costs);
+
+		for (int32 slot = 0; slot < queryIndices.Num(); ++slot)
+		{
+			FZonePathQueryResult& result = inWork.results[queryIndices[slot]];
+			result.bSuccess = costs[slot] != MAX_flt;
+			result.pathCost = result.bSuccess ? costs[slot] : 0.0f;
+			result.path = MoveTemp(paths[slot]);
+		}
+	}
+}
 
 UZonePathScoreCache::UZonePathScoreCache()
 {
 	bAutoSave = true;
 	autoSaveInterval = 300.0f; // 5분/*modify_250921_: 자동 저장 간격을 5분으로 설정*/
+	deltaCompactionRecordLimit = 4096;
+	generationNextRow = 0;
+	generationBlockedNodes = 0;
+	generationCheckedNodes = 0;
+	generationLastPublishTime = 0.0;
+	pathBatchDeliveryBudgetMicroseconds = 1000.0f;
+	pathBatchCompletions = MakeShared<FZonePathBatchCompletionQueue, ESPMode::ThreadSafe>();
+	nextPathBatchID = 0;
+	bFullSaveRequired = true;
+	baseFileChecksum = 0;
+	deltaRecordCount = 0;
+	levelContentHash = 0;
+}
+
+void UZonePathScoreCache::BeginDestroy()
+{
+	CancelGeneration();
+
+	// 진행 중인 배치 작업은 공유 큐만 참조하므로 전달만 중단
+	if (pathBatchTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(pathBatchTickerHandle);
+		pathBatchTickerHandle.Reset();
+	}
+	pendingPathBatchCallbacks.Reset();
+
+	// 저장 작업은 스냅샷만 참조하므로 완료 확인만 중단
+	if (saveCompletionTickerHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(saveCompletionTickerHandle);
+		saveCompletionTickerHandle.Reset();
+	}
+
+	{
+		// 지연 게시 틱은 워커 스레드의 갱신에서도 등록되므로 락 안에서 해제
+		FScopeLock Lock(&pathGridMutex);
+		if (snapshotPublishTickerHandle.IsValid())
+		{
+			FTSTicker::GetCoreTicker().RemoveTicker(snapshotPublishTickerHandle);
+			snapshotPublishTickerHandle.Reset();
+		}
+	}
+
+	// 백그라운드 저장은 대기하지 않음: 소멸 완료만 IsReadyForFinishDestroy에서 미룸
+	queuedSaveFilePath.Reset();
+
+	Super::BeginDestroy();
+}
+
+bool UZonePathScoreCache::IsReadyForFinishDestroy()
+{
+	// 작업자는 스냅샷만 참조하지만 파일 기록이 끝난 뒤 소멸되도록 보장
+	const bool bSaveFinished = !pendingSaveFuture.IsValid() || pendingSaveFuture.IsReady();
+	return Super::IsReadyForFinishDestroy() && bSaveFinished;
 }
 
 void UZonePathScoreCache::InitializeZoneCache(const FZoneLevelData& inZoneData)
@@ -23,6 +197,7 @@ void UZonePathScoreCache::InitializeZoneCache(const FZoneLevelData& inZoneData)
 	}
 
 	pathGrid.zoneIdentifier = inZoneData.zoneIdentifier;
+	pathSettings = inZoneData.pathSettings;
 	GeneratePathGrid(inZoneData);
 
 	// 자동 저장 타이머 설정
@@ -42,6 +217,8 @@ void UZonePathScoreCache::InitializeZoneCache(const FZoneLevelData& inZoneData)
 
 void UZonePathScoreCache::GeneratePathGrid(const FZoneLevelData& inZoneData)
 {
+	CancelGeneration();/*modify_261016_: 진행 중인 분할 생성이 있으면 중단 후 즉시 생성*/
+
 	FScopeLock Lock(&pathGridMutex);
 
 	if (!inZoneData.IsValid())
@@ -49,142 +226,1253 @@ void UZonePathScoreCache::GeneratePathGrid(const FZoneLevelData& inZoneData)
 		return;
 	}
 
-	pathGrid.InitializeGrid(inZoneData.zoneBounds, inZoneData.pathSettings.gridCellSize);
-
+	BeginGenerationLocked(inZoneData);
 	PerformCollisionCheck(inZoneData);
-	SetupConnectionPoints(inZoneData);
+	FinishGenerationLocked(inZoneData);
 
 	UE_LOG(LogTemp, Log, TEXT("Path grid generated: %dx%dx%d cells for zone %s"),
 		pathGrid.gridDimensions.X, pathGrid.gridDimensions.Y, pathGrid.gridDimensions.Z,
 		*inZoneData.zoneIdentifier.ToString());
 }
 
-void UZonePathScoreCache::UpdatePathNode(const FIntVector& inGridPosition, float inNewCost, bool bBlocked)
+void UZonePathScoreCache::BeginTimeSlicedGeneration(const FZoneLevelData& inZoneData)
 {
-	FScopeLock Lock(&pathGridMutex);
+	CancelGeneration();
 
-	if (!pathGrid.IsValidGridPosition(inGridPosition))
+	if (!inZoneData.IsValid() || !GetWorld())
 	{
 		return;
 	}
 
-	// 스파스 구조에서 노드 찾거나 생성
-	FPathNode* nodePtr = pathGrid.pathNodes.Find(inGridPosition);
-	if (!nodePtr)
 	{
-		// 새 노드 생성
-		FVector worldPos = pathGrid.GridToWorld(inGridPosition);
-		FPathNode newNode(worldPos, inGridPosition);
-		nodePtr = &pathGrid.pathNodes.Add(inGridPosition, newNode);
+		FScopeLock Lock(&pathGridMutex);
+		BeginGenerationLocked(inZoneData);
+
+		// 빈 그리드를 먼저 게시: 베이크 전 셀은 Unknown으로 조회됨
+		PublishSnapshotLocked();
 	}
 
-	nodePtr->movementCost = inNewCost;
-	nodePtr->bIsBlocked = bBlocked;
-	pathGrid.lastUpdateTime = FDateTime::Now();
+	generationZoneData = inZoneData;
+	generationNextRow = 0;
+	generationBlockedNodes = 0;
+	generationCheckedNodes = 0;
+	generationLastPublishTime = FPlatformTime::Seconds();
+	generationTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+		FTickerDelegate::CreateUObject(this, &UZonePathScoreCache::TickGeneration));
+
+	UE_LOG(LogTemp, Log, TEXT("Time-sliced path grid generation started for zone %s (%d rows, %.0f us/frame)"),
+		*inZoneData.zoneIdentifier.ToString(), pathGrid.GetBakeRowCount(), inZoneData.pathSettings.generationBudgetMicroseconds);
 }
 
-bool UZonePathScoreCache::GetPathNode(const FIntVector& inGridPosition, FPathNode& outPathNode) const
+void UZonePathScoreCache::CancelGeneration()
 {
-	FScopeLock Lock(&pathGridMutex);
-	return pathGrid.GetNode(inGridPosition, outPathNode);
+	if (!generationTickerHandle.IsValid())
+	{
+		return;
+	}
+
+	FTSTicker::GetCoreTicker().RemoveTicker(generationTickerHandle);
+	generationTickerHandle.Reset();
+
+	UE_LOG(LogTemp, Log, TEXT("Time-sliced path grid generation cancelled for zone %s at row %d"),
+		*generationZoneData.zoneIdentifier.ToString(), generationNextRow);
 }
 
-bool UZonePathScoreCache::IsNodeBlocked(const FIntVector& inGridPosition) const
+float UZonePathScoreCache::GetGenerationProgress() const
 {
-	FScopeLock Lock(&pathGridMutex);
+	if (IsGenerating())
+	{
+		const int32 rowCount = pathGrid.GetBakeRowCount();
+		return rowCount > 0 ? static_cast<float>(generationNextRow) / static_cast<float>(rowCount) : 0.0f;
+	}
+	return pathGrid.bIsGenerated ? 1.0f : 0.0f;
+}
+
+EZonePathQueryState UZonePathScoreCache::GetNodeQueryState(const FIntVector& inGridPosition) const
+{
+	FZonePathGridReadScope readScope(*this);
+	const FZonePathGrid* grid = readScope.Get();
 
-	if (!pathGrid.IsValidGridPosition(inGridPosition))
+	if (!grid)
 	{
-		return true;
+		return EZonePathQueryState::Unknown;
+	}
+	if (!grid->IsValidGridPosition(inGridPosition))
+	{
+		return EZonePathQueryState::Blocked;
+	}
+	if (!grid->IsCellBaked(inGridPosition))
+	{
+		return EZonePathQueryState::Unknown;
 	}
+	return grid->IsNodeBlockedAt(inGridPosition) ? EZonePathQueryState::Blocked : EZonePathQueryState::Open;
+}
+
+void UZonePathScoreCache::BeginGenerationLocked(const FZoneLevelData& inZoneData)
+{
+	pathSettings = inZoneData.pathSettings;
+	pathGrid.InitializeGrid(inZoneData.zoneBounds, inZoneData.pathSettings.gridCellSize, inZoneData.pathSettings.gridStorage);
+
+	// 스파스 그리드: 샘플링을 통해 필요한 노드만 검사하여 메모리 절약
+	pathGrid.bakeSampleStep = FMath::Max(1, pathGrid.gridDimensions.X / 50); // 적응적 샘플링
+	pathGrid.bakedRowCount = 0;
+	pathGrid.bIsGenerated = false;
+	levelContentHash = 0;
+	generationEditedCells.Reset();
+}
+
+void UZonePathScoreCache::FinishGenerationLocked(const FZoneLevelData& inZoneData)
+{
+	SetupConnectionPoints(inZoneData);
+
+	pathGrid.bakedRowCount = INDEX_NONE;
+	pathGrid.bIsGenerated = true;
+	generationEditedCells.Reset();
+	levelContentHash = NZonePathCacheFormat::ComputeLevelContentHash(inZoneData);
+
+	// 베이크 결과의 볼륨/점유율로 저장 방식 결정
+	pathGrid.ResolveStorage();
+	PublishSnapshotLocked();
+	MarkFullSaveRequiredLocked();
+}
 
-	if (const FPathNode* nodePtr = pathGrid.pathNodes.Find(inGridPosition))
+bool UZonePathScoreCache::TickGeneration(float inDeltaTime)
+{
+	const UWorld* world = GetWorld();
+	if (!world)
 	{
-		return nodePtr->bIsBlocked;
+		generationTickerHandle.Reset();
+		return false;
 	}
 
-	// 스파스 그리드에서 저장되지 않은 기본 노드는 차단되지 않음
+	FCollisionQueryParams queryParams;
+	queryParams.bTraceComplex = false;
+	queryParams.bReturnPhysicalMaterial = false;
+
+	// 예산 내에서 행 단위로 베이크 (행 경계에서만 중단하여 재개 지점을 단순하게 유지)
+	const int32 rowCount = pathGrid.GetBakeRowCount();
+	const double budgetSeconds = generationZoneData.pathSettings.generationBudgetMicroseconds * 1.0e-6;
+	const double sliceStartTime = FPlatformTime::Seconds();
+
+	TArray<FPathNode> sliceNodes;
+	while (generationNextRow < rowCount)
+	{
+		BakeRow(*world, generationZoneData, queryParams, generationNextRow, sliceNodes, generationBlockedNodes, generationCheckedNodes);
+		++generationNextRow;
+
+		if (FPlatformTime::Seconds() - sliceStartTime >= budgetSeconds)
+		{
+			break;
+		}
+	}
+
+	const bool bFinished = generationNextRow >= rowCount;
+	{
+		FScopeLock Lock(&pathGridMutex);
+		for (const FPathNode& node : sliceNodes)
+		{
+			// 베이크 전에 갱신된 셀은 갱신 결과를 유지
+			if (!generationEditedCells.Contains(node.gridPosition))
+			{
+				pathGrid.pathNodes.Add(node.gridPosition, node);
+			}
+		}
+		pathGrid.bakedRowCount = generationNextRow;
+
+		if (bFinished)
+		{
+			FinishGenerationLocked(generationZoneData);
+		}
+		else if (FPlatformTime::Seconds() - generationLastPublishTime >= GENERATION_PUBLISH_INTERVAL)
+		{
+			// 부분 결과 게시는 간격을 두어 그리드 복사 비용을 제한
+			PublishSnapshotLocked();
+			generationLastPublishTime = FPlatformTime::Seconds();
+		}
+	}
+
+	OnZonePathGenerationProgress.Broadcast(generationZoneData.zoneIdentifier, GetGenerationProgress());
+
+	if (!bFinished)
+	{
+		return true;
+	}
+
+	generationTickerHandle.Reset();
+	UE_LOG(LogTemp, Log, TEXT("Time-sliced path grid generated for zone %s: %d blocked nodes, %d stored nodes out of %d checked"),
+		*generationZoneData.zoneIdentifier.ToString(), generationBlockedNodes, pathGrid.GetStoredNodeCount(), generationCheckedNodes);/*modify_261016_: Compact 그리드는 pathNodes가 비어 있음*/
+	OnZonePathGenerationCompleted.Broadcast(generationZoneData.zoneIdentifier);
 	return false;
 }
 
+void UZonePathScoreCache::UpdatePathNode(const FIntVector& inGridPosition, float inNewCost, bool bBlocked)
+{
+	ApplyNodeUpdates(MakeArrayView(&inGridPosition, 1), inNewCost, bBlocked);/*modify_261016_: 일괄 갱신 경로와 공용화 (락/시간 기록/게시/변경 이벤트)*/
+}
+
+int32 UZonePathScoreCache::UpdatePathNodes(const TArray<FIntVector>& inGridPositions, float inNewCost, bool bBlocked)
+{
+	return ApplyNodeUpdates(inGridPositions, inNewCost, bBlocked);
+}
+
+int32 UZonePathScoreCache::UpdatePathNodesInBox(const FIntVector& inBoxMin, const FIntVector& inBoxMax, float inNewCost, bool bBlocked)
+{
+	// 셀 목록은 게시된 스냅샷의 형상으로 락 밖에서 구성 (그리드 크기가 그 사이 바뀌어도 적용 시 다시 검사됨)
+	const FZonePathGridSnapshotPtr snapshot = GetGridSnapshot();
+	if (!snapshot.IsValid())
+	{
+		return 0;
+	}
+
+	const FIntVector maxPosition = snapshot->gridDimensions - FIntVector(1, 1, 1);
+	const FIntVector boxMin = FIntVector(FMath::Max(inBoxMin.X, 0), FMath::Max(inBoxMin.Y, 0), FMath::Max(inBoxMin.Z, 0));
+	const FIntVector boxMax = FIntVector(FMath::Min(inBoxMax.X, maxPosition.X), FMath::Min(inBoxMax.Y, maxPosition.Y), FMath::Min(inBoxMax.Z, maxPosition.Z));
+	if (boxMin.X > boxMax.X || boxMin.Y > boxMax.Y || boxMin.Z > boxMax.Z)
+	{
+		return 0;
+	}
+
+	TArray<FIntVector> cells;
+	cells.Reserve((boxMax.X - boxMin.X + 1) * (boxMax.Y - boxMin.Y + 1) * (boxMax.Z - boxMin.Z + 1));
+	for (int32 z = boxMin.Z; z <= boxMax.Z; ++z)
+	{
+		for (int32 y = boxMin.Y; y <= boxMax.Y; ++y)
+		{
+			for (int32 x = boxMin.X; x <= boxMax.X; ++x)
+			{
+				cells.Add(FIntVector(x, y, z));
+			}
+		}
+	}
+	return ApplyNodeUpdates(cells, inNewCost, bBlocked);
+}
+
+int32 UZonePathScoreCache::UpdatePathNodesInSphere(const FVector& inWorldCenter, float inRadius, float inNewCost, bool bBlocked)
+{
+	// 작업 그리드는 락 없이 읽을 수 없으므로 게시된 스냅샷의 형상 사용
+	const FZonePathGridSnapshotPtr snapshot = GetGridSnapshot();
+	if (inRadius < 0.0f || !snapshot.IsValid() || snapshot->cellSize <= 0.0f)
+	{
+		return 0;
+	}
+
+	// 구를 감싸는 셀 상자를 그리드 범위로 잘라 훑고 셀 중심이 반경 안인 셀만 선택
+	const FIntVector centerCell = snapshot->WorldToGrid(inWorldCenter);
+	const int32 cellRadius = FMath::CeilToInt(inRadius / snapshot->cellSize);
+	const float radiusSquared = inRadius * inRadius;
+	const FIntVector maxPosition = snapshot->gridDimensions - FIntVector(1, 1, 1);
+	const FIntVector boxMin(FMath::Max(centerCell.X - cellRadius, 0), FMath::Max(centerCell.Y - cellRadius, 0), FMath::Max(centerCell.Z - cellRadius, 0));
+	const FIntVector boxMax(FMath::Min(centerCell.X + cellRadius, maxPosition.X), FMath::Min(centerCell.Y + cellRadius, maxPosition.Y), FMath::Min(centerCell.Z + cellRadius, maxPosition.Z));
+
+	TArray<FIntVector> cells;
+	for (int32 z = boxMin.Z; z <= boxMax.Z; ++z)
+	{
+		for (int32 y = boxMin.Y; y <= boxMax.Y; ++y)
+		{
+			for (int32 x = boxMin.X; x <= boxMax.X; ++x)
+			{
+				const FIntVector cell(x, y, z);
+				if (FVector::DistSquared(snapshot->GridToWorld(cell), inWorldCenter) <= radiusSquared)
+				{
+					cells.Add(cell);
+				}
+			}
+		}
+	}
+	return ApplyNodeUpdates(cells, inNewCost, bBlocked);
+}
+
+int32 UZonePathScoreCache::ApplyNodeUpdates(TConstArrayView<FIntVector> inGridPositions, float inNewCost, bool bBlocked)
+{
+	FZonePathGridChange change;
+	{
+		FScopeLock Lock(&pathGridMutex);
+
+		const uint32 previousVersion = snapshotVersion.load(std::memory_order_relaxed);
+
+		// 캐시된 필드가 있을 때만 셀 전후 상태를 모아 필드 영향 여부를 판단
+		const bool bTrackTransitions = flowFieldCache.Num() > 0;
+		TArray<FZonePathCellTransition> transitions;
+		transitions.Reserve(bTrackTransitions ? inGridPositions.Num() : 0);
+
+		change.changedCells.Reserve(inGridPositions.Num());
+		change.boundsMin = FIntVector(MAX_int32);
+		change.boundsMax = FIntVector(MIN_int32);
+		for (const FIntVector& gridPos : inGridPositions)
+		{
+			if (!pathGrid.IsValidGridPosition(gridPos))
+			{
+				continue;
+			}
+
+			const int32 nodeIndex = pathGrid.GetNodeIndex(gridPos);
+			FZonePathCellTransition transition;
+			if (bTrackTransitions)
+			{
+				transition.gridPos = gridPos;
+				transition.oldCost = pathGrid.GetMovementCostAtIndex(nodeIndex);
+				transition.bWasTraversable = !pathGrid.IsBlockedAtIndex(nodeIndex) && transition.oldCost > 0.0f;
+			}
+
+			pathGrid.SetNodeState(gridPos, inNewCost, bBlocked);
+			dirtyCellIndices.Add(nodeIndex);
+
+			if (bTrackTransitions)
+			{
+				transition.newCost = pathGrid.GetMovementCostAtIndex(nodeIndex);
+				transition.bIsTraversable = !pathGrid.IsBlockedAtIndex(nodeIndex) && transition.newCost > 0.0f;
+				transitions.Add(transition);
+			}
+			if (!pathGrid.IsCellBaked(gridPos))
+			{
+				// 분할 생성이 나중에 이 셀을 베이크해도 덮어쓰지 않도록 기록
+				generationEditedCells.Add(gridPos);
+			}
+			change.changedCells.Add(gridPos);
+			change.boundsMin = FIntVector(FMath::Min(change.boundsMin.X, gridPos.X), FMath::Min(change.boundsMin.Y, gridPos.Y), FMath::Min(change.boundsMin.Z, gridPos.Z));
+			change.boundsMax = FIntVector(FMath::Max(change.boundsMax.X, gridPos.X), FMath::Max(change.boundsMax.Y, gridPos.Y), FMath::Max(change.boundsMax.Z, gridPos.Z));
+		}
+
+		if (change.changedCells.Num() == 0)
+		{
+			return 0;
+		}
+
+		// 변경 셀 수와 무관하게 시간 기록은 한 번, 그리드 복사는 다음 읽기나 프레임 끝까지 미뤄 연속 갱신을 합침
+		pathGrid.lastUpdateTime = FDateTime::Now();
+		MarkSnapshotPublishPendingLocked();
+
+		RevalidateFlowFieldsLocked(transitions, previousVersion);
+
+		change.previousSnapshotVersion = previousVersion;
+		change.snapshotVersion = snapshotVersion.load(std::memory_order_relaxed);
+		AppendGridChangeLogLocked(change);/*modify_261016_: 증분 그래프 갱신용 변경 기록*/
+	}
+
+	// 구독자가 캐시를 다시 조회할 수 있도록 락 밖에서 전달 (구독/해제가 게임 스레드에서 일어나므로 호출도 게임 스레드로 한정)
+	const int32 changedCellCount = change.changedCells.Num();
+	if (IsInGameThread())
+	{
+		BroadcastGridChange(change);
+	}
+	else
+	{
+		TWeakObjectPtr<UZonePathScoreCache> weakThis(this);
+		AsyncTask(ENamedThreads::GameThread, [weakThis, change = MoveTemp(change)]()
+		{
+			if (UZonePathScoreCache* cache = weakThis.Get())
+			{
+				cache->BroadcastGridChange(change);
+			}
+		});
+	}
+	return changedCellCount;
+}
+
+void UZonePathScoreCache::BroadcastGridChange(const FZonePathGridChange& inChange)
+{
+	check(IsInGameThread());
+	OnZonePathGridChangedNative.Broadcast(inChange);
+	OnZonePathGridRegionChanged.Broadcast(inChange.boundsMin, inChange.boundsMax, inChange.changedCells.Num());
+}
+
+bool UZonePathScoreCache::GetPathNode(const FIntVector& inGridPosition, FPathNode& outPathNode) const
+{
+	/*modify_261016_: 뮤텍스 대신 게시된 스냅샷을 락 없이 조회*/
+	FZonePathGridReadScope readScope(*this);
+	const FZonePathGrid* grid = readScope.Get();
+	return grid && grid->GetNode(inGridPosition, outPathNode);
+}
+
+bool UZonePathScoreCache::IsNodeBlocked(const FIntVector& inGridPosition) const
+{
+	/*modify_261016_: 뮤텍스 대신 게시된 스냅샷을 락 없이 조회*/
+	FZonePathGridReadScope readScope(*this);
+	const FZonePathGrid* grid = readScope.Get();
+
+	// 분할 생성 중 아직 베이크되지 않은 셀은 열린 것으로 보이지 않도록 차단으로 보고
+	return !grid || grid->IsNodeBlockedAt(inGridPosition)
+		|| !grid->IsCellBaked(inGridPosition);/*modify_261016_: 미베이크 셀은 차단으로 취급*/
+}
+
 float UZonePathScoreCache::GetMovementCost(const FIntVector& inGridPosition) const
 {
-	FScopeLock Lock(&pathGridMutex);
+	/*modify_261016_: 뮤텍스 대신 게시된 스냅샷을 락 없이 조회*/
+	FZonePathGridReadScope readScope(*this);
+	const FZonePathGrid* grid = readScope.Get();
+	if (grid && grid->IsValidGridPosition(inGridPosition) && !grid->IsCellBaked(inGridPosition))/*modify_261016_: 미베이크 셀은 차단으로 취급*/
+	{
+		// 분할 생성 중 아직 베이크되지 않은 셀은 차단과 같은 비용으로 보고
+		return FLT_MAX;
+	}
+	return grid ? grid->GetMovementCostAt(inGridPosition) : FLT_MAX;
+}
+
+TArray<FIntVector> UZonePathScoreCache::GetNeighborNodes(const FIntVector& inGridPosition, bool bIncludeDiagonals) const
+{
+	FZonePathGridReadScope readScope(*this);
+	const FZonePathGrid* grid = readScope.Get();
+	return grid ? grid->GetNeighbors(inGridPosition, bIncludeDiagonals) : TArray<FIntVector>();
+}
+
+bool UZonePathScoreCache::FindPath(const FIntVector& inStartGridPosition, const FIntVector& inGoalGridPosition, TArray<FIntVector>& outPath) const
+{
+	FZonePathGridReadScope readScope(*this);
+	const FZonePathGrid* grid = readScope.Get();
+
+	if (!grid || !grid->bIsGenerated)
+	{
+		outPath.Reset();
+		return false;
+	}
+
+	float pathCost = 0.0f;
+	return NZonePathSearch::FindPath(*grid, FZonePathSearchParams(pathSettings),
+		inStartGridPosition, inGoalGridPosition, outPath, pathCost);
+}
+
+bool UZonePathScoreCache::FindPathWorld(const FVector& inStartWorldPosition, const FVector& inGoalWorldPosition, TArray<FVector>& outWorldPath) const
+{
+	outWorldPath.Reset();
+
+	// 좌표 변환과 탐색이 같은 그리드 버전을 보도록 스냅샷 하나로 처리
+	FZonePathGridReadScope readScope(*this);
+	const FZonePathGrid* grid = readScope.Get();
+	if (!grid || !grid->bIsGenerated)
+	{
+		return false;
+	}
+
+	TArray<FIntVector> gridPath;
+	float pathCost = 0.0f;
+	if (!NZonePathSearch::FindPath(*grid, FZonePathSearchParams(pathSettings),
+		grid->WorldToGrid(inStartWorldPosition), grid->WorldToGrid(inGoalWorldPosition), gridPath, pathCost))
+	{
+		return false;
+	}
+
+	outWorldPath.Reserve(gridPath.Num());
+	for (const FIntVector& gridPos : gridPath)
+	{
+		outWorldPath.Add(grid->GridToWorld(gridPos));
+	}
+	return true;
+}
+
+int32 UZonePathScoreCache::SubmitPathBatch(const TArray<FZonePathQuery>& inQueries)
+{
+	return SubmitPathBatchWithCallback(inQueries, FOnZonePathBatchCompletedNative());
+}
+
+int32 UZonePathScoreCache::SubmitPathBatchWithCallback(const TArray<FZonePathQuery>& inQueries, FOnZonePathBatchCompletedNative inOnCompleted)
+{
+	check(IsInGameThread());
+
+	const int32 batchID = nextPathBatchID++;
+	pendingPathBatchCallbacks.Add(batchID, MoveTemp(inOnCompleted));
+
+	if (!pathBatchTickerHandle.IsValid())
+	{
+		pathBatchTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateUObject(this, &UZonePathScoreCache::TickPathBatches));
+	}
+
+	// 워커는 완료 결과를 큐에 넣기만 하고 전달은 게임 스레드 틱에서 예산 내 수행
+	TSharedPtr<FZonePathBatchCompletionQueue, ESPMode::ThreadSafe> completionQueue = pathBatchCompletions;
+	LaunchPathBatch(inQueries, [completionQueue, batchID](TArray<FZonePathQueryResult>&& inResults)
+	{
+		completionQueue->Enqueue({ batchID, MoveTemp(inResults) });
+	});
+	return batchID;
+}
+
+TFuture<TArray<FZonePathQueryResult>> UZonePathScoreCache::SubmitPathBatchAsync(const TArray<FZonePathQuery>& inQueries)
+{
+	TSharedRef<TPromise<TArray<FZonePathQueryResult>>, ESPMode::ThreadSafe> promise = MakeShared<TPromise<TArray<FZonePathQueryResult>>, ESPMode::ThreadSafe>();
+	TFuture<TArray<FZonePathQueryResult>> future = promise->GetFuture();
+
+	LaunchPathBatch(inQueries, [promise](TArray<FZonePathQueryResult>&& inResults)
+	{
+		promise->SetValue(MoveTemp(inResults));
+	});
+	return future;
+}
+
+void UZonePathScoreCache::LaunchPathBatch(const TArray<FZonePathQuery>& inQueries, TFunction<void(TArray<FZonePathQueryResult>&&)> inOnFinished) const
+{
+	TSharedRef<FZonePathBatchWork, ESPMode::ThreadSafe> work = MakeShared<FZonePathBatchWork, ESPMode::ThreadSafe>();
+	work->grid = GetGridSnapshot();
+	work->searchParams = FZonePathSearchParams(pathSettings);
+	work->queries = inQueries;
+	work->results.SetNum(inQueries.Num());
+	work->onFinished = MoveTemp(inOnFinished);
+
+	// 생성 전 그리드에서는 모든 질의가 실패
+	if (!work->grid.IsValid() || !work->grid->bIsGenerated || inQueries.Num() == 0)
+	{
+		work->onFinished(MoveTemp(work->results));
+		return;
+	}
+
+	// 목표별로 묶어 충분히 큰 묶음은 역방향 탐색 한 번으로 합침 (개별 탐색과 결과가 같을 때만)
+	const bool bCoalesce = CanCoalescePathQueries(work->searchParams);
+	TMap<FIntVector, TArray<int32, TInlineAllocator<1>>> goalGroups;
+	for (int32 queryIndex = 0; queryIndex < inQueries.Num(); ++queryIndex)
+	{
+		if (!bCoalesce)
+		{
+			work->workUnits.Add({ queryIndex });
+			continue;
+		}
+		goalGroups.FindOrAdd(inQueries[queryIndex].goalGridPosition).Add(queryIndex);
+	}
+
+	for (TPair<FIntVector, TArray<int32, TInlineAllocator<1>>>& groupPair : goalGroups)
+	{
+		if (groupPair.Value.Num() >= PATH_BATCH_COALESCE_MIN_QUERIES)
+		{
+			work->workUnits.Add(MoveTemp(groupPair.Value));
+			continue;
+		}
+
+		for (int32 queryIndex : groupPair.Value)
+		{
+			work->workUnits.Add({ queryIndex });
+		}
+	}
+
+	// 작업 단위마다 태스크 하나 (스케줄러의 워크 스틸링으로 워커 간 부하 분산)
+	work->remainingUnits.store(work->workUnits.Num(), std::memory_order_relaxed);
+	for (int32 unitIndex = 0; unitIndex < work->workUnits.Num(); ++unitIndex)
+	{
+		UE::Tasks::Launch(UE_SOURCE_LOCATION, [work, unitIndex]()
+		{
+			RunPathBatchUnit(*work, unitIndex);
+
+			if (work->remainingUnits.fetch_sub(1, std::memory_order_acq_rel) == 1)
+			{
+				work->onFinished(MoveTemp(work->results));
+			}
+		});
+	}
+}
+
+bool UZonePathScoreCache::TickPathBatches(float inDeltaTime)
+{
+	const double deadline = FPlatformTime::Seconds() + pathBatchDeliveryBudgetMicroseconds * 1.0e-6;
+
+	// 큰 배치도 한 프레임을 오래 점유하지 않도록 조각 단위로 전달하고 조각마다 예산 확인 (프레임당 최소 한 조각은 전달)
+	bool bDeliveredAny = false;
+	while (!bDeliveredAny || FPlatformTime::Seconds() < deadline)
+	{
+		if (!pathBatchDelivery.IsSet())
+		{
+			FZonePathBatchCompletion completion;
+			if (!pathBatchCompletions->Dequeue(completion))
+			{
+				break;
+			}
+			pathBatchDelivery.Emplace(MoveTemp(completion));
+		}
+		bDeliveredAny = true;
+
+		FZonePathBatchCompletion& delivery = pathBatchDelivery.GetValue();
+		const int32 batchID = delivery.batchID;
+		const int32 firstQueryIndex = delivery.deliveredCount;
+		const int32 sliceCount = FMath::Min(PATH_BATCH_DELIVERY_SLICE_QUERIES, delivery.results.Num() - firstQueryIndex);
+
+		TArray<FZonePathQueryResult> sliceResults;
+		sliceResults.Reserve(sliceCount);
+		for (int32 resultIndex = firstQueryIndex; resultIndex < firstQueryIndex + sliceCount; ++resultIndex)
+		{
+			sliceResults.Add(MoveTemp(delivery.results[resultIndex]));
+		}
+		delivery.deliveredCount += sliceCount;
+
+		// 마지막 조각이면 콜백 등록과 진행 중 배치를 먼저 정리 (콜백 안에서 새 배치를 제출해도 안전)
+		FOnZonePathBatchCompletedNative onCompleted;
+		if (delivery.deliveredCount >= delivery.results.Num())
+		{
+			pendingPathBatchCallbacks.RemoveAndCopyValue(batchID, onCompleted);
+			pathBatchDelivery.Reset();
+		}
+		else if (const FOnZonePathBatchCompletedNative* pendingCallback = pendingPathBatchCallbacks.Find(batchID))
+		{
+			onCompleted = *pendingCallback;
+		}
+
+		onCompleted.ExecuteIfBound(batchID, firstQueryIndex, sliceResults);
+		OnZonePathBatchCompleted.Broadcast(batchID, firstQueryIndex, sliceResults);
+	}
+
+	if (pendingPathBatchCallbacks.Num() > 0)
+	{
+		return true;
+	}
+
+	pathBatchTickerHandle.Reset();
+	return false;
+}
+
+FZonePathFlowFieldPtr UZonePathScoreCache::GetFlowField(const FIntVector& inGoalGridPosition, bool bWaitForBuild)
+{
+	TSharedFuture<FZonePathFlowFieldPtr> buildToWait;
+	{
+		FScopeLock Lock(&pathGridMutex);
+		FZonePathFlowFieldCacheEntry* entry = RefreshFlowFieldEntryLocked(inGoalGridPosition);
+		if (!entry)
+		{
+			return nullptr;
+		}
+
+		// 진행 중인 빌드가 없으면 필드는 현재 버전과 일치
+		if (!bWaitForBuild || !entry->pendingBuild.IsValid())
+		{
+			return entry->field;
+		}
+		buildToWait = entry->pendingBuild;
+	}
+
+	// 같은 목표로 이미 돌고 있는 빌드를 함께 기다림 (중복 빌드 없음)
+	buildToWait.Wait();
+
+	FScopeLock Lock(&pathGridMutex);
+	RefreshFlowFieldEntryLocked(inGoalGridPosition);
+	return buildToWait.Get();
+}
+
+FZonePathFlowFieldCacheEntry* UZonePathScoreCache::RefreshFlowFieldEntryLocked(const FIntVector& inGoalGridPosition)
+{
+	const uint32 currentVersion = snapshotVersion.load(std::memory_order_relaxed);
+	const double accessTime = FPlatformTime::Seconds();
+	FZonePathFlowFieldCacheEntry* entry = flowFieldCache.Find(inGoalGridPosition);
+
+	if (entry)
+	{
+		// 끝난 빌드를 반영 (빌드 중 그리드가 바뀌었으면 낡은 필드로 두고 아래에서 다시 빌드)
+		if (entry->pendingBuild.IsValid() && entry->pendingBuild.IsReady())
+		{
+			entry->field = entry->pendingBuild.Get();
+			entry->validSnapshotVersion = entry->pendingBuildVersion;
+			entry->pendingBuild = TSharedFuture<FZonePathFlowFieldPtr>();
+		}
+
+		entry->lastAccessTime = accessTime;
+		if (entry->pendingBuild.IsValid() || (entry->field.IsValid() && entry->validSnapshotVersion == currentVersion))
+		{
+			return entry;
+		}
+	}
+
+	// 빌드 버전과 스냅샷이 일치하도록 미뤄둔 갱신을 먼저 게시
+	PublishPendingSnapshotLocked();
+	const FZonePathGridSnapshotPtr snapshot = publishedSnapshot;
+	if (!snapshot.IsValid() || !snapshot->bIsGenerated)
+	{
+		return nullptr;
+	}
+
+	if (!entry)
+	{
+		// 새 목표를 넣기 전에 가장 오래 안 쓴 필드부터 제거 (진행 중인 빌드는 결과만 버려짐)
+		while (flowFieldCache.Num() >= MAX_CACHED_FLOW_FIELDS)
+		{
+			const FIntVector* oldestGoal = nullptr;
+			double oldestAccessTime = TNumericLimits<double>::Max();
+			for (const TPair<FIntVector, FZonePathFlowFieldCacheEntry>& entryPair : flowFieldCache)
+			{
+				if (entryPair.Value.lastAccessTime < oldestAccessTime)
+				{
+					oldestAccessTime = entryPair.Value.lastAccessTime;
+					oldestGoal = &entryPair.Key;
+				}
+			}
+			flowFieldCache.Remove(FIntVector(*oldestGoal));
+		}
+
+		entry = &flowFieldCache.Add(inGoalGridPosition);
+		entry->lastAccessTime = accessTime;
+	}
+
+	// 다익스트라는 워커에서 스냅샷으로 수행 (필드는 도달 가능한 전 영역을 덮어야 하므로 확장 제한 해제)
+	FZonePathSearchParams fieldParams(pathSettings);
+	fieldParams.maxExpansions = 0;
+
+	entry->pendingBuildVersion = currentVersion;
+	entry->pendingBuild = Async(EAsyncExecution::ThreadPool, [snapshot, fieldParams, goalGridPosition = inGoalGridPosition]() -> FZonePathFlowFieldPtr
+	{
+		const double buildStartTime = FPlatformTime::Seconds();
+		FZonePathFlowFieldPtr field = MakeShared<FZonePathFlowField, ESPMode::ThreadSafe>(*snapshot, fieldParams, goalGridPosition);
+
+		UE_LOG(LogTemp, Verbose, TEXT("Flow field built toward %s: %d reachable cells (%.2f ms)"),
+			*goalGridPosition.ToString(), field->GetReachedCellCount(), (FPlatformTime::Seconds() - buildStartTime) * 1000.0);
+		return field;
+	}).Share();
+	return entry;
+}
+
+FVector UZonePathScoreCache::SampleFlowDirection(const FIntVector& inGoalGridPosition, const FVector& inWorldPosition)
+{
+	// 빌드를 기다리지 않고 마지막 필드(낡았어도)로 샘플링
+	const FZonePathFlowFieldPtr field = GetFlowField(inGoalGridPosition);
+	return field.IsValid() ? field->SampleDirection(inWorldPosition) : FVector::ZeroVector;
+}
+
+int32 UZonePathScoreCache::GetCachedFlowFieldCount() const
+{
+	FScopeLock Lock(&pathGridMutex);
+	return flowFieldCache.Num();
+}
+
+void UZonePathScoreCache::RevalidateFlowFieldsLocked(TConstArrayView<FZonePathCellTransition> inTransitions, uint32 inPreviousVersion)
+{
+	const uint32 currentVersion = snapshotVersion.load(std::memory_order_relaxed);
+
+	for (TPair<FIntVector, FZonePathFlowFieldCacheEntry>& entryPair : flowFieldCache)
+	{
+		FZonePathFlowFieldCacheEntry& entry = entryPair.Value;
+
+		// 이전 버전과 일치하던 필드만 이어받을 수 있음 (낡은 필드는 계속 제공하고 다음 조회에서 재빌드)
+		if (!entry.field.IsValid() || entry.validSnapshotVersion != inPreviousVersion)
+		{
+			continue;
+		}
+
+		bool bAffected = false;
+		for (int32 transitionIndex = 0; transitionIndex < inTransitions.Num() && !bAffected; ++transitionIndex)
+		{
+			bAffected = entry.field->IsAffectedByCellChange(inTransitions[transitionIndex]);
+		}
+
+		if (!bAffected)
+		{
+			entry.validSnapshotVersion = currentVersion;
+		}
+	}
+}
+
+FIntVector UZonePathScoreCache::WorldToGridPosition(const FVector& inWorldPosition) const
+{
+	FZonePathGridReadScope readScope(*this);
+	if (const FZonePathGrid* grid = readScope.Get())
+	{
+		return grid->WorldToGrid(inWorldPosition);
+	}
+
+	// 첫 게시 전에는 초기화 중인 작업 그리드를 락 안에서 사용
+	FScopeLock Lock(&pathGridMutex);
+	return pathGrid.WorldToGrid(inWorldPosition);
+}
+
+FVector UZonePathScoreCache::GridToWorldPosition(const FIntVector& inGridPosition) const
+{
+	FZonePathGridReadScope readScope(*this);
+	if (const FZonePathGrid* grid = readScope.Get())
+	{
+		return grid->GridToWorld(inGridPosition);
+	}
+
+	FScopeLock Lock(&pathGridMutex);
+	return pathGrid.GridToWorld(inGridPosition);
+}
+
+FZonePathGridSnapshotPtr UZonePathScoreCache::GetGridSnapshot() const
+{
+	return AcquireSnapshot(true);
+}
+
+FZonePathGridSnapshotPtr UZonePathScoreCache::GetGridSnapshot(uint32& outSnapshotVersion) const
+{
+	FScopeLock Lock(&pathGridMutex);
+	PublishPendingSnapshotLocked();
+	outSnapshotVersion = snapshotVersion.load(std::memory_order_relaxed);
+	return publishedSnapshot;
+}
+
+bool UZonePathScoreCache::GetChangedCellsBetween(uint32 inSinceVersion, uint32 inUntilVersion, TArray<FIntVector>& outChangedCells) const
+{
+	outChangedCells.Reset();
+
+	FScopeLock Lock(&pathGridMutex);
+
+	// 기록된 변경이 since부터 until까지 빈틈없이 이어져야 함 (중간에 다른 게시가 있으면 버전이 건너뜀)
+	uint32 chainedVersion = inSinceVersion;
+	for (const FZonePathGridChange& change : gridChangeLog)
+	{
+		if (chainedVersion == inUntilVersion)
+		{
+			break;
+		}
+		if (change.snapshotVersion <= chainedVersion)
+		{
+			continue;
+		}
+		if (change.previousSnapshotVersion != chainedVersion)
+		{
+			return false;
+		}
+
+		outChangedCells.Append(change.changedCells);
+		chainedVersion = change.snapshotVersion;
+	}
+	return chainedVersion == inUntilVersion;
+}
+
+void UZonePathScoreCache::AppendGridChangeLogLocked(const FZonePathGridChange& inChange)
+{
+	gridChangeLog.Add(inChange);
+	gridChangeLogCellCount += inChange.changedCells.Num();
+
+	int32 dropCount = 0;
+	while (gridChangeLogCellCount > MAX_GRID_CHANGE_LOG_CELLS && dropCount < gridChangeLog.Num())
+	{
+		gridChangeLogCellCount -= gridChangeLog[dropCount].changedCells.Num();
+		++dropCount;
+	}
+	gridChangeLog.RemoveAt(0, dropCount, EAllowShrinking::No);
+}
+
+bool UZonePathScoreCache::CanReuseGrid(const FZoneLevelData& inZoneData) const
+{
+	if (!pathGrid.bIsGenerated || levelContentHash == 0 || IsGenerating())
+	{
+		return false;
+	}
+	return levelContentHash == NZonePathCacheFormat::ComputeLevelContentHash(inZoneData);
+}
+
+int64 UZonePathScoreCache::GetMemoryFootprint() const
+{
+	FScopeLock Lock(&pathGridMutex);
+
+	// 게시된 스냅샷은 작업 그리드의 전체 복사본이므로 따로 합산 (이전 스냅샷은 고정한 리더가 놓으면 해제되므로 제외)
+	int64 footprint = pathGrid.GetAllocatedSize();
+	if (publishedSnapshot.IsValid())
+	{
+		footprint += sizeof(FZonePathGrid) + publishedSnapshot->GetAllocatedSize();
+	}
+	for (const TPair<FIntVector, FZonePathFlowFieldCacheEntry>& entryPair : flowFieldCache)
+	{
+		if (entryPair.Value.field.IsValid())
+		{
+			footprint += sizeof(FZonePathFlowField) + entryPair.Value.field->GetAllocatedSize();
+		}
+	}
+	return footprint;
+}
+
+void UZonePathScoreCache::PublishSnapshotLocked()
+{
+	// 현재 그리드를 복사해 불변 스냅샷으로 게시 (쓰기는 드물고 읽기는 락 없이 진행)
+	PublishSnapshotLocked(MakeShared<FZonePathGrid, ESPMode::ThreadSafe>(pathGrid));/*modify_261016_: 미리 만든 스냅샷 게시와 공용화*/
+}
+
+void UZonePathScoreCache::PublishSnapshotLocked(FZonePathGridSnapshotPtr inSnapshot)
+{
+	StoreSnapshotLocked(MoveTemp(inSnapshot));
+	snapshotVersion.fetch_add(1, std::memory_order_acq_rel);
+}
+
+void UZonePathScoreCache::MarkSnapshotPublishPendingLocked()
+{
+	snapshotVersion.fetch_add(1, std::memory_order_acq_rel);
+	bSnapshotPublishPending.store(true, std::memory_order_release);
+
+	// 읽기가 없어도 프레임 끝에는 게시되도록 틱 등록 (FTSTicker는 어느 스레드에서든 등록 가능)
+	if (!snapshotPublishTickerHandle.IsValid())
+	{
+		snapshotPublishTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateUObject(this, &UZonePathScoreCache::TickSnapshotPublish));
+	}
+}
+
+void UZonePathScoreCache::PublishPendingSnapshotLocked() const
+{
+	if (bSnapshotPublishPending.load(std::memory_order_relaxed))
+	{
+		StoreSnapshotLocked(MakeShared<FZonePathGrid, ESPMode::ThreadSafe>(pathGrid));
+	}
+}
+
+void UZonePathScoreCache::StoreSnapshotLocked(FZonePathGridSnapshotPtr inSnapshot) const
+{
+	// 이전 스냅샷은 고정한 리더가 모두 놓을 때 해제되며, 마지막 참조라면 포인터 락 밖에서 해제
+	FZonePathGridSnapshotPtr previousSnapshot;
+	{
+		FWriteScopeLock WriteLock(publishedSnapshotLock);
+		previousSnapshot = MoveTemp(publishedSnapshot);
+		publishedSnapshot = MoveTemp(inSnapshot);
+	}
+	bSnapshotPublishPending.store(false, std::memory_order_release);
+}
+
+FZonePathGridSnapshotPtr UZonePathScoreCache::AcquireSnapshot(bool bWaitForWriter) const
+{
+	if (bSnapshotPublishPending.load(std::memory_order_acquire))
+	{
+		if (bWaitForWriter)
+		{
+			FScopeLock Lock(&pathGridMutex);
+			PublishPendingSnapshotLocked();
+		}
+		else if (pathGridMutex.TryLock())
+		{
+			// 쓰기 측이 잡고 있으면 대기하지 않고 마지막 게시본을 읽음
+			PublishPendingSnapshotLocked();
+			pathGridMutex.Unlock();
+		}
+	}
+
+	FReadScopeLock ReadLock(publishedSnapshotLock);
+	return publishedSnapshot;
+}
+
+bool UZonePathScoreCache::TickSnapshotPublish(float inDeltaTime)
+{
+	FScopeLock Lock(&pathGridMutex);
+	PublishPendingSnapshotLocked();
+	snapshotPublishTickerHandle.Reset();
+	return false;
+}
+
+void UZonePathScoreCache::MarkFullSaveRequiredLocked()
+{
+	// 그리드 전체가 바뀌었으므로 개별 더티 추적 대신 베이스 재작성
+	dirtyCellIndices.Reset();
+	bFullSaveRequired = true;
+}
+
+void UZonePathScoreCache::ClearCache()
+{
+	CancelGeneration();/*modify_261016_: 진행 중인 분할 생성이 빈 그리드를 마무리하지 않도록 먼저 중단*/
+
+	FScopeLock Lock(&pathGridMutex);
+	pathGrid = FZonePathGrid();
+	levelContentHash = 0;
+	flowFieldCache.Reset();/*modify_261016_: 버전 불일치로도 폐기되지만 메모리를 즉시 반환*/
+	PublishSnapshotLocked();
+	MarkFullSaveRequiredLocked();
+
+	if (GetWorld() && autoSaveTimerHandle.IsValid())
+	{
+		GetWorld()->GetTimerManager().ClearTimer(autoSaveTimerHandle);
+	}
+}
+
+void UZonePathScoreCache::SaveCacheToFile(const FString& inFilePath)
+{
+	// 진행 중인 백그라운드 저장과 같은 파일을 동시에 쓰지 않도록 먼저 정리
+	WaitForPendingSave();
+
+	/*modify_261016_: 동기 저장은 항상 전체 베이스 파일을 기록 (바이너리 포맷, 델타 초기화)*/
+	FZonePathGridSnapshotPtr snapshot;
+	TArray<int32> dirtyCells;
+	uint32 savedContentHash = 0;
+	bool bFullSave = true;
+	if (!CaptureSaveState(true, inFilePath, snapshot, dirtyCells, savedContentHash, bFullSave))
+	{
+		return;
+	}
+
+	ApplySaveResult(ExecuteCacheSave(*snapshot, dirtyCells, savedContentHash, inFilePath, bFullSave, baseFileChecksum));
+}
+
+bool UZonePathScoreCache::SaveCacheToFileAsync(const FString& inFilePath)
+{
+	check(IsInGameThread());
+
+	if (IsSaveInFlight())
+	{
+		// 진행 중인 저장이 끝나면 최신 스냅샷으로 한 번 더 저장
+		queuedSaveFilePath = inFilePath;
+		return true;
+	}
+
+	// 게임 스레드에서는 스냅샷 참조와 더티 목록만 획득 (복사/직렬화 없음)
+	FZonePathGridSnapshotPtr snapshot;
+	TArray<int32> dirtyCells;
+	uint32 savedContentHash = 0;
+	bool bFullSave = false;
+	if (!CaptureSaveState(false, inFilePath, snapshot, dirtyCells, savedContentHash, bFullSave))
+	{
+		return false;
+	}
+
+	const uint32 currentBaseChecksum = baseFileChecksum;
+	pendingSaveFuture = Async(EAsyncExecution::ThreadPool,
+		[snapshot, dirtyCells = MoveTemp(dirtyCells), savedContentHash, inFilePath, bFullSave, currentBaseChecksum]()
+	{
+		return ExecuteCacheSave(*snapshot, dirtyCells, savedContentHash, inFilePath, bFullSave, currentBaseChecksum);
+	});
+
+	// 완료 처리는 퓨처에 값이 들어간 뒤 게임 스레드 틱에서 확인 (작업 안에서 예약하면 값보다 먼저 실행될 수 있음)
+	if (!saveCompletionTickerHandle.IsValid())
+	{
+		saveCompletionTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+			FTickerDelegate::CreateUObject(this, &UZonePathScoreCache::TickSaveCompletion));
+	}
+	return true;
+}
+
+bool UZonePathScoreCache::TickSaveCompletion(float inDeltaTime)
+{
+	if (pendingSaveFuture.IsValid() && !pendingSaveFuture.IsReady())
+	{
+		return true;
+	}
+
+	// 대기열의 저장이 다시 발행되면 같은 틱 등록으로 계속 확인
+	HandleFinishedSave();
+	if (pendingSaveFuture.IsValid())
+	{
+		return true;
+	}
+
+	saveCompletionTickerHandle.Reset();
+	return false;
+}
+
+void UZonePathScoreCache::WaitForPendingSave()
+{
+	// 완료 처리 중 대기 요청이 재발행될 수 있으므로 모두 끝날 때까지 반복
+	while (pendingSaveFuture.IsValid())
+	{
+		pendingSaveFuture.Wait();
+		HandleFinishedSave();
+	}
+}
+
+bool UZonePathScoreCache::CaptureSaveState(bool bForceFullSave, const FString& inFilePath, FZonePathGridSnapshotPtr& outSnapshot,
+	TArray<int32>& outDirtyCells, uint32& outLevelContentHash, bool& bOutFullSave)
+{
+	FScopeLock Lock(&pathGridMutex);
+
+	// 더티 목록에 포함된 갱신이 스냅샷에도 들어가도록 미뤄둔 게시를 먼저 처리
+	PublishPendingSnapshotLocked();
+	if (!publishedSnapshot.IsValid())
+	{
+		return false;
+	}
+
+	// 델타는 같은 베이스 파일에만 이어 붙일 수 있고, 일정량 이상 쌓이면 베이스로 압축
+	bOutFullSave = bForceFullSave || bFullSaveRequired || inFilePath != baseFilePath
+		|| deltaRecordCount + dirtyCellIndices.Num() > deltaCompactionRecordLimit;
+
+	if (!bOutFullSave && dirtyCellIndices.Num() == 0)
+	{
+		return false;
+	}
+
+	// 더티 목록과 스냅샷을 같은 락 안에서 가져와 서로 일치하도록 보장
+	outSnapshot = publishedSnapshot;
+	outDirtyCells = dirtyCellIndices.Array();
+	outLevelContentHash = levelContentHash;
+	dirtyCellIndices.Reset();
+	bFullSaveRequired = false;
+	return true;
+}
+
+FZonePathCacheSaveResult UZonePathScoreCache::ExecuteCacheSave(const FZonePathGrid& inGrid, TConstArrayView<int32> inDirtyCells,
+	uint32 inLevelContentHash, const FString& inFilePath, bool bFullSave, uint32 inBaseChecksum)
+{
+	FZonePathCacheSaveResult result;
+	result.filePath = inFilePath;
+	result.baseChecksum = inBaseChecksum;
+	result.bFullSave = bFullSave;
+
+	if (bFullSave)
+	{
+		result.bSuccess = NZonePathCacheFormat::WriteToFile(inGrid, inLevelContentHash, inFilePath, result.baseChecksum);
+		if (result.bSuccess)
+		{
+			// 새 베이스 기준으로 이전 델타는 무효
+			IFileManager::Get().Delete(*NZonePathCacheFormat::GetDeltaFilePath(inFilePath), false, false, true);
+		}
+	}
+	else
+	{
+		result.bSuccess = NZonePathCacheFormat::AppendDeltaToFile(inGrid, inDirtyCells, inBaseChecksum,
+			NZonePathCacheFormat::GetDeltaFilePath(inFilePath));
+		result.recordCount = inDirtyCells.Num();
+	}
+	return result;
+}
+
+void UZonePathScoreCache::ApplySaveResult(const FZonePathCacheSaveResult& inResult)
+{
+	if (!inResult.bSuccess)
+	{
+		// 기록 실패 시 잃어버린 더티 정보는 다음 전체 저장으로 복구
+		FScopeLock Lock(&pathGridMutex);
+		bFullSaveRequired = true;
+		UE_LOG(LogTemp, Error, TEXT("Failed to save zone path cache to file: %s"), *inResult.filePath);
+		return;
+	}
+
+	if (inResult.bFullSave)
+	{
+		baseFileChecksum = inResult.baseChecksum;
+		baseFilePath = inResult.filePath;
+		deltaRecordCount = 0;
+		UE_LOG(LogTemp, Log, TEXT("Zone path cache saved to: %s"), *inResult.filePath);
+	}
+	else
+	{
+		deltaRecordCount += inResult.recordCount;
+		UE_LOG(LogTemp, Log, TEXT("Zone path cache delta (%d nodes) appended for: %s"), inResult.recordCount, *inResult.filePath);
+	}
+}
+
+void UZonePathScoreCache::HandleFinishedSave()
+{
+	// WaitForPendingSave에서 이미 처리했거나 다음 저장이 아직 진행 중이면 무시
+	if (!pendingSaveFuture.IsValid() || !pendingSaveFuture.IsReady())
+	{
+		return;
+	}
+
+	const FZonePathCacheSaveResult result = pendingSaveFuture.Consume();
+	ApplySaveResult(result);
+	OnZonePathCacheSaved.Broadcast(pathGrid.zoneIdentifier, result.filePath, result.bSuccess);
+
+	if (!queuedSaveFilePath.IsEmpty())
+	{
+		const FString filePath = MoveTemp(queuedSaveFilePath);
+		queuedSaveFilePath.Reset();
+		SaveCacheToFileAsync(filePath);
+	}
+}
+
+bool UZonePathScoreCache::LoadCacheFromFile(const FString& inFilePath)
+{
+	WaitForPendingSave();
+
+	/*modify_261016_: 디코딩은 DecodeCacheFile(워커 스레드에서도 사용), 교체만 락 안에서 수행*/
+	if (ApplyDecodedCache(DecodeCacheFile(inFilePath)))
+	{
+		return true;
+	}
+
+	UE_LOG(LogTemp, Warning, TEXT("Failed to load zone path cache from file: %s"), *inFilePath);
+	return false;
+}
+
+FZonePathCacheLoadResult UZonePathScoreCache::DecodeCacheFile(const FString& inFilePath)
+{
+	FZonePathCacheLoadResult loadResult;
+	loadResult.filePath = inFilePath;
 
-	if (!pathGrid.IsValidGridPosition(inGridPosition))
+	if (!NZonePathCacheFormat::ReadFromFile(inFilePath, loadResult.grid, loadResult.baseChecksum, loadResult.levelContentHash))
 	{
-		return FLT_MAX;
+		return loadResult;
 	}
 
-	if (const FPathNode* nodePtr = pathGrid.pathNodes.Find(inGridPosition))
-	{
-		return nodePtr->movementCost;
-	}
+	// 베이스 이후 누적된 델타 재생 (손상/불일치 시 다음 저장에서 베이스 재작성)
+	loadResult.bDeltaClean = NZonePathCacheFormat::ApplyDeltaFile(NZonePathCacheFormat::GetDeltaFilePath(inFilePath),
+		loadResult.baseChecksum, loadResult.grid, loadResult.appliedDeltaCount);
 
-	// 스파스 그리드에서 저장되지 않은 기본 노드의 기본 비용
-	return 1.0f;
+	// Dense 레이어는 직렬화되지 않으므로 재구성하고, 게시할 스냅샷 복사본도 여기서 준비
+	loadResult.grid.ResolveStorage();
+	loadResult.snapshot = MakeShared<FZonePathGrid, ESPMode::ThreadSafe>(loadResult.grid);
+	loadResult.bSuccess = true;
+	return loadResult;
 }
 
-TArray<FIntVector> UZonePathScoreCache::GetNeighborNodes(const FIntVector& inGridPosition, bool bIncludeDiagonals) const
+bool UZonePathScoreCache::ApplyDecodedCache(FZonePathCacheLoadResult&& inLoadResult)
 {
-	return pathGrid.GetNeighbors(inGridPosition, bIncludeDiagonals);
-}
+	check(IsInGameThread());
 
-FIntVector UZonePathScoreCache::WorldToGridPosition(const FVector& inWorldPosition) const
-{
-	return pathGrid.WorldToGrid(inWorldPosition);
-}
+	if (!inLoadResult.bSuccess)
+	{
+		return false;
+	}
 
-FVector UZonePathScoreCache::GridToWorldPosition(const FIntVector& inGridPosition) const
-{
-	return pathGrid.GridToWorld(inGridPosition);
+	WaitForPendingSave();
+
+	// 분할 생성이 남아 있으면 다음 틱에 로드한 그리드를 덮어쓰므로 중단
+	CancelGeneration();
+
+	FScopeLock Lock(&pathGridMutex);
+	pathGrid = MoveTemp(inLoadResult.grid);
+	// 베이크 입력 해시를 복원해야 다음 로드에서 CanReuseGrid로 재베이크를 건너뛸 수 있음
+	levelContentHash = pathGrid.bIsGenerated ? inLoadResult.levelContentHash : 0;
+	PublishSnapshotLocked(MoveTemp(inLoadResult.snapshot));
+
+	dirtyCellIndices.Reset();
+	bFullSaveRequired = !inLoadResult.bDeltaClean;
+	baseFileChecksum = inLoadResult.baseChecksum;
+	baseFilePath = inLoadResult.filePath;
+	deltaRecordCount = inLoadResult.bDeltaClean ? inLoadResult.appliedDeltaCount : 0;
+
+	UE_LOG(LogTemp, Log, TEXT("Zone path cache loaded from: %s (%d delta records)"), *inLoadResult.filePath, inLoadResult.appliedDeltaCount);
+	return true;
 }
 
-void UZonePathScoreCache::ClearCache()
+void UZonePathScoreCache::ExportCacheToJson(const FString& inFilePath) const
 {
-	pathGrid = FZonePathGrid();
-
-	if (GetWorld() && autoSaveTimerHandle.IsValid())
+	FZonePathGridSnapshotPtr snapshot = GetGridSnapshot();
+	if (!snapshot.IsValid())
 	{
-		GetWorld()->GetTimerManager().ClearTimer(autoSaveTimerHandle);
+		return;
 	}
-}
 
-void UZonePathScoreCache::SaveCacheToFile(const FString& inFilePath)
-{
+	// Compact 그리드는 노드 레코드가 없으므로 복사본에 복원해 내보냄
+	FZonePathGrid exportGrid = *snapshot;
+	exportGrid.ExpandNodeRecord();
+
 	FString jsonString;
-	if (FJsonObjectConverter::UStructToJsonObjectString(pathGrid, jsonString))
+	/*modify_261016_: Compact 그리드 레코드 복원본 사용, 재사용 판정용 베이크 입력 해시를 함께 기록*/
+	TSharedPtr<FJsonObject> jsonObject = FJsonObjectConverter::UStructToJsonObject(exportGrid);
+	if (jsonObject.IsValid())
+	{
+		jsonObject->SetNumberField(TEXT("levelContentHash"), exportGrid.bIsGenerated ? levelContentHash : 0);
+	}
+	if (jsonObject.IsValid() && FJsonSerializer::Serialize(jsonObject.ToSharedRef(), TJsonWriterFactory<>::Create(&jsonString)))
 	{
 		if (!FFileHelper::SaveStringToFile(jsonString, *inFilePath))
 		{
-			UE_LOG(LogTemp, Error, TEXT("Failed to save zone path cache to file: %s"), *inFilePath);
+			UE_LOG(LogTemp, Error, TEXT("Failed to export zone path cache to JSON: %s"), *inFilePath);
 		}
 		else
 		{
-			UE_LOG(LogTemp, Log, TEXT("Zone path cache saved to: %s"), *inFilePath);
+			UE_LOG(LogTemp, Log, TEXT("Zone path cache exported to: %s"), *inFilePath);
 		}
 	}
 }
 
-bool UZonePathScoreCache::LoadCacheFromFile(const FString& inFilePath)
+bool UZonePathScoreCache::ImportCacheFromJson(const FString& inFilePath)
 {
 	FString jsonString;
 	if (FFileHelper::LoadFileToString(jsonString, *inFilePath))
 	{
-		if (FJsonObjectConverter::JsonObjectStringToUStruct(jsonString, &pathGrid))
+		FZonePathGrid importedGrid;
+		/*modify_261016_: 그리드와 함께 베이크 입력 해시 복원 (해시가 없는 이전 파일은 0)*/
+		TSharedPtr<FJsonObject> jsonObject;
+		uint32 importedContentHash = 0;
+		if (FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(jsonString), jsonObject) && jsonObject.IsValid()
+			&& FJsonObjectConverter::JsonObjectToUStruct(jsonObject.ToSharedRef(), &importedGrid))
 		{
-			UE_LOG(LogTemp, Log, TEXT("Zone path cache loaded from: %s"), *inFilePath);
+			jsonObject->TryGetNumberField(TEXT("levelContentHash"), importedContentHash);
+			CancelGeneration();/*modify_261016_: 분할 생성이 가져온 그리드를 덮어쓰지 않도록 중단*/
+			FScopeLock Lock(&pathGridMutex);
+			pathGrid = MoveTemp(importedGrid);
+			levelContentHash = pathGrid.bIsGenerated ? importedContentHash : 0;/*modify_261016_: 가져온 해시 복원*/
+			pathGrid.ResolveStorage();
+			PublishSnapshotLocked();
+			MarkFullSaveRequiredLocked();
+			UE_LOG(LogTemp, Log, TEXT("Zone path cache imported from: %s"), *inFilePath);
 			return true;
 		}
 	}
 
-	UE_LOG(LogTemp, Warning, TEXT("Failed to load zone path cache from file: %s"), *inFilePath);
+	UE_LOG(LogTemp, Warning, TEXT("Failed to import zone path cache from JSON: %s"), *inFilePath);
 	return false;
 }
 
 void UZonePathScoreCache::PerformCollisionCheck(const FZoneLevelData& inZoneData)
 {
-	if (!GetWorld())
+	UWorld* world = GetWorld();
+	if (!world)
 	{
 		return;
 	}
@@ -194,107 +1482,163 @@ void UZonePathScoreCache::PerformCollisionCheck(const FZoneLevelData& inZoneData
 	queryParams.bTraceComplex = false;
 	queryParams.bReturnPhysicalMaterial = false;
 
+	/*modify_261016_: 직렬 3중 루프를 (z, y) 행 단위 슬랩으로 나눠 병렬 베이크*/
+	const int32 rowCount = pathGrid.GetBakeRowCount();
+	if (rowCount <= 0 || pathGrid.gridDimensions.X <= 0)
+	{
+		return;
+	}
+
+	// 워커 수의 몇 배로 슬랩을 나눠 행마다 히트 비율이 달라도 부하가 고르게 분산되도록
+	const int32 targetSlabCount = FMath::Max(1, FTaskGraphInterface::Get().GetNumWorkerThreads() * 4);
+	const int32 rowsPerSlab = FMath::Max(1, FMath::DivideAndRoundUp(rowCount, targetSlabCount));
+	const int32 slabCount = FMath::DivideAndRoundUp(rowCount, rowsPerSlab);
+
+	// 슬랩별 독립 버퍼 (공유 상태 없이 기록 후 마지막에 순서대로 병합)
+	TArray<FZonePathBakeSlab> bakeSlabs;
+	bakeSlabs.SetNum(slabCount);
+
+	// 베이크 동안 게임 스레드는 ParallelFor 안에서 대기하므로 GC/액터 변경이 일어나지 않음
+	ParallelFor(slabCount, [&](int32 inSlabIndex)
+	{
+		FZonePathBakeSlab& slab = bakeSlabs[inSlabIndex];
+		const int32 firstRow = inSlabIndex * rowsPerSlab;
+		const int32 lastRow = FMath::Min(firstRow + rowsPerSlab, rowCount);
+
+		for (int32 row = firstRow; row < lastRow; ++row)
+		{
+			BakeRow(*world, inZoneData, queryParams, row, slab.nodes, slab.blockedNodes, slab.checkedNodes);
+		}
+	});
+
 	int32 blockedNodes = 0;
 	int32 totalCheckedNodes = 0;
+	int32 storedNodeCount = 0;
+	for (const FZonePathBakeSlab& slab : bakeSlabs)
+	{
+		storedNodeCount += slab.nodes.Num();
+	}
 
-	// 스파스 그리드: 샘플링을 통해 필요한 노드만 검사하여 메모리 절약
-	const int32 sampleStep = FMath::Max(1, pathGrid.gridDimensions.X / 50); // 적응적 샘플링
+	pathGrid.pathNodes.Reserve(pathGrid.pathNodes.Num() + storedNodeCount);
+	for (const FZonePathBakeSlab& slab : bakeSlabs)
+	{
+		blockedNodes += slab.blockedNodes;
+		totalCheckedNodes += slab.checkedNodes;
+		for (const FPathNode& node : slab.nodes)
+		{
+			pathGrid.pathNodes.Add(node.gridPosition, node);
+		}
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("Parallel slab bake completed: %d blocked nodes, %d baked nodes out of %d checked (%d total possible, %d slabs)"),/*modify_261016_: 병렬 슬랩 베이크 결과 (저장 방식은 이후 결정)*/
+		blockedNodes, storedNodeCount, totalCheckedNodes,
+		pathGrid.gridDimensions.X * pathGrid.gridDimensions.Y * pathGrid.gridDimensions.Z, slabCount);
+}
+
+void UZonePathScoreCache::BakeRow(const UWorld& inWorld, const FZoneLevelData& inZoneData, const FCollisionQueryParams& inQueryParams,
+	int32 inRow, TArray<FPathNode>& outNodes, int32& outBlockedCount, int32& outCheckedCount) const
+{
+	const int32 sampleStep = pathGrid.bakeSampleStep;
+	const int32 sampledRowsY = FMath::DivideAndRoundUp(pathGrid.gridDimensions.Y, sampleStep);
+	const int32 y = (inRow % sampledRowsY) * sampleStep;
+	const int32 z = (inRow / sampledRowsY) * sampleStep;
 
-	for (int32 z = 0; z < pathGrid.gridDimensions.Z; z += sampleStep)
+	for (int32 x = 0; x < pathGrid.gridDimensions.X; x += sampleStep)
 	{
-		for (int32 y = 0; y < pathGrid.gridDimensions.Y; y += sampleStep)
+		outCheckedCount++;
+
+		FPathNode newNode;
+		if (BakeCell(inWorld, inZoneData, inQueryParams, FIntVector(x, y, z), newNode, outBlockedCount))
 		{
-			for (int32 x = 0; x < pathGrid.gridDimensions.X; x += sampleStep)
-			{
-				FIntVector gridPos(x, y, z);
-				FVector worldPos = pathGrid.GridToWorld(gridPos);
-				totalCheckedNodes++;
-
-				// 지면 체크를 위한 라인 트레이스
-				FVector traceStart = worldPos + FVector(0, 0, 500.0f);
-				FVector traceEnd = worldPos - FVector(0, 0, 500.0f);
-
-				FHitResult hitResult;
-				bool bHit = GetWorld()->LineTraceSingleByChannel(
-					hitResult,
-					traceStart,
-					traceEnd,
-					ECC_WorldStatic,
-					queryParams
-				);
-
-				// 충돌 또는 특별한 상황이 있는 경우에만 노드를 스파스 맵에 저장
-				bool bShouldStoreNode = false;
-				FPathNode newNode(worldPos, gridPos);
-
-				if (bHit)
-				{
-					newNode.worldPosition.Z = hitResult.Location.Z;
-
-					// 블록된 액터 태그 체크
-					if (hitResult.GetActor())
-					{
-						for (const FName& blockedTag : inZoneData.pathSettings.blockedActorTags)
-						{
-							if (hitResult.GetActor()->ActorHasTag(blockedTag))
-							{
-								newNode.bIsBlocked = true;
-								blockedNodes++;
-								bShouldStoreNode = true;
-								break;
-							}
-						}
-					}
-
-					// 경사도 체크
-					FVector surfaceNormal = hitResult.Normal;
-					float slopeAngle = FMath::RadiansToDegrees(FMath::Acos(FVector::DotProduct(surfaceNormal, FVector::UpVector)));
-
-					if (slopeAngle > 45.0f)
-					{
-						newNode.movementCost *= 2.0f;
-						bShouldStoreNode = true;
-					}
-					if (slopeAngle > 60.0f)
-					{
-						newNode.bIsBlocked = true;
-						blockedNodes++;
-						bShouldStoreNode = true;
-					}
-				}
-				else
-				{
-					// 지면이 없는 경우
-					if (inZoneData.pathSettings.pathType != EZonePathType::Air &&
-						inZoneData.pathSettings.pathType != EZonePathType::Mixed)
-					{
-						newNode.bIsBlocked = true;
-						blockedNodes++;
-						bShouldStoreNode = true;
-					}
-				}
+			outNodes.Add(newNode);
+		}
+	}
+}
 
-				// Zone 경계 체크
-				if (!inZoneData.zoneBounds.ContainsPoint(newNode.worldPosition))
-				{
-					newNode.bIsBlocked = true;
-					blockedNodes++;
-					bShouldStoreNode = true;
-				}
+bool UZonePathScoreCache::BakeCell(const UWorld& inWorld, const FZoneLevelData& inZoneData, const FCollisionQueryParams& inQueryParams,
+	const FIntVector& inGridPos, FPathNode& outNode, int32& outBlockedCount) const
+{
+	const FVector worldPos = pathGrid.GridToWorld(inGridPos);
+
+	// 지면 체크를 위한 라인 트레이스
+	const FVector traceStart = worldPos + FVector(0, 0, 500.0f);
+	const FVector traceEnd = worldPos - FVector(0, 0, 500.0f);
+
+	FHitResult hitResult;
+	const bool bHit = inWorld.LineTraceSingleByChannel(
+		hitResult,
+		traceStart,
+		traceEnd,
+		ECC_WorldStatic,
+		inQueryParams
+	);
+
+	// 충돌 또는 특별한 상황이 있는 경우에만 노드를 스파스 맵에 저장
+	bool bShouldStoreNode = false;
+	outNode = FPathNode(worldPos, inGridPos);
+
+	if (bHit)
+	{
+		outNode.worldPosition.Z = hitResult.Location.Z;
 
-				// 기본값이 아닌 경우에만 스파스 맵에 저장
-				if (bShouldStoreNode || newNode.movementCost != 1.0f)
+		// 블록된 액터 태그 체크
+		if (const AActor* hitActor = hitResult.GetActor())
+		{
+			for (const FName& blockedTag : inZoneData.pathSettings.blockedActorTags)
+			{
+				if (hitActor->ActorHasTag(blockedTag))
 				{
-					newNode.movementCost *= inZoneData.pathSettings.movementCostMultiplier;
-					pathGrid.pathNodes.Add(gridPos, newNode);
+					outNode.bIsBlocked = true;
+					outBlockedCount++;
+					bShouldStoreNode = true;
+					break;
 				}
 			}
 		}
+
+		// 경사도 체크
+		const FVector surfaceNormal = hitResult.Normal;
+		const float slopeAngle = FMath::RadiansToDegrees(FMath::Acos(FVector::DotProduct(surfaceNormal, FVector::UpVector)));
+
+		if (slopeAngle > 45.0f)
+		{
+			outNode.movementCost *= 2.0f;
+			bShouldStoreNode = true;
+		}
+		if (slopeAngle > 60.0f)
+		{
+			outNode.bIsBlocked = true;
+			outBlockedCount++;
+			bShouldStoreNode = true;
+		}
+	}
+	else
+	{
+		// 지면이 없는 경우
+		if (inZoneData.pathSettings.pathType != EZonePathType::Air &&
+			inZoneData.pathSettings.pathType != EZonePathType::Mixed)
+		{
+			outNode.bIsBlocked = true;
+			outBlockedCount++;
+			bShouldStoreNode = true;
+		}
 	}
 
-	UE_LOG(LogTemp, Log, TEXT("Sparse collision check completed: %d blocked nodes, %d stored nodes out of %d checked (%d total possible)"),
-		blockedNodes, pathGrid.pathNodes.Num(), totalCheckedNodes,
-		pathGrid.gridDimensions.X * pathGrid.gridDimensions.Y * pathGrid.gridDimensions.Z);
+	// Zone 경계 체크
+	if (!inZoneData.zoneBounds.ContainsPoint(outNode.worldPosition))
+	{
+		outNode.bIsBlocked = true;
+		outBlockedCount++;
+		bShouldStoreNode = true;
+	}
+
+	// 기본값이 아닌 경우에만 스파스 맵에 저장
+	if (bShouldStoreNode || outNode.movementCost != 1.0f)
+	{
+		outNode.movementCost *= inZoneData.pathSettings.movementCostMultiplier;
+		return true;
+	}
+	return false;
 }
 
 void UZonePathScoreCache::SetupConnectionPoints(const FZoneLevelData& inZoneData)
@@ -334,15 +1678,13 @@ void UZonePathScoreCache::AutoSaveCache()
 		return;
 	}
 
-	FString saveDir = FPaths::ProjectSavedDir() / TEXT("PathFindingCache");
-	IFileManager::Get().MakeDirectory(*saveDir, true);
-
-	FString fileName = FString::Printf(TEXT("%s_%d.json"),
-		*pathGrid.zoneIdentifier.zoneName.ToString(),
-		pathGrid.zoneIdentifier.zoneID);
-	FString filePath = saveDir / fileName;
+	SaveCacheToFileAsync(NZonePathCacheFormat::GetCacheFilePath(pathGrid.zoneIdentifier));/*modify_261016_: 게임 스레드 히치 방지를 위해 백그라운드 저장*/
+}
 
-	SaveCacheToFile(filePath);
+// FZonePathGridReadScope 구현부
+FZonePathGridReadScope::FZonePathGridReadScope(const UZonePathScoreCache& inCache)
+	: pinnedSnapshot(inCache.AcquireSnapshot(false))
+{
 }
 
 // FZonePathGrid 구현부
@@ -358,6 +1700,286 @@ int32 FZonePathGrid::GetNodeIndex(const FIntVector& inGridPos) const
 	return inGridPos.X + (inGridPos.Y * gridDimensions.X) + (inGridPos.Z * gridDimensions.X * gridDimensions.Y);
 }
 
+bool FZonePathGrid::IsNodeBlockedAt(const FIntVector& inGridPos) const
+{
+	const int32 nodeIndex = GetNodeIndex(inGridPos);
+	if (nodeIndex == INDEX_NONE)
+	{
+		return true;
+	}
+
+	if (bUseDenseStorage)
+	{
+		return IsBlockedAtIndex(nodeIndex);
+	}
+
+	// 스파스 그리드에서 저장되지 않은 기본 노드는 차단되지 않음
+	const FPathNode* nodePtr = pathNodes.Find(inGridPos);
+	return nodePtr && nodePtr->bIsBlocked;
+}
+
+float FZonePathGrid::GetMovementCostAt(const FIntVector& inGridPos) const
+{
+	const int32 nodeIndex = GetNodeIndex(inGridPos);
+	if (nodeIndex == INDEX_NONE)
+	{
+		return FLT_MAX;
+	}
+
+	if (bUseDenseStorage)
+	{
+		return GetMovementCostAtIndex(nodeIndex);
+	}
+
+	// 스파스 그리드에서 저장되지 않은 기본 노드의 기본 비용
+	const FPathNode* nodePtr = pathNodes.Find(inGridPos);
+	return nodePtr ? nodePtr->movementCost : 1.0f;
+}
+
+void FZonePathGrid::SetNodeState(const FIntVector& inGridPos, float inCost, bool bBlocked)
+{
+	const int32 nodeIndex = GetNodeIndex(inGridPos);
+	if (nodeIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	// Compact 그리드는 노드 레코드 없이 레이어만 갱신
+	if (!bCompactStorage)
+	{
+		// 스파스 구조에서 노드 찾거나 생성
+		FPathNode* nodePtr = pathNodes.Find(inGridPos);
+		if (!nodePtr)
+		{
+			nodePtr = &pathNodes.Add(inGridPos, FPathNode(GridToWorld(inGridPos), inGridPos));
+		}
+
+		nodePtr->movementCost = inCost;
+		nodePtr->bIsBlocked = bBlocked;
+	}
+
+	// 비용 하한은 내려가기만 함 (휴리스틱 허용성 유지)
+	if (inCost > 0.0f)
+	{
+		minMovementCost = FMath::Min(minMovementCost, inCost);
+	}
+
+	if (bUseDenseStorage)
+	{
+		// 단계는 유지하고 코드로 정확히 표현되지 않는 비용만 보조 테이블에 저장 (다른 셀 재인코딩 없음)
+		SetDenseCost(nodeIndex, inCost);
+		const uint32 blockedMask = 1u << (nodeIndex & 31);
+		if (bBlocked)
+		{
+			denseBlockedBits[nodeIndex >> 5] |= blockedMask;
+		}
+		else
+		{
+			denseBlockedBits[nodeIndex >> 5] &= ~blockedMask;
+		}
+	}
+}
+
+void FZonePathGrid::ResolveStorage()
+{
+	// Compact 그리드는 레이어가 유일한 원본이므로 먼저 노드 레코드 복원
+	ExpandNodeRecord();
+
+	const int64 cellCount = GetCellCount();
+	bool bDense = false;
+	bool bCompact = false;
+
+	switch (storageMode)
+	{
+	case EZonePathGridStorage::Dense:
+	case EZonePathGridStorage::Compact:
+		bDense = cellCount > 0 && cellCount <= DENSE_MAX_CELL_COUNT;
+		bCompact = bDense && storageMode == EZonePathGridStorage::Compact;
+		if (cellCount > DENSE_MAX_CELL_COUNT)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("Dense storage requested but grid has %lld cells (max %lld), falling back to sparse"),
+				cellCount, DENSE_MAX_CELL_COUNT);
+		}
+		break;
+	case EZonePathGridStorage::Sparse:
+		bDense = false;
+		break;
+	case EZonePathGridStorage::Auto:
+	default:
+		// 작은 볼륨은 항상 Compact, 큰 볼륨은 저장 노드 점유율이 높을 때만 Compact
+		if (cellCount > 0 && cellCount <= DENSE_MAX_CELL_COUNT)
+		{
+			const float occupancy = static_cast<float>(pathNodes.Num()) / static_cast<float>(cellCount);
+			bDense = cellCount <= DENSE_AUTO_CELL_LIMIT || occupancy >= DENSE_AUTO_OCCUPANCY;
+			bCompact = bDense;
+		}
+		break;
+	}
+
+	// 탐색 휴리스틱용 최소 비용 재계산 (저장되지 않은 노드의 기본 비용 1.0 포함)
+	minMovementCost = 1.0f;
+	for (const TPair<FIntVector, FPathNode>& nodePair : pathNodes)
+	{
+		if (!nodePair.Value.bIsBlocked && nodePair.Value.movementCost > 0.0f)
+		{
+			minMovementCost = FMath::Min(minMovementCost, nodePair.Value.movementCost);
+		}
+	}
+
+	const int32 storedNodeCount = pathNodes.Num();
+	if (bDense)
+	{
+		RebuildDenseLayer();
+
+		// 코드로 정확히 표현되지 않는 비용(2진 분수가 아닌 배율 등)이 많으면 측면 테이블이 노드 레코드보다 커지므로 스파스 유지
+		if (denseCostOutliers.Num() > storedNodeCount * DENSE_MAX_OUTLIER_FRACTION)
+		{
+			UE_LOG(LogTemp, Warning, TEXT("%d of %d stored node costs are not exact cost codes, falling back to sparse storage"),
+				denseCostOutliers.Num(), storedNodeCount);
+			ReleaseDenseLayer();
+			bCompact = false;
+		}
+
+		if (bCompact)
+		{
+			// 레이어가 모든 상태를 담으므로 노드 레코드 해제
+			pathNodes.Empty();
+			bCompactStorage = true;
+		}
+	}
+	else
+	{
+		ReleaseDenseLayer();
+	}
+
+	UE_LOG(LogTemp, Log, TEXT("Path grid storage resolved to %s (%lld cells, %d stored nodes, %llu bytes)"),
+		bCompactStorage ? TEXT("Compact") : (bUseDenseStorage ? TEXT("Dense") : TEXT("Sparse")), cellCount, storedNodeCount,
+		static_cast<uint64>(GetAllocatedSize()));
+}
+
+void FZonePathGrid::RebuildDenseLayer()
+{
+	ExpandNodeRecord();
+
+	// 가장 큰 비용이 표현되도록 양자화 단계 결정
+	float maxCost = 1.0f;
+	for (const TPair<FIntVector, FPathNode>& nodePair : pathNodes)
+	{
+		maxCost = FMath::Max(maxCost, nodePair.Value.movementCost);
+	}
+	costQuantizationStep = ComputeCostQuantizationStep(maxCost);
+
+	const int32 cellCount = static_cast<int32>(GetCellCount());
+	denseBlockedBits.Init(0u, FMath::DivideAndRoundUp(cellCount, 32));
+	denseCostCodes.Init(QuantizeCost(1.0f), cellCount);
+	denseCostOutliers.Reset();
+	denseConnectionCells.Reset();
+
+	for (const TPair<FIntVector, FPathNode>& nodePair : pathNodes)
+	{
+		const int32 nodeIndex = GetNodeIndex(nodePair.Key);
+		if (nodeIndex == INDEX_NONE)
+		{
+			continue;
+		}
+
+		const FPathNode& node = nodePair.Value;
+		SetDenseCost(nodeIndex, node.movementCost);
+		if (node.bIsBlocked)
+		{
+			denseBlockedBits[nodeIndex >> 5] |= 1u << (nodeIndex & 31);
+		}
+		if (node.bIsConnectionPoint)
+		{
+			denseConnectionCells.Add(nodeIndex, node.connectedZone);
+		}
+	}
+
+	bUseDenseStorage = true;
+}
+
+void FZonePathGrid::ReleaseDenseLayer()
+{
+	denseBlockedBits.Empty();
+	denseCostCodes.Empty();
+	denseCostOutliers.Empty();
+	denseConnectionCells.Empty();
+	bUseDenseStorage = false;
+	bCompactStorage = false;
+}
+
+void FZonePathGrid::ExpandNodeRecord()
+{
+	if (!bCompactStorage)
+	{
+		return;
+	}
+
+	pathNodes.Reset();
+	ForEachStoredNode([this](const FPathNode& inNode)
+	{
+		pathNodes.Add(inNode.gridPosition, inNode);
+	});
+	bCompactStorage = false;
+}
+
+int32 FZonePathGrid::GetStoredNodeCount() const
+{
+	if (!bCompactStorage)
+	{
+		return pathNodes.Num();
+	}
+
+	int32 storedNodeCount = 0;
+	ForEachStoredNode([&storedNodeCount](const FPathNode&)
+	{
+		++storedNodeCount;
+	});
+	return storedNodeCount;
+}
+
+bool FZonePathGrid::MakeNodeFromDenseLayer(int32 inIndex, FPathNode& outNode, bool bOnlyNonDefault) const
+{
+	const bool bBlocked = IsBlockedAtIndex(inIndex);
+	const uint8 costCode = denseCostCodes[inIndex];
+	const FZoneIdentifier* connectedZonePtr = denseConnectionCells.Find(inIndex);
+
+	if (bOnlyNonDefault && !bBlocked && !connectedZonePtr && costCode == QuantizeCost(1.0f))
+	{
+		return false;
+	}
+
+	const FIntVector gridPos = GetGridPosition(inIndex);
+	outNode = FPathNode(GridToWorld(gridPos), gridPos, GetMovementCostAtIndex(inIndex));
+	outNode.bIsBlocked = bBlocked;
+	if (connectedZonePtr)
+	{
+		outNode.bIsConnectionPoint = true;
+		outNode.connectedZone = *connectedZonePtr;
+	}
+	return true;
+}
+
+void FZonePathGrid::SetDenseCost(int32 inIndex, float inCost)
+{
+	const uint8 costCode = QuantizeCost(inCost);
+	denseCostCodes[inIndex] = costCode;
+	if (costCode == OUTLIER_COST_CODE)
+	{
+		denseCostOutliers.Add(inIndex, inCost);
+	}
+	else if (denseCostOutliers.Num() > 0)
+	{
+		denseCostOutliers.Remove(inIndex);
+	}
+}
+
+SIZE_T FZonePathGrid::GetAllocatedSize() const
+{
+	return pathNodes.GetAllocatedSize() + denseBlockedBits.GetAllocatedSize() + denseCostCodes.GetAllocatedSize()
+		+ denseCostOutliers.GetAllocatedSize() + denseConnectionCells.GetAllocatedSize();
+}
+
 FIntVector FZonePathGrid::WorldToGrid(const FVector& inWorldPos) const
 {
 	FVector relativePos = inWorldPos - gridOrigin;
@@ -384,6 +2006,11 @@ bool FZonePathGrid::GetNode(const FIntVector& inGridPos, FPathNode& outNode) con
 		return false;
 	}
 
+	if (bCompactStorage)
+	{
+		return MakeNodeFromDenseLayer(GetNodeIndex(inGridPos), outNode, false);/*modify_261016_: Compact 그리드는 레이어에서 노드 복원*/
+	}
+
 	if (const FPathNode* nodePtr = pathNodes.Find(inGridPos))
 	{
 		outNode = *nodePtr;
@@ -403,6 +2030,11 @@ bool FZonePathGrid::GetNodeMutable(const FIntVector& inGridPos, FPathNode& outNo
 		return false;
 	}
 
+	if (bCompactStorage)
+	{
+		return MakeNodeFromDenseLayer(GetNodeIndex(inGridPos), outNode, false);/*modify_261016_: Compact 그리드는 레코드를 만들지 않음 (변경은 SetNodeState)*/
+	}
+
 	if (FPathNode* nodePtr = pathNodes.Find(inGridPos))
 	{
 		outNode = *nodePtr;
@@ -410,15 +2042,17 @@ bool FZonePathGrid::GetNodeMutable(const FIntVector& inGridPos, FPathNode& outNo
 	}
 
 	// 기본 노드 생성 및 반환
-	FVector worldPos = GridToWorld(inGridPos);
-	outNode = FPathNode(worldPos, inGridPos);
-	pathNodes.Add(inGridPos, outNode);
+	/*modify_261016_: Dense 레이어와 어긋나지 않도록 레코드 생성은 SetNodeState로 위임*/
+	const FPathNode defaultNode(GridToWorld(inGridPos), inGridPos);
+	SetNodeState(inGridPos, defaultNode.movementCost, defaultNode.bIsBlocked);
+	outNode = pathNodes.FindChecked(inGridPos);
 	return true;
 }
 
-void FZonePathGrid::InitializeGrid(const FZoneBounds& inZoneBounds, float inCellSize)
+void FZonePathGrid::InitializeGrid(const FZoneBounds& inZoneBounds, float inCellSize, EZonePathGridStorage inStorage)
 {
 	cellSize = inCellSize;
+	storageMode = inStorage;
 	gridOrigin = inZoneBounds.center - inZoneBounds.extent;
 
 	FVector gridSize = inZoneBounds.extent * 2.0f;
@@ -430,6 +2064,8 @@ void FZonePathGrid::InitializeGrid(const FZoneBounds& inZoneBounds, float inCell
 
 	// 스파스 그리드 초기화 - 기본 노드들은 필요할 때만 생성
 	pathNodes.Empty();
+	ReleaseDenseLayer();
+	minMovementCost = 1.0f;
 	pathNodes.Reserve(FMath::Min(1000, gridDimensions.X * gridDimensions.Y)); // 예상 활성 노드 수
 
 	bIsGenerated = true;
@@ -448,47 +2084,17 @@ bool FZonePathGrid::IsValidGridPosition(const FIntVector& inGridPos) const
 
 TArray<FIntVector> FZonePathGrid::GetNeighbors(const FIntVector& inGridPos, bool bIncludeDiagonals) const
 {
-	TArray<FIntVector> neighbors;
-
-	// 직접 인접한 이웃들
-	static const TArray<FIntVector> directNeighbors = {
-		FIntVector(1, 0, 0), FIntVector(-1, 0, 0),
-		FIntVector(0, 1, 0), FIntVector(0, -1, 0),
-		FIntVector(0, 0, 1), FIntVector(0, 0, -1)
-	};
-
-	// 대각선 이웃들
-	static const TArray<FIntVector> diagonalNeighbors = {
-		FIntVector(1, 1, 0), FIntVector(1, -1, 0),
-		FIntVector(-1, 1, 0), FIntVector(-1, -1, 0),
-		FIntVector(1, 0, 1), FIntVector(1, 0, -1),
-		FIntVector(-1, 0, 1), FIntVector(-1, 0, -1),
-		FIntVector(0, 1, 1), FIntVector(0, 1, -1),
-		FIntVector(0, -1, 1), FIntVector(0, -1, -1)
-	};
-
-	// 직접 이웃 추가
-	for (const FIntVector& offset : directNeighbors)
-	{
-		FIntVector neighborPos = inGridPos + offset;
-		if (IsValidGridPosition(neighborPos))
-		{
-			neighbors.Add(neighborPos);
-		}
-	}
+	/*modify_261016_: 방향 마스크 기반 방문자로 경계 검사 18회를 제거*/
+	FZonePathNeighborArray inlineNeighbors;
+	GetNeighborsInline(inGridPos, inlineNeighbors, bIncludeDiagonals);
+	return TArray<FIntVector>(inlineNeighbors);
+}
 
-	// 대각선 이웃 추가 (옵션)
-	if (bIncludeDiagonals)
+void FZonePathGrid::GetNeighborsInline(const FIntVector& inGridPos, FZonePathNeighborArray& outNeighbors, bool bIncludeDiagonals) const
+{
+	outNeighbors.Reset();
+	VisitNeighborsBy(inGridPos, [&outNeighbors](int32, const FIntVector& inNeighborPos, int32)
 	{
-		for (const FIntVector& offset : diagonalNeighbors)
-		{
-			FIntVector neighborPos = inGridPos + offset;
-			if (IsValidGridPosition(neighborPos))
-			{
-				neighbors.Add(neighborPos);
-			}
-		}
-	}
-
-	return neighbors;
-}
\ No newline at end of file
+		outNeighbors.Add(inNeighborPos);
+	}, bIncludeDiagonals);
+}
@@ -0,0 +1,1046 @@
+#include "Zone/ZonePathSearch.h"
+#include "Zone/ZonePathScoreCache.h"
+#include "Zone/ZoneLevelData.h"
+#include "Algo/Reverse.h"
+
+namespace
+{
+	/** @Brief Search scratches not leased by any search */
+	struct FZonePathSearchScratchPool
+	{
+		/** @Brief Guards freeScratches */
+		FCriticalSection mutex;
+
+		/** @Brief Idle scratches */
+		TArray<TUniquePtr<FZonePathSearchScratch>> freeScratches;
+	};
+
+	/**
+	* @Brief Gets the process-wide scratch pool
+	* @Return : FZonePathSearchScratchPool& - Pool instance
+	*/
+	FZonePathSearchScratchPool& GetScratchPool()
+	{
+		static FZonePathSearchScratchPool pool;
+		return pool;
+	}
+
+	/** @Brief Heap ordering for FZonePathSearchScratch::openHeap (lowest fScore first) */
+	struct FOpenEntryPredicate
+	{
+		FORCEINLINE bool operator()(const FZonePathSearchScratch::FOpenEntry& inA, const FZonePathSearchScratch::FOpenEntry& inB) const
+		{
+			return inA.fScore < inB.fScore;
+		}
+	};
+
+	/**
+	* @Brief Admissible distance estimate in cells between two grid positions
+	* @inFrom          : FIntVector - Source position
+	* @inTo            : FIntVector - Target position
+	* @bAllowDiagonal  : bool       - Whether diagonal steps are available
+	* @Return          : float      - Lower bound on step length to reach target
+	*/
+	FORCEINLINE float EstimateDistance(const FIntVector& inFrom, const FIntVector& inTo, bool bAllowDiagonal)
+	{
+		const FIntVector delta = inTo - inFrom;
+		if (bAllowDiagonal)
+		{
+			return FMath::Sqrt(static_cast<float>(delta.X * delta.X + delta.Y * delta.Y + delta.Z * delta.Z));
+		}
+		return static_cast<float>(FMath::Abs(delta.X) + FMath::Abs(delta.Y) + FMath::Abs(delta.Z));
+	}
+
+	/** @Brief Neighbor visitor of one search: the caller's shared visitor or one built for the search */
+	struct FSearchNeighborVisitor
+	{
+		FSearchNeighborVisitor(const FZonePathGrid& inGrid, const FZonePathSearchParams& inParams, const FZonePathNeighborVisitor* inSharedVisitor)
+			: sharedVisitor(inSharedVisitor)
+		{
+			if (!sharedVisitor)
+			{
+				ownedVisitor.Emplace(inGrid.gridDimensions,
+					FZonePathNeighborVisitor::MakeDirectionMask(inParams.bAllowDiagonal, inParams.bAllowVertical));
+			}
+			checkSlow(!sharedVisitor || sharedVisitor->Matches(inGrid.gridDimensions, inParams.bAllowDiagonal, inParams.bAllowVertical));
+		}
+
+		FORCEINLINE const FZonePathNeighborVisitor& Get() const { return sharedVisitor ? *sharedVisitor : ownedVisitor.GetValue(); }
+
+	private:
+		/** @Brief Visitor supplied by the caller */
+		const FZonePathNeighborVisitor* sharedVisitor;
+
+		/** @Brief Visitor built when the caller supplied none */
+		TOptional<FZonePathNeighborVisitor> ownedVisitor;
+	};
+
+	/**
+	* @Brief Checks whether a cell can be entered by a search
+	* @inGrid  : FZonePathGrid - Grid being searched
+	* @inIndex : int32         - Cell index
+	* @Return  : bool          - True if cell is open with positive cost
+	*/
+	FORCEINLINE bool IsTraversable(const FZonePathGrid& inGrid, int32 inIndex)
+	{
+		return !inGrid.IsBlockedAtIndex(inIndex) && inGrid.GetMovementCostAtIndex(inIndex) > 0.0f;
+	}
+
+	/**
+	* @Brief Cell index to slot lookup for searches with many start or target cells
+	*
+	* Slots that share a cell are chained through nextSlots, so settling a cell costs
+	* one map lookup instead of a scan over every slot
+	*/
+	struct FSearchSlotLookup
+	{
+		/** @Brief Most recently added slot per cell index */
+		TMap<int32, int32> firstSlots;
+
+		/** @Brief Next slot on the same cell (INDEX_NONE ends the chain) */
+		TArray<int32, TInlineAllocator<32>> nextSlots;
+
+		/**
+		* @Brief Appends the next slot
+		* @inCellIndex : int32 - Cell of the slot (INDEX_NONE: slot is never found)
+		*/
+		void Add(int32 inCellIndex)
+		{
+			const int32 slot = nextSlots.Add(INDEX_NONE);
+			if (inCellIndex == INDEX_NONE)
+			{
+				return;
+			}
+
+			if (int32* firstSlot = firstSlots.Find(inCellIndex))
+			{
+				nextSlots[slot] = *firstSlot;
+				*firstSlot = slot;
+				return;
+			}
+			firstSlots.Add(inCellIndex, slot);
+		}
+
+		/**
+		* @Brief Checks whether a cell still has slots
+		* @inCellIndex : int32 - Cell index
+		* @Return      : bool  - True if at least one slot is on the cell
+		*/
+		FORCEINLINE bool Contains(int32 inCellIndex) const { return firstSlots.Contains(inCellIndex); }
+
+		/**
+		* @Brief Removes the slots on a cell and visits each of them
+		* @inCellIndex : int32    - Cell index
+		* @inVisit     : FuncType - Called with each slot
+		* @Return      : int32    - Number of slots visited
+		*/
+		template <typename FuncType>
+		int32 RemoveAndVisit(int32 inCellIndex, FuncType&& inVisit)
+		{
+			int32 slot = INDEX_NONE;
+			if (!firstSlots.RemoveAndCopyValue(inCellIndex, slot))
+			{
+				return 0;
+			}
+
+			int32 visitedCount = 0;
+			for (; slot != INDEX_NONE; slot = nextSlots[slot])
+			{
+				inVisit(slot);
+				++visitedCount;
+			}
+			return visitedCount;
+		}
+	};
+
+	/**
+	* @Brief Single Z layer view of a grid used by Jump Point Search scans
+	*
+	* Cells outside the grid or the search region count as blocked. A cell is in the
+	* uniform region when it and its open neighbors all have the grid default cost;
+	* only there do straight/diagonal scans skip cells, so pruning never hides a
+	* cheaper detour through cells with other costs
+	*/
+	struct FJumpPointLayer
+	{
+		const FZonePathGrid& grid;
+		const FZonePathSearchParams& params;
+		int32 layerZ;
+		float uniformCost;
+		FIntPoint goal;
+
+		/**
+		* @Brief Gets cell index if the cell can be entered
+		* @inX    : int32 - Grid X
+		* @inY    : int32 - Grid Y
+		* @Return : int32 - Cell index or INDEX_NONE if blocked, outside the grid or outside the region
+		*/
+		FORCEINLINE int32 GetOpenIndex(int32 inX, int32 inY) const
+		{
+			const FIntVector gridPos(inX, inY, layerZ);
+			const int32 nodeIndex = grid.GetNodeIndex(gridPos);
+			return nodeIndex != INDEX_NONE && params.IsInsideBounds(gridPos) && IsTraversable(grid, nodeIndex) ? nodeIndex : INDEX_NONE;
+		}
+
+		FORCEINLINE bool IsOpen(int32 inX, int32 inY) const { return GetOpenIndex(inX, inY) != INDEX_NONE; }
+
+		/**
+		* @Brief Checks whether a cell and its open 8-neighbors all have the uniform cost
+		* @inX    : int32 - Grid X
+		* @inY    : int32 - Grid Y
+		* @Return : bool  - True if scans may pass through the cell
+		*/
+		bool IsInUniformRegion(int32 inX, int32 inY) const
+		{
+			for (int32 offsetY = -1; offsetY <= 1; ++offsetY)
+			{
+				for (int32 offsetX = -1; offsetX <= 1; ++offsetX)
+				{
+					const int32 nodeIndex = GetOpenIndex(inX + offsetX, inY + offsetY);
+					if (nodeIndex != INDEX_NONE && grid.GetMovementCostAtIndex(nodeIndex) != uniformCost)
+					{
+						return false;
+					}
+				}
+			}
+			return true;
+		}
+
+		/**
+		* @Brief Checks for neighbors that are only reachable optimally through a cell
+		* @inX    : int32 - Grid X
+		* @inY    : int32 - Grid Y
+		* @inDX   : int32 - Travel direction X (-1, 0, 1)
+		* @inDY   : int32 - Travel direction Y (-1, 0, 1)
+		* @Return : bool  - True if the cell has a forced neighbor
+		*/
+		bool HasForcedNeighbor(int32 inX, int32 inY, int32 inDX, int32 inDY) const
+		{
+			if (inDX != 0 && inDY != 0)
+			{
+				return (!IsOpen(inX - inDX, inY) && IsOpen(inX - inDX, inY + inDY))
+					|| (!IsOpen(inX, inY - inDY) && IsOpen(inX + inDX, inY - inDY));
+			}
+			if (inDX != 0)
+			{
+				return (!IsOpen(inX, inY + 1) && IsOpen(inX + inDX, inY + 1))
+					|| (!IsOpen(inX, inY - 1) && IsOpen(inX + inDX, inY - 1));
+			}
+			return (!IsOpen(inX + 1, inY) && IsOpen(inX + 1, inY + inDY))
+				|| (!IsOpen(inX - 1, inY) && IsOpen(inX - 1, inY + inDY));
+		}
+
+		/**
+		* @Brief Scans from a cell in one direction until a jump point is found
+		* @inX           : int32      - Scan origin X (not tested)
+		* @inY           : int32      - Scan origin Y (not tested)
+		* @inDX          : int32      - Direction X (-1, 0, 1)
+		* @inDY          : int32      - Direction Y (-1, 0, 1)
+		* @outJumpPoint  : FIntPoint& - Found jump point
+		* @outStepCount  : int32&     - Steps from origin to the jump point
+		* @Return        : bool       - False if the scan ran into a blocked cell
+		*/
+		bool Jump(int32 inX, int32 inY, int32 inDX, int32 inDY, FIntPoint& outJumpPoint, int32& outStepCount) const
+		{
+			const bool bDiagonal = inDX != 0 && inDY != 0;
+			int32 cellX = inX;
+			int32 cellY = inY;
+
+			for (int32 stepCount = 1; ; ++stepCount)
+			{
+				cellX += inDX;
+				cellY += inDY;
+				if (!IsOpen(cellX, cellY))
+				{
+					return false;
+				}
+
+				// 목표, 비균일 비용 인접 셀, 강제 이웃이 있는 셀에서 정지
+				bool bJumpPoint = (cellX == goal.X && cellY == goal.Y) || !IsInUniformRegion(cellX, cellY)
+					|| HasForcedNeighbor(cellX, cellY, inDX, inDY);
+
+				// 대각 진행 중에는 두 축 방향 직선 스캔이 점프 지점을 찾으면 정지
+				if (!bJumpPoint && bDiagonal)
+				{
+					FIntPoint axisJumpPoint;
+					int32 axisStepCount = 0;
+					bJumpPoint = Jump(cellX, cellY, inDX, 0, axisJumpPoint, axisStepCount)
+						|| Jump(cellX, cellY, 0, inDY, axisJumpPoint, axisStepCount);
+				}
+
+				if (bJumpPoint)
+				{
+					outJumpPoint = FIntPoint(cellX, cellY);
+					outStepCount = stepCount;
+					return true;
+				}
+			}
+		}
+	};
+}
+
+FZonePathSearchParams::FZonePathSearchParams(const FZonePathSettings& inSettings)
+	: bAllowDiagonal(inSettings.bAllowDiagonalMovement)
+	, bAllowVertical(inSettings.bAllowVerticalMovement)
+	, maxExpansions(0)
+	, searchMode(inSettings.searchMode)
+{
+}
+
+void FZonePathSearchScratch::BeginSearch(int32 inCellCount)
+{
+	// 더 큰 그리드를 만났을 때만 버퍼 확장 (이후 재사용)
+	if (visitStamps.Num() < inCellCount)
+	{
+		gScores.SetNumUninitialized(inCellCount);
+		parentIndices.SetNumUninitialized(inCellCount);
+		visitStamps.SetNumZeroed(inCellCount);
+		closedStamps.SetNumZeroed(inCellCount);
+	}
+
+	// 세대 스탬프가 한 바퀴 돌면 전체 초기화
+	if (++currentStamp == 0)
+	{
+		FMemory::Memzero(visitStamps.GetData(), visitStamps.Num() * sizeof(uint32));
+		FMemory::Memzero(closedStamps.GetData(), closedStamps.Num() * sizeof(uint32));
+		currentStamp = 1;
+	}
+
+	openHeap.Reset();
+}
+
+void FZonePathSearchScratch::ReleaseBuffers()
+{
+	gScores.Empty();
+	parentIndices.Empty();
+	visitStamps.Empty();
+	closedStamps.Empty();
+	openHeap.Empty();
+	currentStamp = 0;
+}
+
+FZonePathSearchScratchScope::FZonePathSearchScratchScope(int32 inCellCount)
+{
+	{
+		FZonePathSearchScratchPool& pool = GetScratchPool();
+		FScopeLock Lock(&pool.mutex);
+
+		// 충분히 큰 것 중 가장 작은 스크래치, 없으면 가장 큰 스크래치를 재사용 (재할당 최소화)
+		int32 bestSlot = INDEX_NONE;
+		for (int32 slot = 0; slot < pool.freeScratches.Num(); ++slot)
+		{
+			if (bestSlot == INDEX_NONE)
+			{
+				bestSlot = slot;
+				continue;
+			}
+
+			const int32 capacity = pool.freeScratches[slot]->GetCellCapacity();
+			const int32 bestCapacity = pool.freeScratches[bestSlot]->GetCellCapacity();
+			const bool bFits = capacity >= inCellCount;
+			const bool bBestFits = bestCapacity >= inCellCount;
+			if ((bFits && (!bBestFits || capacity < bestCapacity)) || (!bFits && !bBestFits && capacity > bestCapacity))
+			{
+				bestSlot = slot;
+			}
+		}
+
+		if (bestSlot != INDEX_NONE)
+		{
+			scratch = MoveTemp(pool.freeScratches[bestSlot]);
+			pool.freeScratches.RemoveAtSwap(bestSlot, EAllowShrinking::No);
+		}
+	}
+
+	if (!scratch.IsValid())
+	{
+		scratch = MakeUnique<FZonePathSearchScratch>();
+	}
+	scratch->BeginSearch(inCellCount);
+}
+
+FZonePathSearchScratchScope::~FZonePathSearchScratchScope()
+{
+	FZonePathSearchScratchPool& pool = GetScratchPool();
+	FScopeLock Lock(&pool.mutex);
+
+	if (pool.freeScratches.Num() >= FZonePathSearchScratch::MAX_POOLED_SCRATCHES)
+	{
+		return;
+	}
+
+	// 큰 그리드용 스크래치는 몇 개만 유지하고 나머지는 버퍼를 반환 (워커 수만큼 쌓이지 않도록)
+	if (scratch->GetCellCapacity() > FZonePathSearchScratch::RETAINED_CELL_LIMIT)
+	{
+		int32 largeCount = 0;
+		for (const TUniquePtr<FZonePathSearchScratch>& pooled : pool.freeScratches)
+		{
+			largeCount += pooled->GetCellCapacity() > FZonePathSearchScratch::RETAINED_CELL_LIMIT ? 1 : 0;
+		}
+		if (largeCount >= FZonePathSearchScratch::MAX_RETAINED_LARGE_SCRATCHES)
+		{
+			scratch->ReleaseBuffers();
+		}
+	}
+	pool.freeScratches.Add(MoveTemp(scratch));
+}
+
+bool NZonePathSearch::FindPath(const FZonePathGrid& inGrid, const FZonePathSearchParams& inParams,
+	const FIntVector& inStart, const FIntVector& inGoal, TArray<FIntVector>& outPath, float& outPathCost,
+	const FZonePathNeighborVisitor* inNeighborVisitor)
+{
+	if (inParams.searchMode == EZonePathSearchMode::JumpPoint && CanUseJumpPointSearch(inParams))
+	{
+		return FindPathJumpPoint(inGrid, inParams, inStart, inGoal, outPath, outPathCost);
+	}
+	return FindPathAStar(inGrid, inParams, inStart, inGoal, outPath, outPathCost, inNeighborVisitor);
+}
+
+bool NZonePathSearch::FindPathAStar(const FZonePathGrid& inGrid, const FZonePathSearchParams& inParams,
+	const FIntVector& inStart, const FIntVector& inGoal, TArray<FIntVector>& outPath, float& outPathCost,
+	const FZonePathNeighborVisitor* inNeighborVisitor)
+{
+	outPath.Reset();
+	outPathCost = 0.0f;
+
+	const int32 startIndex = inGrid.GetNodeIndex(inStart);
+	const int32 goalIndex = inGrid.GetNodeIndex(inGoal);
+	if (startIndex == INDEX_NONE || goalIndex == INDEX_NONE || !IsTraversable(inGrid, goalIndex)
+		|| !inParams.IsInsideBounds(inStart) || !inParams.IsInsideBounds(inGoal))/*modify_261016_: 영역 제한 검색 지원*/
+	{
+		return false;
+	}
+
+	FZonePathSearchScratchScope scratchScope(static_cast<int32>(inGrid.GetCellCount()));
+	FZonePathSearchScratch& scratch = scratchScope.Get();
+
+	// 휴리스틱은 그리드 최소 이동 비용으로 스케일하여 허용성(admissible) 유지
+	const float heuristicScale = inGrid.GetMinMovementCost();
+	const FOpenEntryPredicate openPredicate;
+	const FSearchNeighborVisitor searchVisitor(inGrid, inParams, inNeighborVisitor);
+	const FZonePathNeighborVisitor& neighborVisitor = searchVisitor.Get();
+
+	scratch.gScores[startIndex] = 0.0f;
+	scratch.parentIndices[startIndex] = INDEX_NONE;
+	scratch.visitStamps[startIndex] = scratch.currentStamp;
+	scratch.openHeap.HeapPush({ EstimateDistance(inStart, inGoal, inParams.bAllowDiagonal) * heuristicScale, startIndex }, openPredicate);
+
+	int32 expansionCount = 0;
+	bool bFound = false;
+
+	while (scratch.openHeap.Num() > 0)
+	{
+		FZonePathSearchScratch::FOpenEntry current;
+		scratch.openHeap.HeapPop(current, openPredicate, EAllowShrinking::No);
+
+		if (scratch.IsClosed(current.nodeIndex))
+		{
+			continue;
+		}
+		scratch.closedStamps[current.nodeIndex] = scratch.currentStamp;
+
+		if (current.nodeIndex == goalIndex)
+		{
+			bFound = true;
+			break;
+		}
+
+		if (++expansionCount > inParams.maxExpansions && inParams.maxExpansions > 0)
+		{
+			break;
+		}
+
+		const FIntVector currentPos = inGrid.GetGridPosition(current.nodeIndex);
+		const float currentG = scratch.gScores[current.nodeIndex];
+
+		neighborVisitor.VisitNeighborsBy(currentPos, current.nodeIndex,
+			[&](int32 inDirection, const FIntVector& inNeighborPos, int32 inNeighborIndex)
+		{
+			if (scratch.IsClosed(inNeighborIndex) || !IsTraversable(inGrid, inNeighborIndex)
+				|| !inParams.IsInsideBounds(inNeighborPos))/*modify_261016_: 영역 제한 검색 지원*/
+			{
+				return;
+			}
+
+			const float tentativeG = currentG + FZonePathNeighborVisitor::GetStepLength(inDirection) * inGrid.GetMovementCostAtIndex(inNeighborIndex);
+			if (scratch.IsVisited(inNeighborIndex) && tentativeG >= scratch.gScores[inNeighborIndex])
+			{
+				return;
+			}
+
+			scratch.gScores[inNeighborIndex] = tentativeG;
+			scratch.parentIndices[inNeighborIndex] = current.nodeIndex;
+			scratch.visitStamps[inNeighborIndex] = scratch.currentStamp;
+
+			const float fScore = tentativeG + EstimateDistance(inNeighborPos, inGoal, inParams.bAllowDiagonal) * heuristicScale;
+			scratch.openHeap.HeapPush({ fScore, inNeighborIndex }, openPredicate);
+		});
+	}
+
+	scratch.lastExpansionCount = expansionCount;
+	if (!bFound)
+	{
+		return false;
+	}
+
+	// 목표에서 부모를 따라 역추적 후 뒤집기
+	for (int32 nodeIndex = goalIndex; nodeIndex != INDEX_NONE; nodeIndex = scratch.parentIndices[nodeIndex])
+	{
+		outPath.Add(inGrid.GetGridPosition(nodeIndex));
+	}
+	Algo::Reverse(outPath);
+
+	outPathCost = scratch.gScores[goalIndex];
+	return true;
+}
+
+int32 NZonePathSearch::FindCostsToTargets(const FZonePathGrid& inGrid, const FZonePathSearchParams& inParams,
+	const FIntVector& inStart, TConstArrayView<FIntVector> inTargets, TArray<float>& outCosts,
+	const FZonePathNeighborVisitor* inNeighborVisitor)
+{
+	outCosts.Init(MAX_flt, inTargets.Num());
+
+	const int32 startIndex = inGrid.GetNodeIndex(inStart);
+	if (startIndex == INDEX_NONE || !inParams.IsInsideBounds(inStart) || inTargets.Num() == 0)
+	{
+		return 0;
+	}
+
+	// 목표 셀 인덱스 (격자 밖이거나 영역 밖 목표는 도달 불가로 처리)
+	FSearchSlotLookup targetSlots;
+	int32 remainingTargets = 0;
+	for (const FIntVector& target : inTargets)
+	{
+		const int32 targetIndex = inParams.IsInsideBounds(target) ? inGrid.GetNodeIndex(target) : INDEX_NONE;
+		targetSlots.Add(targetIndex);
+		remainingTargets += targetIndex != INDEX_NONE ? 1 : 0;
+	}
+
+	FZonePathSearchScratchScope scratchScope(static_cast<int32>(inGrid.GetCellCount()));
+	FZonePathSearchScratch& scratch = scratchScope.Get();
+
+	const FOpenEntryPredicate openPredicate;
+	const FSearchNeighborVisitor searchVisitor(inGrid, inParams, inNeighborVisitor);
+	const FZonePathNeighborVisitor& neighborVisitor = searchVisitor.Get();
+
+	scratch.gScores[startIndex] = 0.0f;
+	scratch.parentIndices[startIndex] = INDEX_NONE;
+	scratch.visitStamps[startIndex] = scratch.currentStamp;
+	scratch.openHeap.HeapPush({ 0.0f, startIndex }, openPredicate);
+
+	int32 reachedCount = 0;
+	int32 expansionCount = 0;
+
+	while (scratch.openHeap.Num() > 0 && remainingTargets > 0)
+	{
+		FZonePathSearchScratch::FOpenEntry current;
+		scratch.openHeap.HeapPop(current, openPredicate, EAllowShrinking::No);
+
+		if (scratch.IsClosed(current.nodeIndex))
+		{
+			continue;
+		}
+		scratch.closedStamps[current.nodeIndex] = scratch.currentStamp;
+
+		const float currentG = scratch.gScores[current.nodeIndex];
+
+		// 같은 셀을 가리키는 목표가 여럿일 수 있으므로 셀에 묶인 슬롯 전체 확정
+		const int32 settledTargets = targetSlots.RemoveAndVisit(current.nodeIndex, [&](int32 inSlot)
+		{
+			outCosts[inSlot] = currentG;
+		});
+		remainingTargets -= settledTargets;
+		reachedCount += settledTargets;
+
+		if (++expansionCount > inParams.maxExpansions && inParams.maxExpansions > 0)
+		{
+			break;
+		}
+
+		const FIntVector currentPos = inGrid.GetGridPosition(current.nodeIndex);
+
+		neighborVisitor.VisitNeighborsBy(currentPos, current.nodeIndex,
+			[&](int32 inDirection, const FIntVector& inNeighborPos, int32 inNeighborIndex)
+		{
+			if (scratch.IsClosed(inNeighborIndex) || !IsTraversable(inGrid, inNeighborIndex) || !inParams.IsInsideBounds(inNeighborPos))
+			{
+				return;
+			}
+
+			const float tentativeG = currentG + FZonePathNeighborVisitor::GetStepLength(inDirection) * inGrid.GetMovementCostAtIndex(inNeighborIndex);
+			if (scratch.IsVisited(inNeighborIndex) && tentativeG >= scratch.gScores[inNeighborIndex])
+			{
+				return;
+			}
+
+			scratch.gScores[inNeighborIndex] = tentativeG;
+			scratch.parentIndices[inNeighborIndex] = current.nodeIndex;
+			scratch.visitStamps[inNeighborIndex] = scratch.currentStamp;
+			scratch.openHeap.HeapPush({ tentativeG, inNeighborIndex }, openPredicate);
+		});
+	}
+
+	scratch.lastExpansionCount = expansionCount;
+	return reachedCount;
+}
+
+int32 NZonePathSearch::FindCostsFromStarts(const FZonePathGrid& inGrid, const FZonePathSearchParams& inParams,
+	const FIntVector& inGoal, TConstArrayView<FIntVector> inStarts, TArray<float>& outCosts,
+	const FZonePathNeighborVisitor* inNeighborVisitor)
+{
+	outCosts.Init(MAX_flt, inStarts.Num());
+
+	const int32 goalIndex = inGrid.GetNodeIndex(inGoal);
+	if (goalIndex == INDEX_NONE || !IsTraversable(inGrid, goalIndex) || !inParams.IsInsideBounds(inGoal) || inStarts.Num() == 0)
+	{
+		return 0;
+	}
+
+	// 시작 셀 인덱스 (격자 밖이거나 영역 밖 시작점은 도달 불가로 처리)
+	FSearchSlotLookup startSlots;
+	int32 remainingStarts = 0;
+	for (const FIntVector& start : inStarts)
+	{
+		const int32 startIndex = inParams.IsInsideBounds(start) ? inGrid.GetNodeIndex(start) : INDEX_NONE;
+		startSlots.Add(startIndex);
+		remainingStarts += startIndex != INDEX_NONE ? 1 : 0;
+	}
+
+	FZonePathSearchScratchScope scratchScope(static_cast<int32>(inGrid.GetCellCount()));
+	FZonePathSearchScratch& scratch = scratchScope.Get();
+
+	const FOpenEntryPredicate openPredicate;
+	const FSearchNeighborVisitor searchVisitor(inGrid, inParams, inNeighborVisitor);
+	const FZonePathNeighborVisitor& neighborVisitor = searchVisitor.Get();
+
+	scratch.gScores[goalIndex] = 0.0f;
+	scratch.parentIndices[goalIndex] = INDEX_NONE;
+	scratch.visitStamps[goalIndex] = scratch.currentStamp;
+	scratch.openHeap.HeapPush({ 0.0f, goalIndex }, openPredicate);
+
+	int32 reachedCount = 0;
+	int32 expansionCount = 0;
+
+	while (scratch.openHeap.Num() > 0 && remainingStarts > 0)
+	{
+		FZonePathSearchScratch::FOpenEntry current;
+		scratch.openHeap.HeapPop(current, openPredicate, EAllowShrinking::No);
+
+		if (scratch.IsClosed(current.nodeIndex))
+		{
+			continue;
+		}
+		scratch.closedStamps[current.nodeIndex] = scratch.currentStamp;
+
+		const float currentG = scratch.gScores[current.nodeIndex];
+
+		const int32 settledStarts = startSlots.RemoveAndVisit(current.nodeIndex, [&](int32 inSlot)
+		{
+			outCosts[inSlot] = currentG;
+		});
+		remainingStarts -= settledStarts;
+		reachedCount += settledStarts;
+
+		// 막힌 시작 셀은 떠날 수만 있으므로 확정만 하고 더 진행하지 않음
+		if (!IsTraversable(inGrid, current.nodeIndex))
+		{
+			continue;
+		}
+
+		if (++expansionCount > inParams.maxExpansions && inParams.maxExpansions > 0)
+		{
+			break;
+		}
+
+		// 역방향 한 걸음의 비용은 정방향에서 진입하는 셀(현재 셀)의 비용
+		const FIntVector currentPos = inGrid.GetGridPosition(current.nodeIndex);
+		const float currentCost = inGrid.GetMovementCostAtIndex(current.nodeIndex);
+
+		neighborVisitor.VisitNeighborsBy(currentPos, current.nodeIndex,
+			[&](int32 inDirection, const FIntVector& inNeighborPos, int32 inNeighborIndex)
+		{
+			if (scratch.IsClosed(inNeighborIndex) || !inParams.IsInsideBounds(inNeighborPos)
+				|| (!IsTraversable(inGrid, inNeighborIndex) && !startSlots.Contains(inNeighborIndex)))
+			{
+				return;
+			}
+
+			const float tentativeG = currentG + FZonePathNeighborVisitor::GetStepLength(inDirection) * currentCost;
+			if (scratch.IsVisited(inNeighborIndex) && tentativeG >= scratch.gScores[inNeighborIndex])
+			{
+				return;
+			}
+
+			scratch.gScores[inNeighborIndex] = tentativeG;
+			scratch.parentIndices[inNeighborIndex] = current.nodeIndex;
+			scratch.visitStamps[inNeighborIndex] = scratch.currentStamp;
+			scratch.openHeap.HeapPush({ tentativeG, inNeighborIndex }, openPredicate);
+		});
+	}
+
+	scratch.lastExpansionCount = expansionCount;
+	return reachedCount;
+}
+
+int32 NZonePathSearch::FindPathsToGoal(const FZonePathGrid& inGrid, const FZonePathSearchParams& inParams,
+	const FIntVector& inGoal, TConstArrayView<FIntVector> inStarts, TArray<TArray<FIntVector>>& outPaths, TArray<float>& outCosts)
+{
+	outPaths.Reset();
+	outPaths.SetNum(inStarts.Num());
+	outCosts.Init(MAX_flt, inStarts.Num());
+
+	const int32 goalIndex = inGrid.GetNodeIndex(inGoal);
+	if (goalIndex == INDEX_NONE || !IsTraversable(inGrid, goalIndex) || !inParams.IsInsideBounds(inGoal) || inStarts.Num() == 0)
+	{
+		return 0;
+	}
+
+	// 시작 셀 인덱스 (격자 밖이거나 영역 밖 시작점은 도달 불가로 처리, 막힌 시작점은 A*처럼 떠날 수 있음)
+	FSearchSlotLookup startSlots;
+	int32 remainingStarts = 0;
+	for (const FIntVector& start : inStarts)
+	{
+		const int32 startIndex = inParams.IsInsideBounds(start) ? inGrid.GetNodeIndex(start) : INDEX_NONE;
+		startSlots.Add(startIndex);
+		remainingStarts += startIndex != INDEX_NONE ? 1 : 0;
+	}
+
+	FZonePathSearchScratchScope scratchScope(static_cast<int32>(inGrid.GetCellCount()));
+	FZonePathSearchScratch& scratch = scratchScope.Get();
+
+	const FOpenEntryPredicate openPredicate;
+	const FZonePathNeighborVisitor neighborVisitor(inGrid.gridDimensions,
+		FZonePathNeighborVisitor::MakeDirectionMask(inParams.bAllowDiagonal, inParams.bAllowVertical));
+
+	scratch.gScores[goalIndex] = 0.0f;
+	scratch.parentIndices[goalIndex] = INDEX_NONE;
+	scratch.visitStamps[goalIndex] = scratch.currentStamp;
+	scratch.openHeap.HeapPush({ 0.0f, goalIndex }, openPredicate);
+
+	int32 reachedCount = 0;
+	int32 expansionCount = 0;
+
+	while (scratch.openHeap.Num() > 0 && remainingStarts > 0)
+	{
+		FZonePathSearchScratch::FOpenEntry current;
+		scratch.openHeap.HeapPop(current, openPredicate, EAllowShrinking::No);
+
+		if (scratch.IsClosed(current.nodeIndex))
+		{
+			continue;
+		}
+		scratch.closedStamps[current.nodeIndex] = scratch.currentStamp;
+
+		const float currentG = scratch.gScores[current.nodeIndex];
+
+		// 확정된 시작점은 부모(목표 방향)를 따라가면 바로 정방향 경로가 됨 (같은 셀의 시작점은 경로 복사)
+		int32 firstSettledSlot = INDEX_NONE;
+		const int32 settledStarts = startSlots.RemoveAndVisit(current.nodeIndex, [&](int32 inSlot)
+		{
+			outCosts[inSlot] = currentG;
+			if (firstSettledSlot != INDEX_NONE)
+			{
+				outPaths[inSlot] = outPaths[firstSettledSlot];
+				return;
+			}
+
+			firstSettledSlot = inSlot;
+			for (int32 nodeIndex = current.nodeIndex; nodeIndex != INDEX_NONE; nodeIndex = scratch.parentIndices[nodeIndex])
+			{
+				outPaths[inSlot].Add(inGrid.GetGridPosition(nodeIndex));
+			}
+		});
+		remainingStarts -= settledStarts;
+		reachedCount += settledStarts;
+
+		// 막힌 시작 셀은 떠날 수만 있으므로 확정만 하고 더 진행하지 않음
+		if (!IsTraversable(inGrid, current.nodeIndex))
+		{
+			continue;
+		}
+
+		if (++expansionCount > inParams.maxExpansions && inParams.maxExpansions > 0)
+		{
+			break;
+		}
+
+		// 역방향 한 걸음의 비용은 정방향에서 진입하는 셀(현재 셀)의 비용
+		const FIntVector currentPos = inGrid.GetGridPosition(current.nodeIndex);
+		const float currentCost = inGrid.GetMovementCostAtIndex(current.nodeIndex);
+
+		neighborVisitor.VisitNeighborsBy(currentPos, current.nodeIndex,
+			[&](int32 inDirection, const FIntVector& inNeighborPos, int32 inNeighborIndex)
+		{
+			if (scratch.IsClosed(inNeighborIndex) || !inParams.IsInsideBounds(inNeighborPos)
+				|| (!IsTraversable(inGrid, inNeighborIndex) && !startSlots.Contains(inNeighborIndex)))
+			{
+				return;
+			}
+
+			const float tentativeG = currentG + FZonePathNeighborVisitor::GetStepLength(inDirection) * currentCost;
+			if (scratch.IsVisited(inNeighborIndex) && tentativeG >= scratch.gScores[inNeighborIndex])
+			{
+				return;
+			}
+
+			scratch.gScores[inNeighborIndex] = tentativeG;
+			scratch.parentIndices[inNeighborIndex] = current.nodeIndex;
+			scratch.visitStamps[inNeighborIndex] = scratch.currentStamp;
+			scratch.openHeap.HeapPush({ tentativeG, inNeighborIndex }, openPredicate);
+		});
+	}
+
+	scratch.lastExpansionCount = expansionCount;
+	return reachedCount;
+}
+
+int32 NZonePathSearch::SettleCellsFromGoal(const FZonePathGrid& inGrid, const FZonePathSearchParams& inParams,
+	const FIntVector& inGoal, TFunctionRef<void(int32, int32, float)> inOnSettled)
+{
+	const int32 goalIndex = inGrid.GetNodeIndex(inGoal);
+	if (goalIndex == INDEX_NONE || !IsTraversable(inGrid, goalIndex) || !inParams.IsInsideBounds(inGoal))
+	{
+		return 0;
+	}
+
+	FZonePathSearchScratchScope scratchScope(static_cast<int32>(inGrid.GetCellCount()));
+	FZonePathSearchScratch& scratch = scratchScope.Get();
+
+	const FOpenEntryPredicate openPredicate;
+	const FZonePathNeighborVisitor neighborVisitor(inGrid.gridDimensions,
+		FZonePathNeighborVisitor::MakeDirectionMask(inParams.bAllowDiagonal, inParams.bAllowVertical));
+
+	scratch.gScores[goalIndex] = 0.0f;
+	scratch.parentIndices[goalIndex] = INDEX_NONE;
+	scratch.visitStamps[goalIndex] = scratch.currentStamp;
+	scratch.openHeap.HeapPush({ 0.0f, goalIndex }, openPredicate);
+
+	int32 settledCount = 0;
+
+	while (scratch.openHeap.Num() > 0)
+	{
+		FZonePathSearchScratch::FOpenEntry current;
+		scratch.openHeap.HeapPop(current, openPredicate, EAllowShrinking::No);
+
+		if (scratch.IsClosed(current.nodeIndex))
+		{
+			continue;
+		}
+		scratch.closedStamps[current.nodeIndex] = scratch.currentStamp;
+
+		const float currentG = scratch.gScores[current.nodeIndex];
+		inOnSettled(current.nodeIndex, scratch.parentIndices[current.nodeIndex], currentG);
+
+		if (++settledCount > inParams.maxExpansions && inParams.maxExpansions > 0)
+		{
+			break;
+		}
+
+		// 역방향 한 걸음의 비용은 정방향에서 진입하는 셀(현재 셀)의 비용
+		const FIntVector currentPos = inGrid.GetGridPosition(current.nodeIndex);
+		const float currentCost = inGrid.GetMovementCostAtIndex(current.nodeIndex);
+
+		neighborVisitor.VisitNeighborsBy(currentPos, current.nodeIndex,
+			[&](int32 inDirection, const FIntVector& inNeighborPos, int32 inNeighborIndex)
+		{
+			if (scratch.IsClosed(inNeighborIndex) || !IsTraversable(inGrid, inNeighborIndex) || !inParams.IsInsideBounds(inNeighborPos))
+			{
+				return;
+			}
+
+			const float tentativeG = currentG + FZonePathNeighborVisitor::GetStepLength(inDirection) * currentCost;
+			if (scratch.IsVisited(inNeighborIndex) && tentativeG >= scratch.gScores[inNeighborIndex])
+			{
+				return;
+			}
+
+			scratch.gScores[inNeighborIndex] = tentativeG;
+			scratch.parentIndices[inNeighborIndex] = current.nodeIndex;
+			scratch.visitStamps[inNeighborIndex] = scratch.currentStamp;
+			scratch.openHeap.HeapPush({ tentativeG, inNeighborIndex }, openPredicate);
+		});
+	}
+
+	scratch.lastExpansionCount = settledCount;
+	return settledCount;
+}
+
+bool NZonePathSearch::FindPathJumpPoint(const FZonePathGrid& inGrid, const FZonePathSearchParams& inParams,
+	const FIntVector& inStart, const FIntVector& inGoal, TArray<FIntVector>& outPath, float& outPathCost)
+{
+	outPath.Reset();
+	outPathCost = 0.0f;
+
+	// 수직 이동 없이는 시작 층을 벗어날 수 없음
+	const int32 startIndex = inGrid.GetNodeIndex(inStart);
+	const int32 goalIndex = inGrid.GetNodeIndex(inGoal);
+	if (startIndex == INDEX_NONE || goalIndex == INDEX_NONE || inStart.Z != inGoal.Z || !IsTraversable(inGrid, goalIndex)
+		|| !inParams.IsInsideBounds(inStart) || !inParams.IsInsideBounds(inGoal))
+	{
+		return false;
+	}
+
+	FZonePathSearchScratchScope scratchScope(static_cast<int32>(inGrid.GetCellCount()));
+	FZonePathSearchScratch& scratch = scratchScope.Get();
+
+	const FJumpPointLayer layer{ inGrid, inParams, inStart.Z, inGrid.GetDefaultMovementCost(), FIntPoint(inGoal.X, inGoal.Y) };
+	const float heuristicScale = inGrid.GetMinMovementCost();
+	const FOpenEntryPredicate openPredicate;
+
+	scratch.gScores[startIndex] = 0.0f;
+	scratch.parentIndices[startIndex] = INDEX_NONE;
+	scratch.visitStamps[startIndex] = scratch.currentStamp;
+	scratch.openHeap.HeapPush({ EstimateDistance(inStart, inGoal, true) * heuristicScale, startIndex }, openPredicate);
+
+	int32 expansionCount = 0;
+	bool bFound = false;
+
+	while (scratch.openHeap.Num() > 0)
+	{
+		FZonePathSearchScratch::FOpenEntry current;
+		scratch.openHeap.HeapPop(current, openPredicate, EAllowShrinking::No);
+
+		if (scratch.IsClosed(current.nodeIndex))
+		{
+			continue;
+		}
+		scratch.closedStamps[current.nodeIndex] = scratch.currentStamp;
+
+		if (current.nodeIndex == goalIndex)
+		{
+			bFound = true;
+			break;
+		}
+
+		if (++expansionCount > inParams.maxExpansions && inParams.maxExpansions > 0)
+		{
+			break;
+		}
+
+		const FIntVector currentPos = inGrid.GetGridPosition(current.nodeIndex);
+		const float currentG = scratch.gScores[current.nodeIndex];
+
+		// 탐색 방향 결정: 시작점과 비균일 영역은 8방향 전체, 그 외에는 진행 방향의 자연/강제 이웃만
+		TArray<FIntPoint, TInlineAllocator<8>> directions;
+		const int32 parentIndex = scratch.parentIndices[current.nodeIndex];
+		if (parentIndex == INDEX_NONE || !layer.IsInUniformRegion(currentPos.X, currentPos.Y))
+		{
+			for (int32 directionY = -1; directionY <= 1; ++directionY)
+			{
+				for (int32 directionX = -1; directionX <= 1; ++directionX)
+				{
+					if (directionX != 0 || directionY != 0)
+					{
+						directions.Add(FIntPoint(directionX, directionY));
+					}
+				}
+			}
+		}
+		else
+		{
+			const FIntVector parentPos = inGrid.GetGridPosition(parentIndex);
+			const int32 dirX = FMath::Sign(currentPos.X - parentPos.X);
+			const int32 dirY = FMath::Sign(currentPos.Y - parentPos.Y);
+
+			if (dirX != 0 && dirY != 0)
+			{
+				directions.Add(FIntPoint(dirX, 0));
+				directions.Add(FIntPoint(0, dirY));
+				directions.Add(FIntPoint(dirX, dirY));
+				if (!layer.IsOpen(currentPos.X - dirX, currentPos.Y))
+				{
+					directions.Add(FIntPoint(-dirX, dirY));
+				}
+				if (!layer.IsOpen(currentPos.X, currentPos.Y - dirY))
+				{
+					directions.Add(FIntPoint(dirX, -dirY));
+				}
+			}
+			else if (dirX != 0)
+			{
+				directions.Add(FIntPoint(dirX, 0));
+				if (!layer.IsOpen(currentPos.X, currentPos.Y + 1))
+				{
+					directions.Add(FIntPoint(dirX, 1));
+				}
+				if (!layer.IsOpen(currentPos.X, currentPos.Y - 1))
+				{
+					directions.Add(FIntPoint(dirX, -1));
+				}
+			}
+			else
+			{
+				directions.Add(FIntPoint(0, dirY));
+				if (!layer.IsOpen(currentPos.X + 1, currentPos.Y))
+				{
+					directions.Add(FIntPoint(1, dirY));
+				}
+				if (!layer.IsOpen(currentPos.X - 1, currentPos.Y))
+				{
+					directions.Add(FIntPoint(-1, dirY));
+				}
+			}
+		}
+
+		for (const FIntPoint& direction : directions)
+		{
+			FIntPoint jumpPoint;
+			int32 stepCount = 0;
+			if (!layer.Jump(currentPos.X, currentPos.Y, direction.X, direction.Y, jumpPoint, stepCount))
+			{
+				continue;
+			}
+
+			const FIntVector jumpPos(jumpPoint.X, jumpPoint.Y, inStart.Z);
+			const int32 jumpIndex = inGrid.GetNodeIndex(jumpPos);
+			if (scratch.IsClosed(jumpIndex))
+			{
+				continue;
+			}
+
+			// 중간 셀은 모두 균일 비용이므로 구간 비용을 한 번에 계산
+			const float stepLength = (direction.X != 0 && direction.Y != 0) ? UE_SQRT_2 : 1.0f;
+			const float tentativeG = currentG
+				+ stepLength * ((stepCount - 1) * layer.uniformCost + inGrid.GetMovementCostAtIndex(jumpIndex));
+			if (scratch.IsVisited(jumpIndex) && tentativeG >= scratch.gScores[jumpIndex])
+			{
+				continue;
+			}
+
+			scratch.gScores[jumpIndex] = tentativeG;
+			scratch.parentIndices[jumpIndex] = current.nodeIndex;
+			scratch.visitStamps[jumpIndex] = scratch.currentStamp;
+
+			const float fScore = tentativeG + EstimateDistance(jumpPos, inGoal, true) * heuristicScale;
+			scratch.openHeap.HeapPush({ fScore, jumpIndex }, openPredicate);
+		}
+	}
+
+	scratch.lastExpansionCount = expansionCount;
+	if (!bFound)
+	{
+		return false;
+	}
+
+	// 점프 지점 체인을 역추적한 뒤 구간(직선/대각)마다 중간 셀을 채움
+	TArray<int32, TInlineAllocator<64>> jumpChain;
+	for (int32 nodeIndex = goalIndex; nodeIndex != INDEX_NONE; nodeIndex = scratch.parentIndices[nodeIndex])
+	{
+		jumpChain.Add(nodeIndex);
+	}
+	Algo::Reverse(jumpChain);
+
+	outPath.Add(inStart);
+	for (int32 chainIndex = 1; chainIndex < jumpChain.Num(); ++chainIndex)
+	{
+		const FIntVector segmentEnd = inGrid.GetGridPosition(jumpChain[chainIndex]);
+		const FIntVector segmentStep(FMath::Sign(segmentEnd.X - outPath.Last().X), FMath::Sign(segmentEnd.Y - outPath.Last().Y), 0);
+		while (outPath.Last() != segmentEnd)
+		{
+			outPath.Add(outPath.Last() + segmentStep);
+		}
+	}
+
+	outPathCost = scratch.gScores[goalIndex];
+	return true;
+}
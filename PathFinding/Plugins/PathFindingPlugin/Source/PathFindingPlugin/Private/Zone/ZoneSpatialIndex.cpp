@@ -0,0 +1,240 @@
+#include "Zone/ZoneSpatialIndex.h"
+
+FZoneSpatialHashGrid::FZoneSpatialHashGrid(float inCellSize)
+	: cellSize(FMath::Max(inCellSize, 1.0f))
+	, nextInsertionOrder(0)
+{
+}
+
+void FZoneSpatialHashGrid::SetCellSize(float inCellSize)
+{
+	const float newCellSize = FMath::Max(inCellSize, 1.0f);
+	if (newCellSize == cellSize)
+	{
+		return;
+	}
+
+	// 셀 좌표가 모두 바뀌므로 전체 재삽입
+	cellEntries.Reset();
+	oversizedEntries.Reset();
+	cellSize = newCellSize;
+
+	for (TSparseArray<FZoneEntry>::TIterator entryIt(zoneEntries); entryIt; ++entryIt)
+	{
+		LinkEntry(entryIt.GetIndex());
+	}
+}
+
+void FZoneSpatialHashGrid::AddZone(const FZoneIdentifier& inZoneIdentifier, const FZoneBounds& inZoneBounds)
+{
+	RemoveZone(inZoneIdentifier);
+
+	FZoneEntry newEntry;
+	newEntry.zoneIdentifier = inZoneIdentifier;
+	newEntry.zoneBounds = inZoneBounds;
+	newEntry.minCell = FIntPoint::ZeroValue;
+	newEntry.maxCell = FIntPoint::ZeroValue;
+	newEntry.insertionOrder = nextInsertionOrder++;
+	newEntry.bOversized = false;
+
+	const int32 entryIndex = zoneEntries.Add(newEntry);
+	zoneLookup.Add(inZoneIdentifier, entryIndex);
+	LinkEntry(entryIndex);
+}
+
+bool FZoneSpatialHashGrid::RemoveZone(const FZoneIdentifier& inZoneIdentifier)
+{
+	int32 entryIndex = INDEX_NONE;
+	if (!zoneLookup.RemoveAndCopyValue(inZoneIdentifier, entryIndex))
+	{
+		return false;
+	}
+
+	UnlinkEntry(entryIndex);
+	zoneEntries.RemoveAt(entryIndex);
+	return true;
+}
+
+void FZoneSpatialHashGrid::Reset()
+{
+	zoneEntries.Reset();
+	zoneLookup.Reset();
+	cellEntries.Reset();
+	oversizedEntries.Reset();
+}
+
+bool FZoneSpatialHashGrid::FindZoneContainingPoint(const FVector& inWorldPosition, FZoneIdentifier& outZone) const
+{
+	const FZoneEntry* bestEntry = nullptr;
+
+	auto TestEntry = [&](int32 inEntryIndex)
+	{
+		const FZoneEntry& entry = zoneEntries[inEntryIndex];
+		if ((!bestEntry || entry.insertionOrder < bestEntry->insertionOrder) && entry.zoneBounds.ContainsPoint(inWorldPosition))
+		{
+			bestEntry = &entry;
+		}
+	};
+
+	if (const TArray<int32>* entryIndices = cellEntries.Find(ToCell(inWorldPosition.X, inWorldPosition.Y)))
+	{
+		for (int32 entryIndex : *entryIndices)
+		{
+			TestEntry(entryIndex);
+		}
+	}
+
+	for (int32 entryIndex : oversizedEntries)
+	{
+		TestEntry(entryIndex);
+	}
+
+	if (!bestEntry)
+	{
+		return false;
+	}
+
+	outZone = bestEntry->zoneIdentifier;
+	return true;
+}
+
+void FZoneSpatialHashGrid::FindZonesInRadius(const FVector& inCenter, float inRadius, TArray<FZoneIdentifier>& outZones) const
+{
+	outZones.Reset();
+	if (inRadius < 0.0f || zoneEntries.Num() == 0)
+	{
+		return;
+	}
+
+	const float radiusSquared = inRadius * inRadius;
+	TArray<int32, TInlineAllocator<16>> matchedEntries;
+
+	auto TestEntry = [&](int32 inEntryIndex)
+	{
+		if (FVector::DistSquared(zoneEntries[inEntryIndex].zoneBounds.center, inCenter) <= radiusSquared)
+		{
+			matchedEntries.Add(inEntryIndex);
+		}
+	};
+
+	const FIntPoint queryMin = ToCell(inCenter.X - inRadius, inCenter.Y - inRadius);
+	const FIntPoint queryMax = ToCell(inCenter.X + inRadius, inCenter.Y + inRadius);
+	const int64 queryCellCount = static_cast<int64>(queryMax.X - queryMin.X + 1) * (queryMax.Y - queryMin.Y + 1);
+
+	if (queryCellCount > cellEntries.Num())
+	{
+		// 질의 범위가 점유 셀 수보다 넓으면 항목 전체 검사가 더 저렴
+		for (TSparseArray<FZoneEntry>::TConstIterator entryIt(zoneEntries); entryIt; ++entryIt)
+		{
+			TestEntry(entryIt.GetIndex());
+		}
+	}
+	else
+	{
+		for (int32 cellY = queryMin.Y; cellY <= queryMax.Y; ++cellY)
+		{
+			for (int32 cellX = queryMin.X; cellX <= queryMax.X; ++cellX)
+			{
+				const TArray<int32>* entryIndices = cellEntries.Find(FIntPoint(cellX, cellY));
+				if (!entryIndices)
+				{
+					continue;
+				}
+
+				for (int32 entryIndex : *entryIndices)
+				{
+					// 여러 셀에 걸친 존은 질의 범위 안 첫 셀에서만 검사 (중복 제거)
+					const FZoneEntry& entry = zoneEntries[entryIndex];
+					if (cellX == FMath::Max(entry.minCell.X, queryMin.X) && cellY == FMath::Max(entry.minCell.Y, queryMin.Y))
+					{
+						TestEntry(entryIndex);
+					}
+				}
+			}
+		}
+
+		for (int32 entryIndex : oversizedEntries)
+		{
+			TestEntry(entryIndex);
+		}
+	}
+
+	SortByInsertionOrder(matchedEntries);
+	for (int32 entryIndex : matchedEntries)
+	{
+		outZones.Add(zoneEntries[entryIndex].zoneIdentifier);
+	}
+}
+
+FIntPoint FZoneSpatialHashGrid::ToCell(double inX, double inY) const
+{
+	// 정수 변환 전에 범위를 제한해 거대한 반경이나 좌표에서도 셀 범위 계산이 넘치지 않도록 함
+	const double cellLimit = static_cast<double>(MAX_CELL_COORDINATE);
+	return FIntPoint(
+		FMath::FloorToInt(FMath::Clamp(inX / cellSize, -cellLimit, cellLimit)),
+		FMath::FloorToInt(FMath::Clamp(inY / cellSize, -cellLimit, cellLimit))
+	);
+}
+
+void FZoneSpatialHashGrid::LinkEntry(int32 inEntryIndex)
+{
+	FZoneEntry& entry = zoneEntries[inEntryIndex];
+	const FBox boundingBox = entry.zoneBounds.GetBoundingBox();
+
+	entry.minCell = ToCell(boundingBox.Min.X, boundingBox.Min.Y);
+	entry.maxCell = ToCell(boundingBox.Max.X, boundingBox.Max.Y);
+
+	const int64 footprint = static_cast<int64>(entry.maxCell.X - entry.minCell.X + 1) * (entry.maxCell.Y - entry.minCell.Y + 1);
+	entry.bOversized = footprint > MAX_CELLS_PER_ZONE;
+
+	if (entry.bOversized)
+	{
+		oversizedEntries.Add(inEntryIndex);
+		return;
+	}
+
+	for (int32 cellY = entry.minCell.Y; cellY <= entry.maxCell.Y; ++cellY)
+	{
+		for (int32 cellX = entry.minCell.X; cellX <= entry.maxCell.X; ++cellX)
+		{
+			cellEntries.FindOrAdd(FIntPoint(cellX, cellY)).Add(inEntryIndex);
+		}
+	}
+}
+
+void FZoneSpatialHashGrid::UnlinkEntry(int32 inEntryIndex)
+{
+	const FZoneEntry& entry = zoneEntries[inEntryIndex];
+	if (entry.bOversized)
+	{
+		oversizedEntries.RemoveSingle(inEntryIndex);
+		return;
+	}
+
+	for (int32 cellY = entry.minCell.Y; cellY <= entry.maxCell.Y; ++cellY)
+	{
+		for (int32 cellX = entry.minCell.X; cellX <= entry.maxCell.X; ++cellX)
+		{
+			const FIntPoint cell(cellX, cellY);
+			TArray<int32>* entryIndices = cellEntries.Find(cell);
+			if (!entryIndices)
+			{
+				continue;
+			}
+
+			entryIndices->RemoveSingleSwap(inEntryIndex);
+			if (entryIndices->Num() == 0)
+			{
+				cellEntries.Remove(cell);
+			}
+		}
+	}
+}
+
+void FZoneSpatialHashGrid::SortByInsertionOrder(TArray<int32, TInlineAllocator<16>>& inOutEntryIndices) const
+{
+	inOutEntryIndices.Sort([this](int32 inA, int32 inB)
+	{
+		return zoneEntries[inA].insertionOrder < zoneEntries[inB].insertionOrder;
+	});
+}
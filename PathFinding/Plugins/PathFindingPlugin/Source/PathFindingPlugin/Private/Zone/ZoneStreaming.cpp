@@ -0,0 +1,154 @@
+#include "Zone/ZoneStreaming.h"
+
+namespace
+{
+	/**
+	* @Brief Classifies a distance against load/unload shells
+	* @inDistance       : float              - Distance to zone center
+	* @inLoadDistance   : float              - Inside band radius
+	* @inUnloadDistance : float              - Outside band radius
+	* @Return           : EZoneProximityBand - Band containing the distance
+	*/
+	FORCEINLINE EZoneProximityBand ClassifyDistance(float inDistance, float inLoadDistance, float inUnloadDistance)
+	{
+		if (inDistance <= inLoadDistance)
+		{
+			return EZoneProximityBand::Inside;
+		}
+		return inDistance > inUnloadDistance ? EZoneProximityBand::Outside : EZoneProximityBand::Hysteresis;
+	}
+}
+
+FZoneProximityTracker::FZoneProximityTracker()
+	: odometer(0.0)
+	, lastPosition(FVector::ZeroVector)
+	, bHasPosition(false)
+	, nextWakeGeneration(1)
+	, lastEvaluatedCount(0)
+{
+}
+
+void FZoneProximityTracker::AddZone(const FZoneIdentifier& inZoneIdentifier, const FVector& inCenter, float inLoadDistance, float inUnloadDistance)
+{
+	RemoveZone(inZoneIdentifier);
+
+	FZoneEntry newEntry;
+	newEntry.zoneIdentifier = inZoneIdentifier;
+	newEntry.center = inCenter;
+	newEntry.loadDistance = FMath::Max(0.0f, inLoadDistance);
+	newEntry.unloadDistance = FMath::Max(newEntry.loadDistance, inUnloadDistance);
+	newEntry.band = EZoneProximityBand::Outside;
+	newEntry.bForceReport = true;
+	newEntry.wakeGeneration = 0;
+
+	const int32 entryIndex = zoneEntries.Add(newEntry);
+	zoneLookup.Add(inZoneIdentifier, entryIndex);
+
+	// 다음 갱신에서 즉시 평가
+	ScheduleWake(entryIndex, odometer);
+}
+
+bool FZoneProximityTracker::RemoveZone(const FZoneIdentifier& inZoneIdentifier)
+{
+	int32 entryIndex = INDEX_NONE;
+	if (!zoneLookup.RemoveAndCopyValue(inZoneIdentifier, entryIndex))
+	{
+		return false;
+	}
+
+	// 힙에 남은 항목은 세대 불일치로 무시됨
+	zoneEntries.RemoveAt(entryIndex);
+	return true;
+}
+
+void FZoneProximityTracker::Reset()
+{
+	zoneEntries.Reset();
+	zoneLookup.Reset();
+	wakeHeap.Reset();
+	odometer = 0.0;
+	lastPosition = FVector::ZeroVector;
+	bHasPosition = false;
+	lastEvaluatedCount = 0;
+}
+
+void FZoneProximityTracker::InvalidateAll()
+{
+	wakeHeap.Reset();
+	for (TSparseArray<FZoneEntry>::TIterator entryIt(zoneEntries); entryIt; ++entryIt)
+	{
+		entryIt->bForceReport = true;
+		ScheduleWake(entryIt.GetIndex(), odometer);
+	}
+}
+
+void FZoneProximityTracker::Update(const FVector& inPosition, TArray<FZoneProximityTransition>& outTransitions)
+{
+	outTransitions.Reset();
+
+	if (bHasPosition)
+	{
+		odometer += FVector::Dist(inPosition, lastPosition);
+	}
+	lastPosition = inPosition;
+	bHasPosition = true;
+
+	auto WakePredicate = [](const FWakeEntry& inA, const FWakeEntry& inB)
+	{
+		return inA.wakeOdometer < inB.wakeOdometer;
+	};
+
+	// 깨어날 때가 된 존만 꺼냄 (평가 후 재등록은 루프 밖에서 하여 같은 갱신 내 재평가 방지)
+	TArray<int32, TInlineAllocator<32>> dueEntries;
+	while (wakeHeap.Num() > 0 && wakeHeap.HeapTop().wakeOdometer <= odometer)
+	{
+		FWakeEntry wakeEntry;
+		wakeHeap.HeapPop(wakeEntry, WakePredicate, EAllowShrinking::No);
+
+		if (zoneEntries.IsValidIndex(wakeEntry.entryIndex) && zoneEntries[wakeEntry.entryIndex].wakeGeneration == wakeEntry.generation)
+		{
+			dueEntries.Add(wakeEntry.entryIndex);
+		}
+	}
+
+	for (int32 entryIndex : dueEntries)
+	{
+		FZoneEntry& entry = zoneEntries[entryIndex];
+		const float distance = FVector::Dist(inPosition, entry.center);
+		const EZoneProximityBand newBand = ClassifyDistance(distance, entry.loadDistance, entry.unloadDistance);
+
+		if (entry.bForceReport || newBand != entry.band)
+		{
+			outTransitions.Add({ entry.zoneIdentifier, entry.band, newBand, distance });
+			entry.band = newBand;
+			entry.bForceReport = false;
+		}
+
+		// 가장 가까운 경계까지의 거리만큼 이동하기 전에는 대역이 바뀔 수 없음
+		const float slack = FMath::Min(FMath::Abs(distance - entry.loadDistance), FMath::Abs(distance - entry.unloadDistance));
+		ScheduleWake(entryIndex, odometer + FMath::Max(slack, MIN_WAKE_SLACK));
+	}
+
+	lastEvaluatedCount = dueEntries.Num();
+}
+
+EZoneProximityBand FZoneProximityTracker::GetBand(const FZoneIdentifier& inZoneIdentifier) const
+{
+	const int32* entryIndexPtr = zoneLookup.Find(inZoneIdentifier);
+	if (!entryIndexPtr || zoneEntries[*entryIndexPtr].bForceReport)
+	{
+		return EZoneProximityBand::Outside;
+	}
+	return zoneEntries[*entryIndexPtr].band;
+}
+
+void FZoneProximityTracker::ScheduleWake(int32 inEntryIndex, double inWakeOdometer)
+{
+	FZoneEntry& entry = zoneEntries[inEntryIndex];
+	entry.wakeGeneration = nextWakeGeneration++;
+
+	wakeHeap.HeapPush({ inWakeOdometer, inEntryIndex, entry.wakeGeneration }, [](const FWakeEntry& inA, const FWakeEntry& inB)
+	{
+		return inA.wakeOdometer < inB.wakeOdometer;
+	});
+}
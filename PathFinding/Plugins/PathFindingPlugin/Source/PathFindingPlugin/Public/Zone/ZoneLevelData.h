@@ -113,6 +113,22 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Path Settings")
 	TArray<FName> blockedActorTags;
 
+	/** @Brief Storage backend for the zone path grid (Auto picks by grid volume and occupancy) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Path Settings")
+	EZonePathGridStorage gridStorage;
+
+	/** @Brief Algorithm used for point-to-point path queries (A* by default; JumpPoint is opt-in) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Path Settings")
+	EZonePathSearchMode searchMode;
+
+	/** @Brief Spread collision baking across frames instead of generating in one call */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Path Settings")
+	bool bTimeSlicedGeneration;
+
+	/** @Brief Collision bake time allowed per frame in microseconds (time-sliced generation) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Path Settings", meta = (ClampMin = "100.0", ClampMax = "100000.0"))
+	float generationBudgetMicroseconds;
+
 	/**
 	* @Brief Default constructor with standard pathfinding settings
 	*/
@@ -122,6 +138,10 @@ public:
 		, bAllowDiagonalMovement(true)
 		, bAllowVerticalMovement(false)
 		, gridCellSize(100.0f)
+		, gridStorage(EZonePathGridStorage::Auto)
+		, searchMode(EZonePathSearchMode::AStar)
+		, bTimeSlicedGeneration(false)
+		, generationBudgetMicroseconds(2000.0f)
 	{}
 };
 
@@ -236,6 +256,10 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Zone Properties")
 	float unloadDistance;
 
+	/** @Brief Estimated memory of the loaded level in MB (charged against the manager memory budget) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Zone Properties", meta = (ClampMin = "0.0"))
+	float estimatedLevelMemoryMB;
+
 	/** @Brief Enable debug visualization for this zone */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Debug")
 	bool bShowDebugInfo;
@@ -251,6 +275,7 @@ public:
 		, bPersistent(false)
 		, loadDistance(2000.0f)
 		, unloadDistance(3000.0f)
+		, estimatedLevelMemoryMB(64.0f)
 		, bShowDebugInfo(false)
 	{}
 
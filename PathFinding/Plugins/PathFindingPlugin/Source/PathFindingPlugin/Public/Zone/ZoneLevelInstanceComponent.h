@@ -109,6 +109,18 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Path Finding")
 	UZonePathScoreCache* GetPathScoreCache() const { return compPathScoreCache; }
 
+	/**
+	* @Brief Replaces the path cache (e.g. with one reused from the manager pool)
+	* @inPathScoreCache : UZonePathScoreCache* - Cache to use (nullptr creates a new one on next setup)
+	*/
+	void SetPathScoreCache(UZonePathScoreCache* inPathScoreCache);
+
+	/**
+	* @Brief Detaches the path cache from this component so it can outlive it
+	* @Return : UZonePathScoreCache* - Detached cache or nullptr
+	*/
+	UZonePathScoreCache* DetachPathScoreCache();
+
 	/**
 	* @Brief Generates pathfinding cache for loaded zone
 	*/
@@ -224,6 +236,13 @@ protected:
 	UFUNCTION()
 	void OnLevelUnloaded();
 
+	/**
+	* @Brief Forwards time-sliced generation completion as OnZonePathCacheReady
+	* @inZoneID : FZoneIdentifier - Zone whose grid finished generating
+	*/
+	UFUNCTION()
+	void OnPathCacheGenerationCompleted(const FZoneIdentifier& inZoneID);
+
 	/**
 	* @Brief Sets new loading state and broadcasts change
 	* @inNewState : EZoneLoadState - New loading state
@@ -4,11 +4,15 @@
 #include "GameFramework/Actor.h"
 #include "Zone/ZoneTypes.h"
 #include "Zone/ZoneLevelData.h"
+#include "Zone/ZonePathHierarchy.h"
+#include "Zone/ZoneSpatialIndex.h"
+#include "Zone/ZoneStreaming.h"
 #include "ZoneManager.generated.h"
 
 #pragma region Forward_Declare
 class UDataTable;
 class UZoneLevelInstanceComponent;
+class UZonePathScoreCache;
 struct FZoneLevelData;
 struct FZoneConnectionPoint;
 #pragma endregion Forward_Declare
@@ -53,6 +57,50 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Zone Manager Settings")
 	float cacheSaveInterval;
 
+	/** @Brief Cluster edge length in cells for the hierarchical path graph */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Zone Manager Settings", meta = (ClampMin = "2", ClampMax = "256"))
+	int32 hierarchyClusterSize;
+
+	/** @Brief Cell edge length of the zone spatial index in world units */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Zone Manager Settings", meta = (ClampMin = "100.0"))
+	float spatialIndexCellSize;
+
+	/** @Brief Seconds of estimated arrival time that one point of zone priority outweighs */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Zone Manager Settings", meta = (ClampMin = "0.0"))
+	float loadPrioritySeconds;
+
+	/** @Brief Assumed approach speed for zones the player is not moving towards (cm/s) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Zone Manager Settings", meta = (ClampMin = "1.0"))
+	float minimumApproachSpeed;
+
+	/** @Brief Load zones ahead of streaming sources from their velocity and active route */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Zone Manager Settings")
+	bool bEnablePrefetch;
+
+	/** @Brief Seconds of extrapolated source movement checked for prefetch */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Zone Manager Settings", meta = (ClampMin = "0.0", ClampMax = "30.0"))
+	float prefetchLookaheadSeconds;
+
+	/** @Brief Number of upcoming zones prefetched along an active route */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Zone Manager Settings", meta = (ClampMin = "0", ClampMax = "16"))
+	int32 prefetchRouteZoneCount;
+
+	/** @Brief Memory budget for resident zone levels and path caches in MB (0 = unlimited) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Zone Manager Settings", meta = (ClampMin = "0.0"))
+	float memoryBudgetMB;
+
+	/** @Brief Path caches of unregistered zones kept for reuse when the zone is registered again */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Zone Manager Settings", meta = (ClampMin = "0", ClampMax = "256"))
+	int32 pathCachePoolSize;
+
+	/** @Brief Decode zone cache files on worker threads when initializing from a DataTable */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Zone Manager Settings")
+	bool bWarmLoadZoneCaches;
+
+	/** @Brief Most caches installed by the startup warm-load (0 = unlimited); the rest are decoded when their zone loads */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Zone Manager Settings", meta = (ClampMin = "0"))
+	int32 warmLoadZoneCacheLimit;
+
 	/**
 	* @Brief Default constructor with standard settings
 	*/
@@ -63,9 +111,195 @@ public:
 		, maxConcurrentLoads(3)
 		, bSaveZoneCachesToDisk(true)
 		, cacheSaveInterval(300.0f)
+		, hierarchyClusterSize(FZonePathClusterGraph::DEFAULT_CLUSTER_SIZE)
+		, spatialIndexCellSize(FZoneSpatialHashGrid::DEFAULT_CELL_SIZE)
+		, loadPrioritySeconds(5.0f)
+		, minimumApproachSpeed(100.0f)
+		, bEnablePrefetch(true)
+		, prefetchLookaheadSeconds(3.0f)
+		, prefetchRouteZoneCount(2)
+		, memoryBudgetMB(0.0f)
+		, pathCachePoolSize(8)
+		, bWarmLoadZoneCaches(true)
+		, warmLoadZoneCacheLimit(64)
+	{}
+};
+
+/**
+* @Brief Queued zone load with its scheduling key
+*
+* Requests are kept in a binary heap ordered by loadScore (lowest first): the smallest
+* estimated time for a streaming source to reach the zone divided by the source weight,
+* minus priority weighted by FZoneManagerSettings::loadPrioritySeconds
+*/
+USTRUCT(BlueprintType)
+struct PATHFINDINGPLUGIN_API FZoneLoadRequest
+{
+	GENERATED_BODY()
+
+public:
+	/** @Brief Zone to load */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Zone Loading")
+	FZoneIdentifier zoneIdentifier;
+
+	/** @Brief Zone priority (FZoneLevelData::priority) */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Zone Loading")
+	int32 priority;
+
+	/** @Brief Distance from the most urgent streaming source to the zone center at last scoring */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Zone Loading")
+	float distance;
+
+	/** @Brief Estimated seconds until the most urgent streaming source reaches the zone center */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Zone Loading")
+	float timeToArrival;
+
+	/** @Brief Heap key (lower loads first) */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Zone Loading")
+	float loadScore;
+
+	/** @Brief Requested by LoadZone rather than proximity (never cancelled by distance) */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Zone Loading")
+	bool bExplicit;
+
+	/** @Brief Monotonic enqueue order (tie breaker) */
+	uint64 sequence;
+
+	FZoneLoadRequest()
+		: priority(0)
+		, distance(0.0f)
+		, timeToArrival(0.0f)
+		, loadScore(0.0f)
+		, bExplicit(false)
+		, sequence(0)
 	{}
 };
 
+/**
+* @Brief Resident zone memory against FZoneManagerSettings::memoryBudgetMB
+*
+* Level memory is the FZoneLevelData::estimatedLevelMemoryMB of every loaded or loading
+* zone; cache memory is the measured footprint of every path cache still allocated
+*/
+USTRUCT(BlueprintType)
+struct PATHFINDINGPLUGIN_API FZoneMemoryUsage
+{
+	GENERATED_BODY()
+
+public:
+	/** @Brief Estimated bytes of loaded or loading zone levels */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Zone Memory")
+	int64 levelBytes;
+
+	/** @Brief Measured bytes of allocated path caches */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Zone Memory")
+	int64 cacheBytes;
+
+	/** @Brief Configured budget in bytes (0 = unlimited) */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Zone Memory")
+	int64 budgetBytes;
+
+	/** @Brief Zones whose level is loaded or loading */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Zone Memory")
+	int32 residentZoneCount;
+
+	/** @Brief Zones whose path cache holds a generated grid */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Zone Memory")
+	int32 cachedZoneCount;
+
+	/** @Brief Zone levels unloaded to meet the budget */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Zone Memory")
+	int32 evictedZoneCount;
+
+	/** @Brief Path caches released to meet the budget */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Zone Memory")
+	int32 evictedCacheCount;
+
+	FZoneMemoryUsage()
+		: levelBytes(0)
+		, cacheBytes(0)
+		, budgetBytes(0)
+		, residentZoneCount(0)
+		, cachedZoneCount(0)
+		, evictedZoneCount(0)
+		, evictedCacheCount(0)
+	{}
+
+	/**
+	* @Brief Gets level and cache bytes combined
+	* @Return : int64 - Total resident bytes
+	*/
+	int64 GetTotalBytes() const { return levelBytes + cacheBytes; }
+
+	/**
+	* @Brief Checks whether usage exceeds a non-zero budget
+	* @Return : bool - True if over budget
+	*/
+	bool IsOverBudget() const { return budgetBytes > 0 && GetTotalBytes() > budgetBytes; }
+};
+
+/**
+* @Brief Path cache parked in the manager pool after its zone was unregistered
+*
+* The pool is keyed by zone identifier and the entry is only handed back when the
+* cache's level content hash still matches the zone being registered, so a stale
+* grid is never reused
+*/
+USTRUCT()
+struct PATHFINDINGPLUGIN_API FZonePathCachePoolEntry
+{
+	GENERATED_BODY()
+
+public:
+	/** @Brief Pooled cache (owned by the manager) */
+	UPROPERTY()
+	TObjectPtr<UZonePathScoreCache> cache;
+
+	/** @Brief World time the cache entered the pool (oldest is dropped first) */
+	double releaseTime;
+
+	FZonePathCachePoolEntry()
+		: cache(nullptr)
+		, releaseTime(0.0)
+	{}
+};
+
+/**
+* @Brief Outgoing edge of the zone adjacency graph
+*/
+struct FZoneAdjacencyEdge
+{
+	/** @Brief Neighboring zone */
+	FZoneIdentifier targetZone;
+
+	/** @Brief Cheapest transition cost among connections to the neighbor */
+	float transitionCost;
+};
+
+/**
+* @Brief Cache snapshot a zone cluster graph was built from
+*/
+struct FZonePathGraphSource
+{
+	/** @Brief Cache that published the snapshot */
+	TWeakObjectPtr<const UZonePathScoreCache> cache;
+
+	/** @Brief Snapshot version the graph was built from */
+	uint32 snapshotVersion = 0;
+};
+
+/**
+* @Brief Single-source shortest path tree over the zone adjacency graph
+*/
+struct FZoneRouteTree
+{
+	/** @Brief Accumulated transition cost from the source per reachable zone */
+	TMap<FZoneIdentifier, float> routeCosts;
+
+	/** @Brief Predecessor on the cheapest route per reachable zone (source excluded) */
+	TMap<FZoneIdentifier, FZoneIdentifier> previousZones;
+};
+
 /**
 * @Brief Central zone management actor for world-wide zone coordination
 *
@@ -190,7 +424,130 @@ public:
 	* @inPosition : FVector - Player world position
 	*/
 	UFUNCTION(BlueprintCallable, Category = "Zone Management")
-	void SetPlayerPosition(const FVector& inPosition) { playerPosition = inPosition; }
+	void SetPlayerPosition(const FVector& inPosition) { UpdateStreamingSource(DEFAULT_STREAMING_SOURCE, inPosition); }/*modify_261016_: 기본 스트리밍 소스로 위치 보고*/
+
+	/**
+	* @Brief Registers or reconfigures a streaming source
+	* @inSourceName     : FName - Unique source name
+	* @inWeight         : float - Load urgency multiplier
+	* @inInterestRadius : float - Distance added to zone load/unload distances for this source
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Zone Streaming")
+	void RegisterStreamingSource(FName inSourceName, float inWeight = 1.0f, float inInterestRadius = 0.0f);
+
+	/**
+	* @Brief Removes a streaming source and releases every zone it held
+	* @inSourceName : FName - Source name
+	* @Return       : bool  - True if the source was registered
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Zone Streaming")
+	bool UnregisterStreamingSource(FName inSourceName);
+
+	/**
+	* @Brief Reports a streaming source position (registers the source with defaults if unknown)
+	* @inSourceName : FName   - Source name
+	* @inPosition   : FVector - Source world position
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Zone Streaming")
+	void UpdateStreamingSource(FName inSourceName, const FVector& inPosition);
+
+	/**
+	* @Brief Gets every registered streaming source
+	* @Return : TArray<FZoneStreamingSource> - Sources with their last position and velocity
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Zone Streaming")
+	TArray<FZoneStreamingSource> GetStreamingSources() const;
+
+	/**
+	* @Brief Gets number of streaming sources currently holding a zone resident
+	* @inZoneIdentifier : FZoneIdentifier - Zone to query
+	* @Return           : int32           - Residency reference count
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Zone Streaming")
+	int32 GetZoneInterestCount(const FZoneIdentifier& inZoneIdentifier) const;
+
+	/**
+	* @Brief Sets the zone sequence a streaming source is travelling along (e.g. from FindZoneSequence)
+	* @inSourceName   : FName                   - Source name
+	* @inZoneSequence : TArray<FZoneIdentifier> - Zones in travel order
+	* @Return         : bool                    - True if the source is registered
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Zone Streaming")
+	bool SetStreamingSourceRoute(FName inSourceName, const TArray<FZoneIdentifier>& inZoneSequence);
+
+	/**
+	* @Brief Clears the active route of a streaming source
+	* @inSourceName : FName - Source name
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Zone Streaming")
+	void ClearStreamingSourceRoute(FName inSourceName);
+
+	/**
+	* @Brief Gets prefetch hit and waste counters
+	* @Return : FZonePrefetchStats - Counters since the last reset
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Zone Streaming")
+	FZonePrefetchStats GetPrefetchStats() const { return prefetchStats; }
+
+	/**
+	* @Brief Resets prefetch counters
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Zone Streaming")
+	void ResetPrefetchStats() { prefetchStats = FZonePrefetchStats(); }
+
+	/**
+	* @Brief Measures current zone level and path cache memory
+	* @Return : FZoneMemoryUsage - Usage, budget and eviction counters
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Zone Management")
+	FZoneMemoryUsage GetMemoryUsage() const;
+
+	/**
+	* @Brief Gets number of path caches waiting in the reuse pool
+	* @Return : int32 - Pooled cache count
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Zone Management")
+	int32 GetPooledPathCacheCount() const { return pathCachePool.Num(); }
+
+	/**
+	* @Brief Gets wall time of the last startup cache warm-load
+	* @Return : float - Seconds spent discovering, decoding and installing cache files (0 if not run)
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Zone Management")
+	float GetCacheWarmUpSeconds() const { return lastCacheWarmUpSeconds; }
+
+	/** @Brief Source driven by SetPlayerPosition and UpdateAutoLoading */
+	static const FName DEFAULT_STREAMING_SOURCE;
+
+	/**
+	* @Brief Gets smoothed player velocity estimated from position updates
+	* @Return : FVector - Player velocity (cm/s)
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Zone Management")
+	FVector GetPlayerVelocity() const { return playerVelocity; }
+
+	/**
+	* @Brief Removes a zone from the loading queue
+	* @inZoneIdentifier : FZoneIdentifier - Zone to cancel
+	* @Return           : bool            - True if the zone was queued
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Zone Management")
+	bool CancelZoneLoad(const FZoneIdentifier& inZoneIdentifier);
+
+	/**
+	* @Brief Checks whether a zone is waiting in the loading queue
+	* @inZoneIdentifier : FZoneIdentifier - Zone to test
+	* @Return           : bool            - True if queued
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Zone Management")
+	bool IsZoneLoadQueued(const FZoneIdentifier& inZoneIdentifier) const;
+
+	/**
+	* @Brief Gets number of zones waiting in the loading queue
+	* @Return : int32 - Queued zone count
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Zone Management")
+	int32 GetQueuedZoneCount() const { return loadingQueue.Num(); }
 
 	/**
 	* @Brief Gets current tracked player position
@@ -208,6 +565,70 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Path Finding")
 	TArray<FZoneConnectionPoint> FindConnectionsBetweenZones(const FZoneIdentifier& inFromZone, const FZoneIdentifier& inToZone) const;
 
+	/**
+	* @Brief Finds the cheapest sequence of zones between two zones
+	* @inFromZone       : FZoneIdentifier          - Source zone
+	* @inToZone         : FZoneIdentifier          - Target zone
+	* @outZoneSequence  : TArray<FZoneIdentifier>& - Zones from source to target inclusive
+	* @outTotalCost     : float&                   - Sum of transition costs along the sequence
+	* @Return           : bool                     - True if the target is reachable
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Path Finding")
+	bool FindZoneSequence(const FZoneIdentifier& inFromZone, const FZoneIdentifier& inToZone,
+		TArray<FZoneIdentifier>& outZoneSequence, float& outTotalCost) const;
+
+	/**
+	* @Brief Gets zones directly reachable from a zone
+	* @inZoneIdentifier : FZoneIdentifier         - Zone to query
+	* @Return           : TArray<FZoneIdentifier> - Neighboring zones
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Path Finding")
+	TArray<FZoneIdentifier> GetAdjacentZones(const FZoneIdentifier& inZoneIdentifier) const;
+
+	/**
+	* @Brief Finds a coarse cross-zone route through the hierarchical path graph
+	* @inStartPosition : FVector          - World start position
+	* @inGoalPosition  : FVector          - World goal position
+	* @outWaypoints    : TArray<FVector>& - Abstract waypoints (cluster entrances and zone connections)
+	* @Return          : bool             - True if a route was found
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Path Finding")
+	bool FindHierarchicalRoute(const FVector& inStartPosition, const FVector& inGoalPosition, TArray<FVector>& outWaypoints);
+
+	/**
+	* @Brief Finds a cross-zone route and refines every segment into cell centers
+	* @inStartPosition : FVector          - World start position
+	* @inGoalPosition  : FVector          - World goal position
+	* @outPath         : TArray<FVector>& - World positions of all route cells
+	* @Return          : bool             - True if the route was found and fully refined
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Path Finding")
+	bool FindHierarchicalPath(const FVector& inStartPosition, const FVector& inGoalPosition, TArray<FVector>& outPath);
+
+	/**
+	* @Brief Finds an abstract cross-zone route for lazy per-segment refinement
+	* @inStartPosition : FVector                  - World start position
+	* @inGoalPosition  : FVector                  - World goal position
+	* @outRoute        : FZonePathHierarchyRoute& - Abstract route
+	* @Return          : bool                     - True if a route was found
+	*/
+	bool FindZoneRoute(const FVector& inStartPosition, const FVector& inGoalPosition, FZonePathHierarchyRoute& outRoute);
+
+	/**
+	* @Brief Refines one segment of an abstract route into cell centers
+	* @inRoute        : FZonePathHierarchyRoute - Route from FindZoneRoute
+	* @inSegmentIndex : int32                   - Segment between waypoint i and i+1
+	* @outPositions   : TArray<FVector>&        - World positions (empty for zone transitions)
+	* @Return         : bool                    - True if the segment could be refined
+	*/
+	bool RefineZoneRouteSegment(const FZonePathHierarchyRoute& inRoute, int32 inSegmentIndex, TArray<FVector>& outPositions) const;
+
+	/**
+	* @Brief Gets the hierarchical path graph (as of the last route query)
+	* @Return : FZonePathHierarchy - Multi-zone abstract graph
+	*/
+	const FZonePathHierarchy& GetPathHierarchy() const { return pathHierarchy; }
+
 	/**
 	* @Brief Gets total number of managed zones
 	* @Return : int32 - Total zone count
@@ -280,22 +701,244 @@ protected:
 	FTimerHandle autoLoadTimerHandle;
 	FTimerHandle cacheSaveTimerHandle;
 
-	/** @Brief Loading queue management */
+	/** @Brief Smoothed player velocity estimated from position updates */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Player Tracking")
+	FVector playerVelocity;
+
+	/** @Brief Weight of the newest sample in the velocity moving average */
+	static constexpr float PLAYER_VELOCITY_SMOOTHING = 0.3f;
+
+	/** @Brief Loading queue management (binary heap ordered by FZoneLoadRequest::loadScore) */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Zone Loading")
-	TArray<FZoneIdentifier> loadingQueue;
+	TArray<FZoneLoadRequest> loadingQueue;/*modify_261016_: FIFO 대신 우선순위 힙*/
+
+	/** @Brief Next FZoneLoadRequest::sequence value */
+	uint64 nextLoadRequestSequence;
 
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Zone Loading")
 	TArray<FZoneIdentifier> currentlyLoading;
 
+	/** @Brief Zones in currentlyLoading whose load was started only for streaming interest (no explicit request) */
+	TSet<FZoneIdentifier> interestLoadingZones;
+
 	/** @Brief Manager initialization state */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Zone Manager")
 	bool bIsInitialized;
 
+	/** @Brief Spatial index over zone bounds for position and radius queries */
+	FZoneSpatialHashGrid zoneSpatialIndex;
+
+	/** @Brief Registered streaming sources (player position is DEFAULT_STREAMING_SOURCE) */
+	TMap<FName, FZoneStreamingSourceState> streamingSources;
+
+	/** @Brief Whether UpdateAutoLoading has fed DEFAULT_STREAMING_SOURCE at least once */
+	bool bDefaultStreamingSourceSampled;
+
+	/** @Brief Number of streaming sources holding each zone resident */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Zone Streaming")
+	TMap<FZoneIdentifier, int32> zoneInterestCounts;
+
+	/** @Brief Zones loaded by prefetch that no source has entered yet */
+	TSet<FZoneIdentifier> pendingPrefetches;
+
+	/** @Brief Prefetch effectiveness counters */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Zone Streaming")
+	FZonePrefetchStats prefetchStats;
+
+	/** @Brief Largest load distance among registered auto-loading zones (prefetch query margin) */
+	float maxAutoLoadDistance;
+
+	/** @Brief World time each zone was last wanted, loaded or unloaded (LRU eviction order) */
+	TMap<FZoneIdentifier, double> zoneLastUsedTimes;
+
+	/** @Brief Usage at the last budget check with cumulative eviction counters */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Zone Memory")
+	FZoneMemoryUsage memoryUsage;
+
+	/** @Brief Last budget check could not get under budget (prefetch is suspended) */
+	bool bMemoryBudgetExceeded;
+
+	/** @Brief Path caches of unregistered zones awaiting reuse */
+	UPROPERTY()
+	TMap<FZoneIdentifier, FZonePathCachePoolEntry> pathCachePool;
+
+	/** @Brief Released caches whose eviction waits for an in-flight save, with the zone they belonged to */
+	UPROPERTY()
+	TMap<TObjectPtr<UZonePathScoreCache>, FZoneIdentifier> deferredCacheEvictions;
+
+	/** @Brief Wall time of the last WarmLoadZoneCaches run */
+	float lastCacheWarmUpSeconds;
+
+	/** @Brief Cache files being decoded on worker threads for zones that started loading */
+	TMap<FZoneIdentifier, TFuture<FZonePathCacheLoadResult>> pendingCacheDecodes;
+
+	/** @Brief Zone adjacency built from connection points of registered zones (rebuilt on demand) */
+	mutable TMap<FZoneIdentifier, TArray<FZoneAdjacencyEdge>> zoneAdjacency;
+
+	/** @Brief Cached shortest path trees per source zone */
+	mutable TMap<FZoneIdentifier, FZoneRouteTree> zoneRouteTrees;
+
+	/** @Brief Zone adjacency must be rebuilt before the next query */
+	mutable bool bZoneAdjacencyDirty;
+
+	/** @Brief Cluster graphs of ready zones joined by zone connection links */
+	FZonePathHierarchy pathHierarchy;
+
+	/** @Brief Snapshot each zone graph in pathHierarchy was built from (for partial rebuilds) */
+	TMap<FZoneIdentifier, FZonePathGraphSource> pathGraphSources;
+
+	/** @Brief Zone links must be rebuilt before the next route query */
+	bool bPathHierarchyLinksDirty;
+
 	/**
 	* @Brief Processes zone loading queue with concurrency limits
 	*/
 	void ProcessLoadingQueue();
 
+	/**
+	* @Brief Advances every streaming source tracker and applies residency changes
+	*/
+	void UpdateStreamingInterest();
+
+	/**
+	* @Brief Updates the prefetch references of a streaming source from its velocity and route
+	* @inOutSourceState : FZoneStreamingSourceState& - Source
+	*/
+	void UpdateSourcePrefetch(FZoneStreamingSourceState& inOutSourceState);
+
+	/**
+	* @Brief Collects auto-loading zones a streaming source is predicted to need soon
+	* @inSourceState : FZoneStreamingSourceState - Source
+	* @outZones      : TSet<FZoneIdentifier>&    - Predicted zones not already held by proximity
+	*/
+	void GatherPrefetchZones(const FZoneStreamingSourceState& inSourceState, TSet<FZoneIdentifier>& outZones) const;
+
+	/**
+	* @Brief Starts tracking an auto-loading zone for a streaming source
+	* @inOutSourceState : FZoneStreamingSourceState& - Source
+	* @inZoneData       : FZoneLevelData             - Zone configuration
+	*/
+	void TrackZoneForSource(FZoneStreamingSourceState& inOutSourceState, const FZoneLevelData& inZoneData) const;
+
+	/**
+	* @Brief Adds a residency reference to a zone, queuing its load on the first reference
+	* @inZoneIdentifier : FZoneIdentifier - Zone
+	*/
+	void AcquireZoneInterest(const FZoneIdentifier& inZoneIdentifier);
+
+	/**
+	* @Brief Drops a residency reference, cancelling or unloading the zone on the last one
+	* @inZoneIdentifier : FZoneIdentifier - Zone
+	*/
+	void ReleaseZoneInterest(const FZoneIdentifier& inZoneIdentifier);
+
+	/**
+	* @Brief Marks a zone as used now for LRU eviction
+	* @inZoneIdentifier : FZoneIdentifier - Zone
+	*/
+	void TouchZone(const FZoneIdentifier& inZoneIdentifier);
+
+	/**
+	* @Brief Measures level and cache bytes of every zone
+	* @outUsage : FZoneMemoryUsage& - Receives byte and zone counts (eviction counters untouched)
+	*/
+	void MeasureMemoryUsage(FZoneMemoryUsage& outUsage) const;
+
+	/**
+	* @Brief Evicts least recently used caches and unwanted zones until usage fits the budget
+	*/
+	void EnforceMemoryBudget();
+
+	/**
+	* @Brief Saves (if enabled) and releases the grid of a path cache
+	*
+	* A cache with a save in flight is not waited on; it is parked in deferredCacheEvictions
+	* and evicted by ProcessDeferredCacheEvictions once the save has been consumed
+	* @inPathScoreCache : UZonePathScoreCache* - Cache to release
+	* @inZoneIdentifier : FZoneIdentifier      - Zone the cache belongs to (cache file name)
+	* @Return           : bool                 - True if evicted now, false if deferred
+	*/
+	bool EvictPathCache(UZonePathScoreCache* inPathScoreCache, const FZoneIdentifier& inZoneIdentifier);
+
+	/**
+	* @Brief Evicts deferred caches whose in-flight save has finished
+	*/
+	void ProcessDeferredCacheEvictions();
+
+	/**
+	* @Brief Takes a reusable cache for a zone from the pool or creates a new one
+	* @inZoneData : FZoneLevelData       - Zone being registered
+	* @Return     : UZonePathScoreCache* - Cache owned by the manager
+	*/
+	UZonePathScoreCache* AcquirePathCache(const FZoneLevelData& inZoneData);
+
+	/**
+	* @Brief Moves the generated cache of a zone being unregistered into the pool
+	* @inZoneComponent : UZoneLevelInstanceComponent* - Zone being unregistered
+	*/
+	void ReturnPathCacheToPool(UZoneLevelInstanceComponent* inZoneComponent);
+
+	/**
+	* @Brief Drops the oldest pooled caches beyond FZoneManagerSettings::pathCachePoolSize
+	*/
+	void TrimPathCachePool();
+
+	/**
+	* @Brief Loads the cache files of registered zones without a grid, decoding them in parallel
+	*
+	* Files are discovered with one directory scan and streamed in worker-sized batches,
+	* persistent and nearby zones first, each batch installed on the game thread before
+	* the next is decoded. Files whose stored level content hash no longer matches the zone
+	* are dropped, and installation stops at FZoneManagerSettings::warmLoadZoneCacheLimit
+	* or the memory budget; remaining zones are decoded when they start loading
+	* @Return : int32 - Number of caches installed
+	*/
+	int32 WarmLoadZoneCaches();
+
+	/**
+	* @Brief Starts decoding a zone's cache file on a worker thread if its cache has no grid
+	* @inZoneComponent : UZoneLevelInstanceComponent* - Zone that started loading
+	*/
+	void RequestZoneCacheDecode(UZoneLevelInstanceComponent* inZoneComponent);
+
+	/**
+	* @Brief Installs background cache decodes that have finished
+	*/
+	void ProcessPendingCacheDecodes();
+
+	/**
+	* @Brief Waits for and installs the background cache decode of a zone whose level finished loading
+	* @inZoneIdentifier : FZoneIdentifier - Zone to finish
+	*/
+	void FinishZoneCacheDecode(const FZoneIdentifier& inZoneIdentifier);
+
+	/**
+	* @Brief Installs a decoded cache file into a zone if it still has no grid and was baked from the zone's current content
+	* @inZoneComponent : UZoneLevelInstanceComponent* - Zone owning the cache
+	* @inLoadResult    : FZonePathCacheLoadResult     - Decoded file (consumed)
+	* @Return          : bool                         - True if installed
+	*/
+	bool InstallDecodedZoneCache(UZoneLevelInstanceComponent* inZoneComponent, FZonePathCacheLoadResult&& inLoadResult);
+
+	/**
+	* @Brief Adds a zone to the loading queue or updates its existing request
+	* @inZoneComponent : UZoneLevelInstanceComponent* - Zone to load
+	* @bExplicit       : bool                         - Requested directly (exempt from distance cancellation)
+	*/
+	void EnqueueZoneLoad(UZoneLevelInstanceComponent* inZoneComponent, bool bExplicit);
+
+	/**
+	* @Brief Recomputes the scheduling key of a request from the current player motion
+	* @inOutRequest    : FZoneLoadRequest&            - Request to score
+	* @inZoneComponent : UZoneLevelInstanceComponent* - Zone of the request
+	*/
+	void ScoreLoadRequest(FZoneLoadRequest& inOutRequest, const UZoneLevelInstanceComponent* inZoneComponent) const;
+
+	/**
+	* @Brief Rescores all queued requests, drops the ones no longer needed and rebuilds the heap
+	*/
+	void ReprioritizeLoadingQueue();
+
 	/**
 	* @Brief Handles zone component load state changes
 	* @inZoneID   : FZoneIdentifier - Zone that changed state
@@ -305,12 +948,54 @@ protected:
 	void OnZoneComponentLoadStateChanged(const FZoneIdentifier& inZoneID, EZoneLoadState inNewState);
 
 	/**
-	* @Brief Saves all zone caches to disk
+	* @Brief Saves all zone caches to disk (serialization and I/O on background threads)
 	*/
 	void SaveAllZoneCaches();
 
+	/**
+	* @Brief Blocks until every in-flight zone cache save has finished
+	*/
+	void WaitForZoneCacheSaves();
+
 	/**
 	* @Brief Cleans up all zone components
 	*/
 	void CleanupZoneComponents();
+
+	/**
+	* @Brief Drops the zone adjacency graph and every cached zone route
+	*/
+	void InvalidateZoneAdjacency();
+
+	/**
+	* @Brief Rebuilds zone adjacency from registered zones if invalidated
+	*/
+	void UpdateZoneAdjacency() const;
+
+	/**
+	* @Brief Gets (computing on first use) the shortest path tree rooted at a zone
+	* @inSourceZone : FZoneIdentifier - Root zone
+	* @Return       : FZoneRouteTree  - Cached tree
+	*/
+	const FZoneRouteTree& GetZoneRouteTree(const FZoneIdentifier& inSourceZone) const;
+
+	/**
+	* @Brief Rebuilds cluster graphs whose zone grid changed and refreshes zone links
+	*/
+	void UpdatePathHierarchy();
+
+	/**
+	* @Brief Rebuilds the cluster graph of one zone if its grid snapshot changed
+	*
+	* Only clusters containing cells changed since the previous graph are recomputed when
+	* the cache change log covers the gap; otherwise the whole graph is rebuilt
+	* @inZoneComponent : UZoneLevelInstanceComponent* - Zone to update
+	* @Return          : bool                         - True if the graph was added, replaced or removed
+	*/
+	bool UpdateZonePathGraph(UZoneLevelInstanceComponent* inZoneComponent);
+
+	/**
+	* @Brief Rebuilds zone links from connection points of zones that have graphs
+	*/
+	void RebuildPathHierarchyLinks();
 };
\ No newline at end of file
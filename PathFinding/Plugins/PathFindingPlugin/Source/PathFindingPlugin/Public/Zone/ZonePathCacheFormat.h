@@ -0,0 +1,265 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+#pragma region Forward_Declare
+struct FZonePathGrid;
+struct FZoneIdentifier;
+struct FZoneLevelData;
+#pragma endregion Forward_Declare
+
+/**
+* @Brief Fixed-layout header at the start of a binary zone path cache file
+*
+* All fields are little-endian plain data so the header can be validated directly
+* from a memory-mapped view. The checksum covers every header byte before it plus
+* the whole payload (node records followed by the name table)
+*/
+struct FZonePathCacheHeader
+{
+	/** @Brief File signature (FILE_MAGIC) */
+	uint32 magic;
+
+	/** @Brief Format version (FILE_VERSION) */
+	uint32 version;
+
+	/** @Brief sizeof(FZonePathCacheHeader) at write time */
+	uint32 headerSize;
+
+	/** @Brief sizeof(FZonePathCacheNodeRecord) at write time */
+	uint32 recordSize;
+
+	/** @Brief Grid dimensions in X, Y, Z */
+	int32 gridDimensions[3];
+
+	/** @Brief Size of each grid cell in world units */
+	float cellSize;
+
+	/** @Brief World position of grid origin (minimum corner) */
+	double gridOrigin[3];
+
+	/** @Brief FDateTime ticks of last grid update */
+	int64 lastUpdateTicks;
+
+	/** @Brief Owning zone ID (zone name is entry 0 of the name table) */
+	int32 zoneID;
+
+	/** @Brief Owning zone EZoneType */
+	uint8 zoneType;
+
+	/** @Brief Requested EZonePathGridStorage */
+	uint8 storageMode;
+
+	/** @Brief Whether grid had been generated */
+	uint8 bIsGenerated;
+
+	/** @Brief Reserved, written as zero */
+	uint8 reserved0;
+
+	/** @Brief Number of FZonePathCacheNodeRecord entries */
+	uint32 nodeCount;
+
+	/** @Brief Number of entries in the name table */
+	uint32 nameCount;
+
+	/** @Brief Byte offset of the first node record */
+	uint64 nodeOffset;
+
+	/** @Brief Byte offset of the name table */
+	uint64 nameTableOffset;
+
+	/** @Brief Byte size of the name table */
+	uint64 nameTableSize;
+
+	/** @Brief ComputeLevelContentHash of the inputs the grid was baked from (0 if unknown) */
+	uint32 levelContentHash;
+
+	/** @Brief CRC32 of the header up to this field followed by the payload */
+	uint32 checksum;
+};
+static_assert(sizeof(FZonePathCacheHeader) == 112, "FZonePathCacheHeader layout changed; bump FILE_VERSION");
+
+/**
+* @Brief Tightly packed per-node record in a binary zone path cache file
+*/
+struct FZonePathCacheNodeRecord
+{
+	/** @Brief Linear cell index (FZonePathGrid::GetNodeIndex) */
+	int32 cellIndex;
+
+	/** @Brief Movement cost for traversing the node */
+	float movementCost;
+
+	/** @Brief World position relative to the grid origin */
+	float localPosition[3];
+
+	/** @Brief EZonePathNodeFlags bits */
+	uint8 flags;
+
+	/** @Brief Connected zone EZoneType */
+	uint8 connectedZoneType;
+
+	/** @Brief Name table index of connected zone name (NO_NAME_INDEX if none) */
+	uint16 connectedZoneNameIndex;
+
+	/** @Brief Connected zone ID */
+	int32 connectedZoneID;
+
+	/** @Brief Reserved, written as zero */
+	uint32 reserved;
+};
+static_assert(sizeof(FZonePathCacheNodeRecord) == 32, "FZonePathCacheNodeRecord layout changed; bump FILE_VERSION");
+
+/**
+* @Brief Header at the start of an append-only delta file
+*
+* A delta file belongs to exactly one base cache file, identified by the base checksum;
+* it is followed by blocks of [uint32 recordCount][uint32 CRC32 of records][records]
+*/
+struct FZonePathCacheDeltaHeader
+{
+	/** @Brief File signature (DELTA_MAGIC) */
+	uint32 magic;
+
+	/** @Brief Format version (FILE_VERSION) */
+	uint32 version;
+
+	/** @Brief Checksum of the base cache file the deltas apply to */
+	uint32 baseChecksum;
+
+	/** @Brief sizeof(FZonePathCacheDeltaRecord) at write time */
+	uint32 recordSize;
+};
+static_assert(sizeof(FZonePathCacheDeltaHeader) == 16, "FZonePathCacheDeltaHeader layout changed; bump FILE_VERSION");
+
+/**
+* @Brief Changed cell state in a delta block
+*/
+struct FZonePathCacheDeltaRecord
+{
+	/** @Brief Linear cell index (FZonePathGrid::GetNodeIndex) */
+	int32 cellIndex;
+
+	/** @Brief New movement cost */
+	float movementCost;
+
+	/** @Brief EZonePathNodeFlags bits (only Blocked is applied) */
+	uint8 flags;
+
+	/** @Brief Reserved, written as zero */
+	uint8 reserved[3];
+};
+static_assert(sizeof(FZonePathCacheDeltaRecord) == 12, "FZonePathCacheDeltaRecord layout changed; bump FILE_VERSION");
+
+/**
+* @Brief Versioned binary persistence for FZonePathGrid
+*
+* Layout is [header][node records sorted by cell index][name table]. Files are
+* read through a memory mapping when the platform supports it and node records
+* are decoded straight from the mapped view without an intermediate copy
+*/
+namespace NZonePathCacheFormat
+{
+	/** @Brief File signature ("ZPCF") */
+	constexpr uint32 FILE_MAGIC = 0x4643505A;
+
+	/** @Brief Delta file signature ("ZPCD") */
+	constexpr uint32 DELTA_MAGIC = 0x4443505A;
+
+	/** @Brief Current format version */
+	constexpr uint32 FILE_VERSION = 2;
+
+	/** @Brief Name table index marking an unused zone name */
+	constexpr uint16 NO_NAME_INDEX = MAX_uint16;
+
+	/**
+	* @Brief Gets directory holding zone path cache files
+	* @Return : FString - Saved/PathFindingCache directory
+	*/
+	PATHFINDINGPLUGIN_API FString GetCacheDirectory();
+
+	/**
+	* @Brief Gets binary cache file path for a zone
+	* @inZoneIdentifier : FZoneIdentifier - Zone to locate
+	* @Return           : FString         - Saved/PathFindingCache/<name>_<id>.zpcache
+	*/
+	PATHFINDINGPLUGIN_API FString GetCacheFilePath(const FZoneIdentifier& inZoneIdentifier);
+
+	/**
+	* @Brief Hashes the inputs a baked grid depends on (level package and its timestamp, placement, bounds, every bake setting and connection point)
+	* @inZoneData : FZoneLevelData - Zone configuration
+	* @Return     : uint32         - Content hash (never 0)
+	*/
+	PATHFINDINGPLUGIN_API uint32 ComputeLevelContentHash(const FZoneLevelData& inZoneData);
+
+	/**
+	* @Brief Gets delta file path paired with a base cache file
+	* @inCacheFilePath : FString - Base cache file path
+	* @Return          : FString - <base path>.delta
+	*/
+	PATHFINDINGPLUGIN_API FString GetDeltaFilePath(const FString& inCacheFilePath);
+
+	/**
+	* @Brief Serializes a grid into the binary cache layout
+	* @inGrid             : FZonePathGrid  - Grid to serialize
+	* @inLevelContentHash : uint32         - Content hash the grid was baked from (0 if unknown)
+	* @outBytes           : TArray<uint8>& - Output file image (reset first)
+	* @Return             : bool           - False if the grid cannot be represented (too many names)
+	*/
+	PATHFINDINGPLUGIN_API bool WriteToBuffer(const FZonePathGrid& inGrid, uint32 inLevelContentHash, TArray<uint8>& outBytes);
+
+	/**
+	* @Brief Validates and decodes a binary cache image
+	* @inBytes             : TConstArrayView<uint8> - File image (may point into a mapped region)
+	* @outGrid             : FZonePathGrid&         - Output grid (sparse record only; caller resolves storage)
+	* @outChecksum         : uint32&                - Checksum of the image (pairs delta files with it)
+	* @outLevelContentHash : uint32&                - Content hash the grid was baked from (0 if unknown)
+	* @Return              : bool                   - True if the image is valid and current
+	*/
+	PATHFINDINGPLUGIN_API bool ReadFromMemory(TConstArrayView<uint8> inBytes, FZonePathGrid& outGrid, uint32& outChecksum,
+		uint32& outLevelContentHash);
+
+	/**
+	* @Brief Writes a grid to a binary cache file (via temporary file and rename)
+	* @inGrid             : FZonePathGrid - Grid to save
+	* @inLevelContentHash : uint32        - Content hash the grid was baked from (0 if unknown)
+	* @inFilePath         : FString       - Destination file path
+	* @outChecksum        : uint32&       - Checksum of the written file
+	* @Return             : bool          - True if the file was written
+	*/
+	PATHFINDINGPLUGIN_API bool WriteToFile(const FZonePathGrid& inGrid, uint32 inLevelContentHash, const FString& inFilePath,
+		uint32& outChecksum);
+
+	/**
+	* @Brief Reads a binary cache file, memory-mapping it when available
+	* @inFilePath          : FString        - Source file path
+	* @outGrid             : FZonePathGrid& - Output grid (sparse record only; caller resolves storage)
+	* @outChecksum         : uint32&        - Checksum of the file (pairs delta files with it)
+	* @outLevelContentHash : uint32&        - Content hash the grid was baked from (0 if unknown)
+	* @Return              : bool           - True if the file exists, is valid and current
+	*/
+	PATHFINDINGPLUGIN_API bool ReadFromFile(const FString& inFilePath, FZonePathGrid& outGrid, uint32& outChecksum,
+		uint32& outLevelContentHash);
+
+	/**
+	* @Brief Appends one block of changed cells to a delta file (creates it with a header if missing)
+	* @inGrid          : FZonePathGrid          - Grid holding the current cell states
+	* @inCellIndices   : TConstArrayView<int32> - Changed cell indices
+	* @inBaseChecksum  : uint32                 - Checksum of the base cache file
+	* @inDeltaFilePath : FString                - Delta file path
+	* @Return          : bool                   - True if the block was appended
+	*/
+	PATHFINDINGPLUGIN_API bool AppendDeltaToFile(const FZonePathGrid& inGrid, TConstArrayView<int32> inCellIndices,
+		uint32 inBaseChecksum, const FString& inDeltaFilePath);
+
+	/**
+	* @Brief Replays a delta file onto a grid loaded from its base cache file
+	* @inDeltaFilePath  : FString        - Delta file path
+	* @inBaseChecksum   : uint32         - Checksum of the loaded base cache file
+	* @inOutGrid        : FZonePathGrid& - Grid to update (before ResolveStorage)
+	* @outAppliedCount  : int32&         - Number of records applied
+	* @Return           : bool           - False if the file is stale, corrupt or has a torn tail (rewrite base to recover)
+	*/
+	PATHFINDINGPLUGIN_API bool ApplyDeltaFile(const FString& inDeltaFilePath, uint32 inBaseChecksum,
+		FZonePathGrid& inOutGrid, int32& outAppliedCount);
+}
@@ -0,0 +1,211 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Zone/ZonePathSearch.h"
+#include "Zone/ZonePathNeighbors.h"
+
+#pragma region Forward_Declare
+struct FZonePathGrid;
+#pragma endregion Forward_Declare
+
+/**
+* @Brief State of one grid cell before and after an update, used to revalidate flow fields
+*/
+struct FZonePathCellTransition
+{
+	/** @Brief Changed grid position */
+	FIntVector gridPos = FIntVector::ZeroValue;
+
+	/** @Brief Movement cost before the update */
+	float oldCost = 0.0f;
+
+	/** @Brief Movement cost after the update */
+	float newCost = 0.0f;
+
+	/** @Brief Cell was open with positive cost before the update */
+	bool bWasTraversable = false;
+
+	/** @Brief Cell is open with positive cost after the update */
+	bool bIsTraversable = false;
+};
+
+/**
+* @Brief Integration and direction field toward one goal cell of a zone grid
+*
+* Built by a single reverse Dijkstra from the goal (same step costs as NZonePathSearch),
+* so any number of agents heading to the goal can look up their next step in O(1).
+* Per cell the field keeps a direction code (offset to the next cell, 1 byte) and the
+* cost to the goal quantized to 16 bits. The field copies only the grid geometry it
+* needs, so it stays valid to sample after the grid it was built from is replaced
+*/
+class PATHFINDINGPLUGIN_API FZonePathFlowField
+{
+public:
+	/** @Brief Direction code of cells that cannot reach the goal */
+	static constexpr uint8 NO_DIRECTION = 0xFF;
+
+	/** @Brief Direction code of the goal cell (zero offset) */
+	static constexpr uint8 GOAL_DIRECTION = 13;
+
+	/** @Brief Cost code of cells that cannot reach the goal */
+	static constexpr uint16 UNREACHABLE_COST_CODE = 0xFFFF;
+
+	/** @Brief Largest cost code of a reachable cell */
+	static constexpr uint16 MAX_COST_CODE = 0xFFFE;
+
+	/**
+	* @Brief Builds the field for a goal cell
+	* @inGrid   : FZonePathGrid         - Generated grid (caller guarantees it is not mutated during the build)
+	* @inParams : FZonePathSearchParams - Neighbor and region rules (maxExpansions bounds the settled cells)
+	* @inGoal   : FIntVector            - Goal grid position
+	*/
+	FZonePathFlowField(const FZonePathGrid& inGrid, const FZonePathSearchParams& inParams, const FIntVector& inGoal);
+
+	/**
+	* @Brief Gets goal cell of the field
+	* @Return : FIntVector - Goal grid position
+	*/
+	const FIntVector& GetGoal() const { return goalGridPosition; }
+
+	/**
+	* @Brief Gets number of cells that can reach the goal
+	* @Return : int32 - Reached cell count (0 if the goal is not traversable)
+	*/
+	int32 GetReachedCellCount() const { return reachedCellCount; }
+
+	/**
+	* @Brief Checks whether a cell can reach the goal
+	* @inGridPos : FIntVector - Grid position
+	* @Return    : bool       - True if the cell has a direction toward the goal
+	*/
+	FORCEINLINE bool IsReachable(const FIntVector& inGridPos) const
+	{
+		const int32 cellIndex = GetCellIndex(inGridPos);
+		return cellIndex != INDEX_NONE && flowDirections[cellIndex] != NO_DIRECTION;
+	}
+
+	/**
+	* @Brief Gets the next cell on a cheapest path to the goal
+	* @inGridPos    : FIntVector  - Grid position
+	* @outNextCell  : FIntVector& - Next grid position (the goal itself at the goal)
+	* @Return       : bool        - True if the cell can reach the goal
+	*/
+	FORCEINLINE bool GetNextCell(const FIntVector& inGridPos, FIntVector& outNextCell) const
+	{
+		const int32 cellIndex = GetCellIndex(inGridPos);
+		if (cellIndex == INDEX_NONE || flowDirections[cellIndex] == NO_DIRECTION)
+		{
+			return false;
+		}
+		outNextCell = inGridPos + DecodeDirection(flowDirections[cellIndex]);
+		return true;
+	}
+
+	/**
+	* @Brief Gets the cost from a cell to the goal
+	* @inGridPos : FIntVector - Grid position
+	* @Return    : float      - Cost to goal rounded up to the field's cost step (MAX_flt if unreachable)
+	*/
+	FORCEINLINE float GetIntegrationCost(const FIntVector& inGridPos) const
+	{
+		const int32 cellIndex = GetCellIndex(inGridPos);
+		if (cellIndex == INDEX_NONE || integrationCostCodes[cellIndex] == UNREACHABLE_COST_CODE)
+		{
+			return MAX_flt;
+		}
+		return integrationCostCodes[cellIndex] * integrationCostStep;
+	}
+
+	/**
+	* @Brief Samples the movement direction at a world position
+	* @inWorldPos : FVector - World space position
+	* @Return     : FVector - Unit direction toward the next cell (zero at the goal or if unreachable)
+	*/
+	FVector SampleDirection(const FVector& inWorldPos) const;
+
+	/**
+	* @Brief Converts a world position to a grid position of the field's grid
+	* @inWorldPos : FVector    - World space position
+	* @Return     : FIntVector - Grid coordinates
+	*/
+	FIntVector WorldToGrid(const FVector& inWorldPos) const;
+
+	/**
+	* @Brief Checks whether a cost/blocked change at a cell can alter the field
+	*
+	* A reverse step charges the cost of the cell it leaves, so a cell's cost only feeds
+	* the neighbors that enter it. The change matters if a reached cell gets blocked, a
+	* neighbor routes through the cell, a lower cost makes the cell a cheaper route for a
+	* neighbor (tested against the quantized costs, erring toward rebuilding), or a blocked
+	* cell opens next to the reached region. Changes evaluated one by one against the same
+	* field also cover a batch of changes applied together
+	* @inTransition : FZonePathCellTransition - Cell state before and after the update
+	* @Return       : bool                    - True if the field must be rebuilt
+	*/
+	bool IsAffectedByCellChange(const FZonePathCellTransition& inTransition) const;
+
+	/**
+	* @Brief Gets heap memory held by the field
+	* @Return : SIZE_T - Allocated bytes
+	*/
+	SIZE_T GetAllocatedSize() const { return flowDirections.GetAllocatedSize() + integrationCostCodes.GetAllocatedSize(); }
+
+private:
+	/**
+	* @Brief Gets linear index of a cell (same layout as FZonePathGrid::GetNodeIndex)
+	* @inGridPos : FIntVector - Grid position
+	* @Return    : int32      - Cell index or INDEX_NONE if outside the grid
+	*/
+	FORCEINLINE int32 GetCellIndex(const FIntVector& inGridPos) const
+	{
+		if (inGridPos.X < 0 || inGridPos.X >= gridDimensions.X ||
+			inGridPos.Y < 0 || inGridPos.Y >= gridDimensions.Y ||
+			inGridPos.Z < 0 || inGridPos.Z >= gridDimensions.Z)
+		{
+			return INDEX_NONE;
+		}
+		return inGridPos.X + (inGridPos.Y * gridDimensions.X) + (inGridPos.Z * gridDimensions.X * gridDimensions.Y);
+	}
+
+	/**
+	* @Brief Decodes a direction code into a cell offset
+	* @inCode : uint8      - Code in [0, 27) as (dx + 1) + (dy + 1) * 3 + (dz + 1) * 9
+	* @Return : FIntVector - Offset to the next cell
+	*/
+	static FORCEINLINE FIntVector DecodeDirection(uint8 inCode)
+	{
+		return FIntVector(inCode % 3 - 1, (inCode / 3) % 3 - 1, inCode / 9 - 1);
+	}
+
+	/** @Brief Neighbor and region rules the field was built with */
+	FZonePathSearchParams searchParams;
+
+	/** @Brief Neighbor enumeration matching searchParams */
+	FZonePathNeighborVisitor neighborVisitor;
+
+	/** @Brief Goal cell */
+	FIntVector goalGridPosition;
+
+	/** @Brief Grid size in cells */
+	FIntVector gridDimensions;
+
+	/** @Brief World position of the grid's minimum corner */
+	FVector gridOrigin;
+
+	/** @Brief Cell edge length in world units */
+	float cellSize;
+
+	/** @Brief Cost represented by one integration cost code step */
+	float integrationCostStep;
+
+	/** @Brief Cells that can reach the goal */
+	int32 reachedCellCount;
+
+	/** @Brief Direction code per cell (NO_DIRECTION if unreachable) */
+	TArray<uint8> flowDirections;
+
+	/** @Brief Quantized cost to goal per cell (UNREACHABLE_COST_CODE if unreachable) */
+	TArray<uint16> integrationCostCodes;
+};
+
+using FZonePathFlowFieldPtr = TSharedPtr<const FZonePathFlowField, ESPMode::ThreadSafe>;
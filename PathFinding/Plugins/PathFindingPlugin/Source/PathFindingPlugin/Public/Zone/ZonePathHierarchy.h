@@ -0,0 +1,353 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Zone/ZoneTypes.h"
+#include "Zone/ZonePathSearch.h"
+#include "Zone/ZonePathScoreCache.h"
+
+/**
+* @Brief Edge between two abstract nodes of the same zone cluster graph
+*/
+struct FZonePathAbstractEdge
+{
+	/** @Brief Target node index in the owning FZonePathClusterGraph */
+	int32 targetNode;
+
+	/** @Brief Grid path cost of the edge (same units as NZonePathSearch) */
+	float cost;
+};
+
+/**
+* @Brief Abstract node of a cluster graph (cluster entrance or anchor cell)
+*/
+struct FZonePathAbstractNode
+{
+	/** @Brief Grid cell represented by the node */
+	FIntVector gridPosition;
+
+	/** @Brief Cluster containing the cell */
+	int32 clusterIndex;
+
+	/** @Brief Outgoing intra-cluster and inter-cluster edges */
+	TArray<FZonePathAbstractEdge> edges;
+};
+
+/**
+* @Brief HPA* abstraction of one zone grid
+*
+* The grid is partitioned into square XY clusters spanning every Z layer. Each run of
+* open cell pairs along a shared cluster border becomes an entrance (one node per side),
+* anchor cells such as zone connection points get their own nodes, and nodes that share
+* a cluster are linked with costs from a search confined to that cluster. The graph holds
+* the grid snapshot it was built from so abstract edges can be refined later without
+* locking the cache
+*/
+class PATHFINDINGPLUGIN_API FZonePathClusterGraph
+{
+public:
+	/** @Brief Default cluster edge length in cells */
+	static constexpr int32 DEFAULT_CLUSTER_SIZE = 16;
+
+	/** @Brief Longest border run represented by a single entrance; longer runs get one at each end */
+	static constexpr int32 MAX_SINGLE_ENTRANCE_RUN = 6;
+
+	/**
+	* @Brief Builds the abstract graph of a grid snapshot
+	* @inGrid        : FZonePathGridSnapshotPtr    - Generated grid snapshot (kept alive by the graph)
+	* @inParams      : FZonePathSearchParams       - Zone neighbor rules (region limits are ignored)
+	* @inClusterSize : int32                       - Cluster edge length in cells
+	* @inAnchorCells : TConstArrayView<FIntVector> - Cells that must become abstract nodes
+	*/
+	FZonePathClusterGraph(FZonePathGridSnapshotPtr inGrid, const FZonePathSearchParams& inParams,
+		int32 inClusterSize, TConstArrayView<FIntVector> inAnchorCells);
+
+	/**
+	* @Brief Rebuilds a graph from a previous one, recomputing only clusters that contain changed cells
+	*
+	* Entrances on borders between two unchanged clusters and intra-cluster edges of unchanged
+	* clusters whose node set is the same are copied from the previous graph
+	* @inPrevious     : FZonePathClusterGraph       - Graph of an earlier snapshot (CanUpdateIncrementally must hold)
+	* @inGrid         : FZonePathGridSnapshotPtr    - Newer snapshot of the same grid (kept alive by the graph)
+	* @inChangedCells : TConstArrayView<FIntVector> - Every cell changed between the two snapshots
+	* @inAnchorCells  : TConstArrayView<FIntVector> - Cells that must become abstract nodes
+	*/
+	FZonePathClusterGraph(const FZonePathClusterGraph& inPrevious, FZonePathGridSnapshotPtr inGrid,
+		TConstArrayView<FIntVector> inChangedCells, TConstArrayView<FIntVector> inAnchorCells);
+
+	/**
+	* @Brief Checks whether a newer snapshot can be applied by rebuilding only changed clusters
+	* @inGrid        : FZonePathGrid         - Newer grid snapshot
+	* @inParams      : FZonePathSearchParams - Zone neighbor rules for the new graph
+	* @inClusterSize : int32                 - Cluster edge length for the new graph
+	* @Return        : bool                  - True if dimensions, cost scale, rules and cluster size are unchanged
+	*/
+	bool CanUpdateIncrementally(const FZonePathGrid& inGrid, const FZonePathSearchParams& inParams, int32 inClusterSize) const;
+
+	/**
+	* @Brief Gets the grid snapshot the graph was built from
+	* @Return : FZonePathGridSnapshotPtr - Grid snapshot
+	*/
+	const FZonePathGridSnapshotPtr& GetGridSnapshot() const { return gridSnapshot; }
+
+	/**
+	* @Brief Gets the grid the graph was built from
+	* @Return : FZonePathGrid - Grid snapshot contents
+	*/
+	const FZonePathGrid& GetGrid() const { return *gridSnapshot; }
+
+	/**
+	* @Brief Gets all abstract nodes
+	* @Return : TArray<FZonePathAbstractNode> - Nodes indexed by node index
+	*/
+	const TArray<FZonePathAbstractNode>& GetNodes() const { return nodes; }
+
+	/**
+	* @Brief Gets total number of clusters
+	* @Return : int32 - Cluster count
+	*/
+	int32 GetClusterCount() const { return clusterCountX * clusterCountY; }
+
+	/**
+	* @Brief Finds the abstract node placed on a cell
+	* @inGridPos : FIntVector - Grid position
+	* @Return    : int32      - Node index or INDEX_NONE
+	*/
+	int32 FindNode(const FIntVector& inGridPos) const;
+
+	/**
+	* @Brief Gets cluster containing a cell
+	* @inGridPos : FIntVector - Grid position
+	* @Return    : int32      - Cluster index or INDEX_NONE if outside grid
+	*/
+	int32 GetClusterIndex(const FIntVector& inGridPos) const;
+
+	/**
+	* @Brief Gets inclusive cell bounds of a cluster
+	* @inClusterIndex : int32       - Cluster index
+	* @outMin         : FIntVector& - Minimum corner
+	* @outMax         : FIntVector& - Maximum corner
+	*/
+	void GetClusterBounds(int32 inClusterIndex, FIntVector& outMin, FIntVector& outMax) const;
+
+	/**
+	* @Brief Computes edges between an arbitrary cell and the nodes of its cluster
+	* @inGridPos  : FIntVector                     - Query cell (start or goal of a query)
+	* @bFromCell  : bool                           - True for cell->node costs, false for node->cell costs
+	* @outEdges   : TArray<FZonePathAbstractEdge>& - Reachable nodes with their costs
+	* @Return     : bool                           - True if the cell lies inside the grid
+	*/
+	bool ConnectCell(const FIntVector& inGridPos, bool bFromCell, TArray<FZonePathAbstractEdge>& outEdges) const;
+
+	/**
+	* @Brief Expands an abstract edge (or any two cells in the same or adjacent clusters) into grid cells
+	* @inFrom     : FIntVector          - Edge start cell
+	* @inTo       : FIntVector          - Edge end cell
+	* @outCells   : TArray<FIntVector>& - Cells from start to end inclusive
+	* @outCost    : float&              - Cost of the refined path
+	* @Return     : bool                - True if the edge could be refined
+	*/
+	bool RefineEdge(const FIntVector& inFrom, const FIntVector& inTo, TArray<FIntVector>& outCells, float& outCost) const;
+
+private:
+	/**
+	* @Brief Adds a node for a cell (or returns the existing one)
+	* @inGridPos : FIntVector - Grid position
+	* @Return    : int32      - Node index
+	*/
+	int32 FindOrAddNode(const FIntVector& inGridPos);
+
+	/**
+	* @Brief Creates entrances along the border between a cluster and its +X or +Y neighbor
+	* @inClusterX : int32 - Cluster column
+	* @inClusterY : int32 - Cluster row
+	* @bAlongX    : bool  - True for the +X border, false for the +Y border
+	*/
+	void BuildEntrances(int32 inClusterX, int32 inClusterY, bool bAlongX);
+
+	/**
+	* @Brief Links a pair of border cells in opposite clusters with single-step edges
+	* @inCellA : FIntVector - Cell in the lower cluster
+	* @inCellB : FIntVector - Adjacent cell in the upper cluster
+	*/
+	void AddEntrance(const FIntVector& inCellA, const FIntVector& inCellB);
+
+	/**
+	* @Brief Links every pair of nodes sharing a cluster with confined search costs
+	* @inClusterIndex : int32 - Cluster index
+	*/
+	void BuildIntraClusterEdges(int32 inClusterIndex);
+
+	/**
+	* @Brief Copies the intra-cluster edges of a cluster from a previous graph
+	* @inPrevious     : FZonePathClusterGraph - Graph of an earlier snapshot with the same cluster layout
+	* @inClusterIndex : int32                 - Cluster whose cells did not change
+	* @Return         : bool                  - False if the cluster node set differs (nothing is copied)
+	*/
+	bool CopyIntraClusterEdges(const FZonePathClusterGraph& inPrevious, int32 inClusterIndex);
+
+	/**
+	* @Brief Builds search parameters confined to the clusters of two cells
+	* @inA    : FIntVector - First cell
+	* @inB    : FIntVector - Second cell
+	* @Return : FZonePathSearchParams - Parameters restricted to the union of both cluster bounds
+	*/
+	FZonePathSearchParams MakeRegionParams(const FIntVector& inA, const FIntVector& inB) const;
+
+	/** @Brief Grid snapshot the graph was built from */
+	FZonePathGridSnapshotPtr gridSnapshot;
+
+	/** @Brief Zone neighbor rules */
+	FZonePathSearchParams searchParams;
+
+	/** @Brief Neighbor enumerator shared by every cell search on the grid */
+	FZonePathNeighborVisitor neighborVisitor;
+
+	/** @Brief Cluster edge length in cells */
+	int32 clusterSize;
+
+	/** @Brief Number of cluster columns */
+	int32 clusterCountX;
+
+	/** @Brief Number of cluster rows */
+	int32 clusterCountY;
+
+	/** @Brief Abstract nodes */
+	TArray<FZonePathAbstractNode> nodes;
+
+	/** @Brief Node indices per cluster */
+	TArray<TArray<int32>> clusterNodes;
+
+	/** @Brief Cell to node index lookup */
+	TMap<FIntVector, int32> nodeLookup;
+};
+
+using FZonePathClusterGraphPtr = TSharedPtr<const FZonePathClusterGraph, ESPMode::ThreadSafe>;
+
+/**
+* @Brief Point on an abstract cross-zone route
+*/
+struct FZonePathHierarchyWaypoint
+{
+	/** @Brief Zone the cell belongs to */
+	FZoneIdentifier zoneIdentifier;
+
+	/** @Brief Grid cell in that zone */
+	FIntVector gridPosition;
+
+	/** @Brief World position of the cell center */
+	FVector worldPosition;
+};
+
+/**
+* @Brief Result of an abstract search; consecutive waypoints are refined on demand
+*/
+struct FZonePathHierarchyRoute
+{
+	/** @Brief Start, abstract nodes and goal in travel order */
+	TArray<FZonePathHierarchyWaypoint> waypoints;
+
+	/** @Brief Abstract cost of the route */
+	float totalCost = 0.0f;
+
+	/**
+	* @Brief Gets number of segments between waypoints
+	* @Return : int32 - Segment count
+	*/
+	int32 GetSegmentCount() const { return FMath::Max(0, waypoints.Num() - 1); }
+
+	/**
+	* @Brief Checks whether a segment is a zone transition (no grid cells)
+	* @inSegmentIndex : int32 - Segment index
+	* @Return         : bool  - True if the segment crosses to another zone
+	*/
+	bool IsZoneTransition(int32 inSegmentIndex) const
+	{
+		return waypoints[inSegmentIndex].zoneIdentifier != waypoints[inSegmentIndex + 1].zoneIdentifier;
+	}
+};
+
+/**
+* @Brief Multi-zone abstract graph
+*
+* Joins per-zone cluster graphs through zone links built from FZoneConnectionPoint.
+* Link endpoints must be anchor cells of their zone graphs; links whose zones have
+* no graph are ignored, so unloaded zones simply drop out of route searches
+*/
+class PATHFINDINGPLUGIN_API FZonePathHierarchy
+{
+public:
+	/**
+	* @Brief Sets or replaces the cluster graph of a zone
+	* @inZoneIdentifier : FZoneIdentifier          - Zone
+	* @inGraph          : FZonePathClusterGraphPtr - Graph built from the zone grid
+	*/
+	void SetZoneGraph(const FZoneIdentifier& inZoneIdentifier, FZonePathClusterGraphPtr inGraph);
+
+	/**
+	* @Brief Removes the cluster graph of a zone
+	* @inZoneIdentifier : FZoneIdentifier - Zone
+	*/
+	void RemoveZoneGraph(const FZoneIdentifier& inZoneIdentifier);
+
+	/**
+	* @Brief Gets the cluster graph of a zone
+	* @inZoneIdentifier : FZoneIdentifier          - Zone
+	* @Return           : FZonePathClusterGraphPtr - Graph or null
+	*/
+	FZonePathClusterGraphPtr FindZoneGraph(const FZoneIdentifier& inZoneIdentifier) const;
+
+	/**
+	* @Brief Adds a directed link between anchor cells of two zones
+	* @inFromZone : FZoneIdentifier - Source zone
+	* @inFromCell : FIntVector      - Anchor cell in source zone
+	* @inToZone   : FZoneIdentifier - Target zone
+	* @inToCell   : FIntVector      - Anchor cell in target zone
+	* @inCost     : float           - Transition cost
+	* @inSpan     : float           - World distance between the link endpoints
+	*/
+	void AddZoneLink(const FZoneIdentifier& inFromZone, const FIntVector& inFromCell,
+		const FZoneIdentifier& inToZone, const FIntVector& inToCell, float inCost, float inSpan);
+
+	/**
+	* @Brief Removes all zone links
+	*/
+	void ClearZoneLinks();
+
+	/**
+	* @Brief Searches the abstract graph between two cells
+	* @inStartZone : FZoneIdentifier          - Start zone
+	* @inStartCell : FIntVector               - Start cell
+	* @inGoalZone  : FZoneIdentifier          - Goal zone
+	* @inGoalCell  : FIntVector               - Goal cell
+	* @outRoute    : FZonePathHierarchyRoute& - Abstract route
+	* @Return      : bool                     - True if a route was found
+	*/
+	bool FindRoute(const FZoneIdentifier& inStartZone, const FIntVector& inStartCell,
+		const FZoneIdentifier& inGoalZone, const FIntVector& inGoalCell, FZonePathHierarchyRoute& outRoute) const;
+
+	/**
+	* @Brief Refines one route segment into grid cells
+	* @inRoute        : FZonePathHierarchyRoute - Route returned by FindRoute
+	* @inSegmentIndex : int32                   - Segment between waypoint i and i+1
+	* @outCells       : TArray<FIntVector>&     - Cells in the segment zone (empty for zone transitions)
+	* @Return         : bool                    - True if the segment could be refined
+	*/
+	bool RefineSegment(const FZonePathHierarchyRoute& inRoute, int32 inSegmentIndex, TArray<FIntVector>& outCells) const;
+
+private:
+	/** @Brief Directed link from an anchor cell to an anchor cell of another zone */
+	struct FZoneLink
+	{
+		FIntVector fromCell;
+		FZoneIdentifier targetZone;
+		FIntVector targetCell;
+		float cost;
+		float span;
+	};
+
+	/** @Brief Cluster graphs per zone */
+	TMap<FZoneIdentifier, FZonePathClusterGraphPtr> zoneGraphs;
+
+	/** @Brief Outgoing zone links per source zone */
+	TMap<FZoneIdentifier, TArray<FZoneLink>> zoneLinks;
+};
@@ -0,0 +1,258 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/BitArray.h"
+#include "UObject/WeakObjectPtrTemplates.h"
+#include "Zone/ZonePathSearch.h"
+#include "Zone/ZonePathNeighbors.h"
+#include "Zone/ZonePathScoreCache.h"
+
+/**
+* @Brief Long-lived path that repairs itself when grid cells change (D* Lite)
+*
+* Searches backwards from the goal and keeps g/rhs values for every cell between replans.
+* The planner subscribes to UZonePathScoreCache::OnZonePathGridChangedNative; changed cells
+* only re-evaluate their neighbors, so a door closing on the route re-expands the affected
+* part of the search tree instead of the whole grid. The start may move between replans
+* (key modifier), while a new goal, a new grid, a missed change event or a lower grid
+* minimum cost restarts the search. Step costs match NZonePathSearch.
+* Per-cell state costs about 17 bytes for the zone's whole grid; create planners for
+* routes that are replanned often and drop them when the route is done.
+* Create, replan and destroy the planner on the game thread, where the cache delivers change
+* events even for updates made on other threads
+*/
+class PATHFINDINGPLUGIN_API FZonePathIncrementalPlanner
+{
+public:
+	/**
+	* @Brief Creates a planner bound to a zone cache and subscribes to its grid changes
+	* @inCache : UZonePathScoreCache - Zone cache providing grid snapshots
+	* @inStart : FIntVector          - Start grid position
+	* @inGoal  : FIntVector          - Goal grid position
+	*/
+	FZonePathIncrementalPlanner(UZonePathScoreCache* inCache, const FIntVector& inStart, const FIntVector& inGoal);
+
+	~FZonePathIncrementalPlanner();
+
+	FZonePathIncrementalPlanner(const FZonePathIncrementalPlanner&) = delete;
+	FZonePathIncrementalPlanner& operator=(const FZonePathIncrementalPlanner&) = delete;
+
+	/**
+	* @Brief Moves the start (the agent advanced); kept search state stays valid
+	* @inStart : FIntVector - New start grid position
+	*/
+	void SetStart(const FIntVector& inStart);
+
+	/**
+	* @Brief Changes the goal; the next replan starts a new search
+	* @inGoal : FIntVector - New goal grid position
+	*/
+	void SetGoal(const FIntVector& inGoal);
+
+	/**
+	* @Brief Overrides the search options taken from the cache's path settings (restarts the search)
+	* @inParams : FZonePathSearchParams - Neighbor, region and work limits (maxExpansions bounds one replan)
+	*/
+	void SetSearchParams(const FZonePathSearchParams& inParams);
+
+	/**
+	* @Brief Checks whether grid changes or a moved start are waiting for the next replan
+	* @Return : bool - True if Replan would do work
+	*/
+	bool NeedsReplan() const;
+
+	/**
+	* @Brief Repairs the search with pending changes and extracts the current path
+	* @outPath     : TArray<FIntVector>& - Cells from start to goal inclusive (reset)
+	* @outPathCost : float&              - Path cost
+	* @Return      : bool                - True if a path exists
+	*/
+	bool Replan(TArray<FIntVector>& outPath, float& outPathCost);
+
+	/**
+	* @Brief Gets cells expanded by the last replan
+	* @Return : int32 - Expansion count
+	*/
+	int32 GetLastExpansionCount() const { return lastExpansionCount; }
+
+	/**
+	* @Brief Checks whether the last replan restarted the search from scratch
+	* @Return : bool - True if the last replan was a full search
+	*/
+	bool WasLastReplanFull() const { return bLastReplanFull; }
+
+private:
+	/** @Brief Priority key of D* Lite (compared lexicographically) */
+	struct FQueueKey
+	{
+		float primary;
+		float secondary;
+
+		FORCEINLINE bool operator<(const FQueueKey& inOther) const
+		{
+			return primary < inOther.primary || (primary == inOther.primary && secondary < inOther.secondary);
+		}
+
+		FORCEINLINE bool operator==(const FQueueKey& inOther) const
+		{
+			return primary == inOther.primary && secondary == inOther.secondary;
+		}
+	};
+
+	/** @Brief Open-set heap entry (lazy deletion, valid while it matches queuedKeys) */
+	struct FQueueEntry
+	{
+		FQueueKey key;
+		int32 cellIndex;
+	};
+
+	/** @Brief Heap ordering for openHeap (lowest key first) */
+	struct FQueuePredicate
+	{
+		FORCEINLINE bool operator()(const FQueueEntry& inA, const FQueueEntry& inB) const
+		{
+			return inA.key < inB.key;
+		}
+	};
+
+	/**
+	* @Brief Handles a change event of the bound cache
+	* @inChange : FZonePathGridChange - Published cell update
+	*/
+	void HandleGridChanged(const FZonePathGridChange& inChange);
+
+	/**
+	* @Brief Restarts the search on a grid snapshot
+	* @inGrid : FZonePathGridSnapshotPtr - Generated grid snapshot
+	*/
+	void ResetSearch(FZonePathGridSnapshotPtr inGrid);
+
+	/**
+	* @Brief Computes the priority key of a cell
+	* @inIndex : int32     - Cell index
+	* @Return  : FQueueKey - Key for the current start and key modifier
+	*/
+	FQueueKey CalculateKey(int32 inIndex) const;
+
+	/**
+	* @Brief Admissible cost estimate between the start and a cell
+	* @inIndex : int32 - Cell index
+	* @Return  : float - Lower bound on the cost between them
+	*/
+	float EstimateFromStart(int32 inIndex) const;
+
+	/**
+	* @Brief Gets cost of stepping into a cell
+	* @inDirection : int32      - Neighbor direction index
+	* @inToPos     : FIntVector - Entered grid position
+	* @inToIndex   : int32      - Entered cell index
+	* @Return      : float      - Step cost or MAX_flt if the cell cannot be entered
+	*/
+	float GetStepCost(int32 inDirection, const FIntVector& inToPos, int32 inToIndex) const;
+
+	/**
+	* @Brief Checks whether a path may leave a cell (same rule as NZonePathSearch: a blocked start may still be left)
+	* @inIndex : int32 - Cell index
+	* @Return  : bool  - True if the cell is open with positive cost or is the start cell
+	*/
+	FORCEINLINE bool CanLeaveAtIndex(int32 inIndex) const
+	{
+		return (!grid->IsBlockedAtIndex(inIndex) && grid->GetMovementCostAtIndex(inIndex) > 0.0f)
+			|| inIndex == grid->GetNodeIndex(startPosition);
+	}
+
+	/**
+	* @Brief Recomputes rhs of a cell from its successors and requeues it if inconsistent
+	* @inIndex : int32 - Cell index
+	*/
+	void UpdateVertex(int32 inIndex);
+
+	/**
+	* @Brief Queues a cell with its current key, or dequeues it if consistent
+	* @inIndex : int32 - Cell index
+	*/
+	void UpdateQueue(int32 inIndex);
+
+	/**
+	* @Brief Expands cells until the start is consistent and no queued key is smaller
+	* @Return : bool - False if the expansion limit stopped the search
+	*/
+	bool ComputeShortestPath();
+
+	/**
+	* @Brief Follows cheapest successors from the start to the goal
+	* @outPath     : TArray<FIntVector>& - Cells from start to goal inclusive
+	* @outPathCost : float&              - Path cost
+	* @Return      : bool                - True if the goal was reached
+	*/
+	bool ExtractPath(TArray<FIntVector>& outPath, float& outPathCost) const;
+
+	/** @Brief Cache the planner is subscribed to */
+	TWeakObjectPtr<UZonePathScoreCache> cache;
+
+	/** @Brief Subscription to OnZonePathGridChangedNative */
+	FDelegateHandle gridChangedHandle;
+
+	/** @Brief Search options */
+	FZonePathSearchParams searchParams;
+
+	/** @Brief Grid snapshot the search state belongs to */
+	FZonePathGridSnapshotPtr grid;
+
+	/** @Brief Neighbor enumerator bound to the grid dimensions and search directions */
+	TOptional<FZonePathNeighborVisitor> neighborVisitor;
+
+	/** @Brief Heuristic scale (grid minimum movement cost when the search started) */
+	float heuristicScale;
+
+	/** @Brief Current start cell */
+	FIntVector startPosition;
+
+	/** @Brief Start cell at the last replan (key modifier reference) */
+	FIntVector lastStartPosition;
+
+	/** @Brief Goal cell */
+	FIntVector goalPosition;
+
+	/** @Brief Goal cell index in the current grid (INDEX_NONE if outside) */
+	int32 goalIndex;
+
+	/** @Brief Accumulated key modifier (km) */
+	float keyModifier;
+
+	/** @Brief Cost-to-goal estimates per cell */
+	TArray<float> gValues;
+
+	/** @Brief One-step lookahead costs per cell */
+	TArray<float> rhsValues;
+
+	/** @Brief Key each queued cell was last queued with */
+	TArray<FQueueKey> queuedKeys;
+
+	/** @Brief Whether a cell is in the open set */
+	TBitArray<> queuedFlags;
+
+	/** @Brief Binary heap of open entries */
+	TArray<FQueueEntry> openHeap;
+
+	/** @Brief Guards the pending change state written by change events */
+	mutable FCriticalSection changeMutex;
+
+	/** @Brief Cells changed since the last replan (guarded by changeMutex) */
+	TSet<FIntVector> pendingChangedCells;
+
+	/** @Brief Latest snapshot version accounted for by change events (guarded by changeMutex) */
+	uint32 notifiedVersion;
+
+	/** @Brief Whether the next replan must restart the search (guarded by changeMutex) */
+	bool bResetRequired;
+
+	/** @Brief Whether the expansion limit interrupted the last replan (resumed by the next one) */
+	bool bSearchIncomplete;
+
+	/** @Brief Cells expanded by the last replan */
+	int32 lastExpansionCount;
+
+	/** @Brief Whether the last replan was a full search */
+	bool bLastReplanFull;
+};
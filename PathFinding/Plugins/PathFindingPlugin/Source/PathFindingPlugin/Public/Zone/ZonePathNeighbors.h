@@ -0,0 +1,142 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+* @Brief Fixed-capacity neighbor list that never touches the heap allocator
+*/
+using FZonePathNeighborArray = TArray<FIntVector, TInlineAllocator<18>>;
+
+/**
+* @Brief Allocation-free neighbor enumerator bound to grid dimensions
+*
+* Direction set is the 6 direct steps followed by the 12 edge diagonals.
+* Valid directions for a cell come from a 64-entry table keyed by the cell's
+* boundary flags, so enumeration is a bit scan with no per-neighbor bounds checks.
+* Neighbor linear indices are produced from precomputed index offsets.
+*/
+struct PATHFINDINGPLUGIN_API FZonePathNeighborVisitor
+{
+public:
+	/** @Brief Number of neighbor directions (6 direct + 12 edge diagonals) */
+	static constexpr int32 DIRECTION_COUNT = 18;
+
+	/** @Brief Number of direct (single-axis) directions at the start of the table */
+	static constexpr int32 DIRECT_DIRECTION_COUNT = 6;
+
+	/** @Brief Direction mask enabling every direction */
+	static constexpr uint32 ALL_DIRECTIONS_MASK = (1u << DIRECTION_COUNT) - 1u;
+
+	/**
+	* @Brief Binds the visitor to grid dimensions and a direction filter
+	* @inGridDimensions : FIntVector - Grid size in cells
+	* @inDirectionMask  : uint32     - Enabled directions (see MakeDirectionMask)
+	*/
+	explicit FZonePathNeighborVisitor(const FIntVector& inGridDimensions, uint32 inDirectionMask = ALL_DIRECTIONS_MASK);
+
+	/**
+	* @Brief Gets a direction filter mask (looked up from a table built once)
+	* @bIncludeDiagonals : bool   - Enable two-axis steps
+	* @bIncludeVertical  : bool   - Enable steps that change Z
+	* @Return            : uint32 - Bit per enabled direction
+	*/
+	static uint32 MakeDirectionMask(bool bIncludeDiagonals, bool bIncludeVertical);
+
+	/**
+	* @Brief Gets grid offset of a direction
+	* @inDirection : int32      - Direction index [0, DIRECTION_COUNT)
+	* @Return      : FIntVector - Step offset
+	*/
+	static FORCEINLINE const FIntVector& GetDirectionOffset(int32 inDirection) { return directionOffsets[inDirection]; }
+
+	/**
+	* @Brief Gets step length of a direction in cells
+	* @inDirection : int32 - Direction index [0, DIRECTION_COUNT)
+	* @Return      : float - 1 for direct steps, sqrt(2) for diagonals
+	*/
+	static FORCEINLINE float GetStepLength(int32 inDirection) { return inDirection < DIRECT_DIRECTION_COUNT ? 1.0f : UE_SQRT_2; }
+
+	/**
+	* @Brief Gets linear index offset of a direction for the bound grid
+	* @inDirection : int32 - Direction index [0, DIRECTION_COUNT)
+	* @Return      : int32 - Offset to add to a cell index
+	*/
+	FORCEINLINE int32 GetIndexOffset(int32 inDirection) const { return indexOffsets[inDirection]; }
+
+	/**
+	* @Brief Gets the enabled direction filter
+	* @Return : uint32 - Bit per enabled direction
+	*/
+	FORCEINLINE uint32 GetDirectionMask() const { return directionMask; }
+
+	/**
+	* @Brief Checks whether the visitor can serve a search on a grid with given movement rules
+	* @inGridDimensions  : FIntVector - Grid size in cells
+	* @bIncludeDiagonals : bool       - Two-axis steps enabled by the search
+	* @bIncludeVertical  : bool       - Steps that change Z enabled by the search
+	* @Return            : bool       - True if bound to the same dimensions and directions
+	*/
+	FORCEINLINE bool Matches(const FIntVector& inGridDimensions, bool bIncludeDiagonals, bool bIncludeVertical) const
+	{
+		return maxPosition == inGridDimensions - FIntVector(1, 1, 1) && directionMask == MakeDirectionMask(bIncludeDiagonals, bIncludeVertical);
+	}
+
+	/**
+	* @Brief Computes mask of directions that stay inside the grid from a cell
+	* @inGridPos : FIntVector - Cell position (must be inside the grid)
+	* @Return    : uint32     - Bit per valid, enabled direction
+	*/
+	FORCEINLINE uint32 GetValidDirectionMask(const FIntVector& inGridPos) const
+	{
+		const uint32 boundaryCode =
+			  (inGridPos.X == 0 ? 1u : 0u)
+			| (inGridPos.X == maxPosition.X ? 2u : 0u)
+			| (inGridPos.Y == 0 ? 4u : 0u)
+			| (inGridPos.Y == maxPosition.Y ? 8u : 0u)
+			| (inGridPos.Z == 0 ? 16u : 0u)
+			| (inGridPos.Z == maxPosition.Z ? 32u : 0u);
+		return boundaryDirectionMasks[boundaryCode] & directionMask;
+	}
+
+	/**
+	* @Brief Invokes a visitor for every valid neighbor of a cell
+	* @Template    : VisitorType - Callable as (int32 inDirection, const FIntVector& inNeighborPos, int32 inNeighborIndex)
+	* @inGridPos   : FIntVector  - Cell position (must be inside the grid)
+	* @inIndex     : int32       - Linear index of the cell
+	* @inVisitor   : VisitorType - Callback per neighbor
+	*/
+	template<typename VisitorType>
+	FORCEINLINE void VisitNeighborsBy(const FIntVector& inGridPos, int32 inIndex, VisitorType&& inVisitor) const
+	{
+		uint32 validMask = GetValidDirectionMask(inGridPos);
+		while (validMask != 0)
+		{
+			const int32 direction = static_cast<int32>(FMath::CountTrailingZeros(validMask));
+			validMask &= validMask - 1;
+			inVisitor(direction, inGridPos + GetDirectionOffset(direction), inIndex + indexOffsets[direction]);
+		}
+	}
+
+	/**
+	* @Brief Collects valid neighbors into a fixed-capacity inline array
+	* @inGridPos    : FIntVector              - Cell position (must be inside the grid)
+	* @outNeighbors : FZonePathNeighborArray& - Output neighbor positions (reset first)
+	*/
+	void GetNeighbors(const FIntVector& inGridPos, FZonePathNeighborArray& outNeighbors) const;
+
+private:
+	/** @Brief Direction offsets (6 direct followed by 12 edge diagonals) */
+	static const FIntVector directionOffsets[DIRECTION_COUNT];
+
+	/** @Brief Highest valid coordinate per axis */
+	FIntVector maxPosition;
+
+	/** @Brief Enabled direction filter */
+	uint32 directionMask;
+
+	/** @Brief Linear index offset per direction for the bound grid */
+	int32 indexOffsets[DIRECTION_COUNT];
+
+	/** @Brief Shared boundary-code to valid-direction table (64 entries) */
+	const uint32* boundaryDirectionMasks;
+};
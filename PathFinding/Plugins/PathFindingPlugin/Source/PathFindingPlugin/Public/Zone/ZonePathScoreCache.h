@@ -4,14 +4,23 @@
 #include "UObject/NoExportTypes.h"
 #include "Components/ActorComponent.h"
 #include "HAL/CriticalSection.h"
+#include "Templates/SharedPointer.h"
+#include "Async/Future.h"
+#include "Containers/Ticker.h"
+#include "Containers/Queue.h"
+#include <atomic>
 #include "Zone/ZoneTypes.h"
 #include "Zone/ZoneLevelData.h"
+#include "Zone/ZonePathNeighbors.h"
+#include "Zone/ZonePathFlowField.h"
 #include "ZonePathScoreCache.generated.h"
 
 #pragma region Forward_Declare
 class UDataTable;
 class UWorld;
 struct FZoneLevelData;
+class FZonePathGridReadScope;
+struct FCollisionQueryParams;
 #pragma endregion Forward_Declare
 
 /**
@@ -97,11 +106,28 @@ public:
 	}
 };
 
+/**
+* @Brief Per-cell flag bits stored in the dense path grid layer
+*/
+enum class EZonePathNodeFlags : uint8
+{
+	None			= 0,
+	Blocked			= 1 << 0,
+	ConnectionPoint	= 1 << 1
+};
+ENUM_CLASS_FLAGS(EZonePathNodeFlags);
+
 /**
 * @Brief Zone-specific pathfinding grid data structure
 *
 * Contains complete pathfinding grid for a single zone including
-* nodes, dimensions, and spatial mapping information
+* nodes, dimensions, and spatial mapping information.
+* pathNodes is the persisted per-node record; when dense storage is active,
+* cost/flag lookups are served from packed layers indexed by GetNodeIndex:
+* a 1-bit blocked bitmap, 8-bit exact cost codes with an outlier table for costs
+* the codes cannot hold, and a connection side table.
+* Compact storage keeps only the packed layers and drops pathNodes (about
+* 1.1 bytes per cell instead of ~80 bytes per stored node)
 */
 USTRUCT(BlueprintType)
 struct PATHFINDINGPLUGIN_API FZonePathGrid
@@ -137,6 +163,58 @@ public:
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Path Grid")
 	FDateTime lastUpdateTime;
 
+	/** @Brief Requested storage backend (Auto is resolved by ResolveStorage) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Path Grid")
+	EZonePathGridStorage storageMode;
+
+	/** @Brief Blocked bitmap, one bit per GetNodeIndex (valid while bUseDenseStorage) */
+	TArray<uint32> denseBlockedBits;
+
+	/** @Brief Quantized movement costs (cost = code * costQuantizationStep, valid while bUseDenseStorage) */
+	TArray<uint8> denseCostCodes;
+
+	/** @Brief Exact costs of cells coded OUTLIER_COST_CODE (valid while bUseDenseStorage) */
+	TMap<int32, float> denseCostOutliers;
+
+	/** @Brief Connected zone per connection point cell index (valid while bUseDenseStorage) */
+	TMap<int32, FZoneIdentifier> denseConnectionCells;
+
+	/** @Brief Cost represented by one quantization code step (power of two, never above 1.0) */
+	float costQuantizationStep;
+
+	/** @Brief Whether cost/blocked lookups are served from the dense layers */
+	bool bUseDenseStorage;
+
+	/** @Brief Whether the dense layers are the only store (pathNodes released) */
+	bool bCompactStorage;
+
+	/** @Brief Lower bound of positive movement costs in the grid (heuristic scale for searches) */
+	float minMovementCost;
+
+	/** @Brief Cell sampling step of the collision bake */
+	int32 bakeSampleStep;
+
+	/** @Brief Sampled (z, y) bake rows completed so far (INDEX_NONE once the bake is complete) */
+	int32 bakedRowCount;
+
+	/** @Brief Auto storage always goes compact up to this many cells (about 1.1 bytes per cell) */
+	static constexpr int64 DENSE_AUTO_CELL_LIMIT = 1 << 22;
+
+	/** @Brief Auto storage goes compact above this occupancy (stored nodes / total cells) */
+	static constexpr float DENSE_AUTO_OCCUPANCY = 0.05f;
+
+	/** @Brief Dense storage falls back to sparse above this share of stored nodes whose cost spills to denseCostOutliers */
+	static constexpr float DENSE_MAX_OUTLIER_FRACTION = 0.25f;
+
+	/** @Brief Hard cap on dense storage volume regardless of requested mode */
+	static constexpr int64 DENSE_MAX_CELL_COUNT = 1 << 26;
+
+	/** @Brief Largest cost code stored inline */
+	static constexpr int32 MAX_COST_CODE = 254;
+
+	/** @Brief Cost code whose exact value lives in denseCostOutliers */
+	static constexpr uint8 OUTLIER_COST_CODE = 255;
+
 	/**
 	* @Brief Default constructor with empty grid state
 	*/
@@ -146,6 +224,13 @@ public:
 		, gridOrigin(FVector::ZeroVector)
 		, bIsGenerated(false)
 		, lastUpdateTime(FDateTime::Now())
+		, storageMode(EZonePathGridStorage::Auto)
+		, costQuantizationStep(1.0f)
+		, bUseDenseStorage(false)
+		, bCompactStorage(false)
+		, minMovementCost(1.0f)
+		, bakeSampleStep(1)
+		, bakedRowCount(INDEX_NONE)
 	{}
 
 	/**
@@ -155,6 +240,206 @@ public:
 	*/
 	int32 GetNodeIndex(const FIntVector& inGridPos) const;
 
+	/**
+	* @Brief Converts linear array index back to 3D grid position
+	* @inIndex : int32      - Linear index produced by GetNodeIndex
+	* @Return  : FIntVector - Corresponding grid coordinates
+	*/
+	FORCEINLINE FIntVector GetGridPosition(int32 inIndex) const
+	{
+		const int32 layerSize = gridDimensions.X * gridDimensions.Y;
+		return FIntVector(inIndex % gridDimensions.X, (inIndex % layerSize) / gridDimensions.X, inIndex / layerSize);
+	}
+
+	/**
+	* @Brief Gets total number of cells in the grid volume
+	* @Return : int64 - X * Y * Z cell count
+	*/
+	FORCEINLINE int64 GetCellCount() const { return static_cast<int64>(gridDimensions.X) * gridDimensions.Y * gridDimensions.Z; }
+
+	/**
+	* @Brief Checks blocked state of a valid linear index (no bounds check)
+	* @inIndex : int32 - Linear index produced by GetNodeIndex
+	* @Return  : bool  - True if node blocks movement
+	*/
+	FORCEINLINE bool IsBlockedAtIndex(int32 inIndex) const
+	{
+		if (bUseDenseStorage)
+		{
+			return (denseBlockedBits[inIndex >> 5] & (1u << (inIndex & 31))) != 0;
+		}
+
+		const FPathNode* nodePtr = pathNodes.Find(GetGridPosition(inIndex));
+		return nodePtr && nodePtr->bIsBlocked;
+	}
+
+	/**
+	* @Brief Gets movement cost of a valid linear index (no bounds check)
+	* @inIndex : int32 - Linear index produced by GetNodeIndex
+	* @Return  : float - Movement cost (1.0f for unstored sparse nodes)
+	*/
+	FORCEINLINE float GetMovementCostAtIndex(int32 inIndex) const
+	{
+		if (bUseDenseStorage)
+		{
+			const uint8 costCode = denseCostCodes[inIndex];
+			return costCode != OUTLIER_COST_CODE ? costCode * costQuantizationStep : denseCostOutliers.FindChecked(inIndex);
+		}
+
+		const FPathNode* nodePtr = pathNodes.Find(GetGridPosition(inIndex));
+		return nodePtr ? nodePtr->movementCost : 1.0f;
+	}
+
+	/**
+	* @Brief Gets lower bound of positive movement costs in the grid
+	* @Return : float - Minimum movement cost (never above the 1.0f default)
+	*/
+	FORCEINLINE float GetMinMovementCost() const { return minMovementCost; }
+
+	/**
+	* @Brief Gets movement cost reported for cells that were never given a cost
+	* @Return : float - 1.0f (exact in every storage mode)
+	*/
+	FORCEINLINE float GetDefaultMovementCost() const { return 1.0f; }
+
+	/**
+	* @Brief Checks if node at grid position blocks movement
+	* @inGridPos : FIntVector - Grid coordinates
+	* @Return    : bool       - True if blocked or outside the grid
+	*/
+	bool IsNodeBlockedAt(const FIntVector& inGridPos) const;
+
+	/**
+	* @Brief Gets movement cost at grid position
+	* @inGridPos : FIntVector - Grid coordinates
+	* @Return    : float      - Movement cost or FLT_MAX if outside the grid
+	*/
+	float GetMovementCostAt(const FIntVector& inGridPos) const;
+
+	/**
+	* @Brief Sets cost and blocked state of a node, keeping sparse record and dense layers in sync
+	* @inGridPos : FIntVector - Grid coordinates (must be valid)
+	* @inCost    : float      - New movement cost
+	* @bBlocked  : bool       - Whether node blocks movement
+	*/
+	void SetNodeState(const FIntVector& inGridPos, float inCost, bool bBlocked);
+
+	/**
+	* @Brief Gets number of sampled (z, y) rows the collision bake walks
+	* @Return : int32 - Row count for bakeSampleStep
+	*/
+	FORCEINLINE int32 GetBakeRowCount() const
+	{
+		return FMath::DivideAndRoundUp(gridDimensions.Y, bakeSampleStep) * FMath::DivideAndRoundUp(gridDimensions.Z, bakeSampleStep);
+	}
+
+	/**
+	* @Brief Checks whether the collision bake has covered a cell
+	* @inGridPos : FIntVector - Grid coordinates (must be valid)
+	* @Return    : bool       - True if baked or the bake is complete
+	*/
+	FORCEINLINE bool IsCellBaked(const FIntVector& inGridPos) const
+	{
+		if (bakedRowCount == INDEX_NONE)
+		{
+			return true;
+		}
+		const int32 rowsY = FMath::DivideAndRoundUp(gridDimensions.Y, bakeSampleStep);
+		return (inGridPos.Z / bakeSampleStep) * rowsY + inGridPos.Y / bakeSampleStep < bakedRowCount;
+	}
+
+	/**
+	* @Brief Resolves storageMode into the active backend and (re)builds dense layers if needed
+	*/
+	void ResolveStorage();
+
+	/**
+	* @Brief Rebuilds packed blocked/cost/connection layers from the node record (a compact grid is expanded first)
+	*/
+	void RebuildDenseLayer();
+
+	/**
+	* @Brief Releases dense layers and falls back to sparse lookups (compact state is discarded; ExpandNodeRecord first to keep it)
+	*/
+	void ReleaseDenseLayer();
+
+	/**
+	* @Brief Rebuilds pathNodes from the dense layers of a compact grid
+	*/
+	void ExpandNodeRecord();
+
+	/**
+	* @Brief Gets number of cells holding non-default state
+	* @Return : int32 - Stored node count (derived from the dense layers when compact)
+	*/
+	int32 GetStoredNodeCount() const;
+
+	/**
+	* @Brief Invokes a visitor for every cell holding non-default state
+	* @Template   : VisitorType - Callable as (const FPathNode& inNode)
+	* @inVisitor  : VisitorType - Callback per stored node (pathNodes order, or cell index order when compact)
+	*/
+	template<typename VisitorType>
+	void ForEachStoredNode(VisitorType&& inVisitor) const
+	{
+		if (!bCompactStorage)
+		{
+			for (const TPair<FIntVector, FPathNode>& nodePair : pathNodes)
+			{
+				inVisitor(nodePair.Value);
+			}
+			return;
+		}
+
+		const int32 cellCount = denseCostCodes.Num();
+		for (int32 cellIndex = 0; cellIndex < cellCount; ++cellIndex)
+		{
+			FPathNode node;
+			if (MakeNodeFromDenseLayer(cellIndex, node, true))
+			{
+				inVisitor(node);
+			}
+		}
+	}
+
+	/**
+	* @Brief Gets heap memory owned by the node record and dense layers
+	* @Return : SIZE_T - Allocated bytes
+	*/
+	SIZE_T GetAllocatedSize() const;
+
+	/**
+	* @Brief Builds a node record from the dense layers
+	* @inIndex          : int32      - Linear index produced by GetNodeIndex
+	* @outNode          : FPathNode& - Node reconstructed from bitmap, cost code and side table
+	* @bOnlyNonDefault  : bool       - Skip cells that match the default node
+	* @Return           : bool       - True if outNode was written
+	*/
+	bool MakeNodeFromDenseLayer(int32 inIndex, FPathNode& outNode, bool bOnlyNonDefault) const;
+
+	/**
+	* @Brief Encodes a movement cost as a quantization code without rounding
+	* @inCost : float - Movement cost
+	* @Return : uint8 - Code, or OUTLIER_COST_CODE if the cost is not an exact multiple of the step within range
+	*/
+	FORCEINLINE uint8 QuantizeCost(float inCost) const
+	{
+		// 단계가 2의 거듭제곱이라 나눗셈이 정확하므로 정수 여부로 무손실 표현 가능 여부 판정
+		const float scaledCost = inCost / costQuantizationStep;
+		if (!(scaledCost >= 0.0f && scaledCost <= MAX_COST_CODE) || FMath::TruncToFloat(scaledCost) != scaledCost)
+		{
+			return OUTLIER_COST_CODE;
+		}
+		return static_cast<uint8>(scaledCost);
+	}
+
+	/**
+	* @Brief Stores a movement cost in the dense layer, spilling costs the codes cannot hold exactly to denseCostOutliers
+	* @inIndex : int32 - Linear index produced by GetNodeIndex
+	* @inCost  : float - Movement cost
+	*/
+	void SetDenseCost(int32 inIndex, float inCost);
+
 	/**
 	* @Brief Converts world position to grid coordinates
 	* @inWorldPos : FVector    - World space position
@@ -187,10 +472,11 @@ public:
 
 	/**
 	* @Brief Initializes grid with zone bounds and cell size
-	* @inZoneBounds : FZoneBounds - Zone spatial boundaries
-	* @inCellSize   : float       - Size of each grid cell
+	* @inZoneBounds : FZoneBounds          - Zone spatial boundaries
+	* @inCellSize   : float                - Size of each grid cell
+	* @inStorage    : EZonePathGridStorage - Requested storage backend (default: Auto)
 	*/
-	void InitializeGrid(const FZoneBounds& inZoneBounds, float inCellSize);
+	void InitializeGrid(const FZoneBounds& inZoneBounds, float inCellSize, EZonePathGridStorage inStorage = EZonePathGridStorage::Auto);
 
 	/**
 	* @Brief Validates grid position bounds
@@ -206,13 +492,232 @@ public:
 	* @Return             : TArray     - Array of valid neighbor positions
 	*/
 	TArray<FIntVector> GetNeighbors(const FIntVector& inGridPos, bool bIncludeDiagonals = true) const;
+
+	/**
+	* @Brief Gets neighboring grid positions into a fixed-capacity inline array (no heap allocation)
+	* @inGridPos          : FIntVector              - Center grid position
+	* @outNeighbors       : FZonePathNeighborArray& - Output neighbor positions (reset first)
+	* @bIncludeDiagonals  : bool                    - Include diagonal neighbors (default: true)
+	*/
+	void GetNeighborsInline(const FIntVector& inGridPos, FZonePathNeighborArray& outNeighbors, bool bIncludeDiagonals = true) const;
+
+	/**
+	* @Brief Invokes a visitor for every valid neighbor without allocating
+	*
+	* Binds a FZonePathNeighborVisitor for this call only; search loops should build
+	* one visitor per search and call its VisitNeighborsBy directly
+	* @Template           : VisitorType - Callable as (int32 inDirection, const FIntVector& inNeighborPos, int32 inNeighborIndex)
+	* @inGridPos          : FIntVector  - Center grid position
+	* @inVisitor          : VisitorType - Callback per neighbor
+	* @bIncludeDiagonals  : bool        - Include diagonal neighbors (default: true)
+	*/
+	template<typename VisitorType>
+	void VisitNeighborsBy(const FIntVector& inGridPos, VisitorType&& inVisitor, bool bIncludeDiagonals = true) const
+	{
+		const int32 nodeIndex = GetNodeIndex(inGridPos);
+		if (nodeIndex == INDEX_NONE)
+		{
+			return;
+		}
+
+		const FZonePathNeighborVisitor neighborVisitor(gridDimensions, FZonePathNeighborVisitor::MakeDirectionMask(bIncludeDiagonals, true));
+		neighborVisitor.VisitNeighborsBy(inGridPos, nodeIndex, Forward<VisitorType>(inVisitor));
+	}
+};
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_TwoParams(FOnZonePathGenerationProgress, const FZoneIdentifier&, inZoneID, float, inProgress);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FOnZonePathGenerationCompleted, const FZoneIdentifier&, inZoneID);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnZonePathCacheSaved, const FZoneIdentifier&, inZoneID, const FString&, inFilePath, bool, bSuccess);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnZonePathGridRegionChanged, const FIntVector&, inBoundsMin, const FIntVector&, inBoundsMax, int32, inChangedCellCount);
+
+/** @Brief Immutable, reference-counted published version of a zone path grid */
+using FZonePathGridSnapshotPtr = TSharedPtr<const FZonePathGrid, ESPMode::ThreadSafe>;
+
+/**
+* @Brief Outcome of one cache save (full base rewrite or delta append)
+*/
+struct FZonePathCacheSaveResult
+{
+	/** @Brief Base cache file path */
+	FString filePath;
+
+	/** @Brief Checksum of the base file the save wrote or appended to */
+	uint32 baseChecksum = 0;
+
+	/** @Brief Number of delta records appended (delta saves only) */
+	int32 recordCount = 0;
+
+	/** @Brief Whether the base file was rewritten */
+	bool bFullSave = false;
+
+	/** @Brief Whether the write succeeded */
+	bool bSuccess = false;
+};
+
+/**
+* @Brief Cache file decoded off the game thread, ready to be installed into a cache
+*/
+struct FZonePathCacheLoadResult
+{
+	/** @Brief Base cache file path */
+	FString filePath;
+
+	/** @Brief Decoded grid with deltas replayed and storage resolved */
+	FZonePathGrid grid;
+
+	/** @Brief Read snapshot copy of grid, prepared so installation does not copy on the game thread */
+	FZonePathGridSnapshotPtr snapshot;
+
+	/** @Brief Checksum of the base file */
+	uint32 baseChecksum = 0;
+
+	/** @Brief Level content hash stored in the base file (0 if unknown) */
+	uint32 levelContentHash = 0;
+
+	/** @Brief Number of delta records replayed */
+	int32 appliedDeltaCount = 0;
+
+	/** @Brief Whether the delta file replayed cleanly (otherwise the next save rewrites the base) */
+	bool bDeltaClean = false;
+
+	/** @Brief Whether the file was valid and decoded */
+	bool bSuccess = false;
+};
+
+/**
+* @Brief Start/goal pair submitted in a path batch
+*/
+USTRUCT(BlueprintType)
+struct PATHFINDINGPLUGIN_API FZonePathQuery
+{
+	GENERATED_BODY()
+
+public:
+	/** @Brief Start grid coordinates */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Path Query")
+	FIntVector startGridPosition;
+
+	/** @Brief Goal grid coordinates */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Path Query")
+	FIntVector goalGridPosition;
+
+	FZonePathQuery()
+		: startGridPosition(FIntVector::ZeroValue)
+		, goalGridPosition(FIntVector::ZeroValue)
+	{}
+
+	/**
+	* @Brief Parameterized constructor
+	* @inStart : FIntVector - Start grid coordinates
+	* @inGoal  : FIntVector - Goal grid coordinates
+	*/
+	FZonePathQuery(const FIntVector& inStart, const FIntVector& inGoal)
+		: startGridPosition(inStart)
+		, goalGridPosition(inGoal)
+	{}
+};
+
+/**
+* @Brief Answer to one FZonePathQuery (same index as the query in its batch)
+*/
+USTRUCT(BlueprintType)
+struct PATHFINDINGPLUGIN_API FZonePathQueryResult
+{
+	GENERATED_BODY()
+
+public:
+	/** @Brief Grid cells from start to goal inclusive (empty if no path) */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Path Query")
+	TArray<FIntVector> path;
+
+	/** @Brief Accumulated path cost */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Path Query")
+	float pathCost;
+
+	/** @Brief Whether a path was found */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Path Query")
+	bool bSuccess;
+
+	FZonePathQueryResult()
+		: pathCost(0.0f)
+		, bSuccess(false)
+	{}
+};
+
+DECLARE_DELEGATE_ThreeParams(FOnZonePathBatchCompletedNative, int32 /*inBatchID*/, int32 /*inFirstQueryIndex*/, const TArray<FZonePathQueryResult>& /*inResults*/);
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnZonePathBatchCompleted, int32, inBatchID, int32, inFirstQueryIndex, const TArray<FZonePathQueryResult>&, inResults);
+
+/**
+* @Brief Finished path batch waiting for delivery on the game thread
+*/
+struct FZonePathBatchCompletion
+{
+	/** @Brief Batch id returned on submission */
+	int32 batchID = INDEX_NONE;
+
+	/** @Brief Results in query order */
+	TArray<FZonePathQueryResult> results;
+
+	/** @Brief Results already handed to the callbacks (game thread) */
+	int32 deliveredCount = 0;
+};
+
+/** @Brief Completion queue filled by batch worker tasks and drained by the game thread */
+using FZonePathBatchCompletionQueue = TQueue<FZonePathBatchCompletion, EQueueMode::Mpsc>;
+
+/**
+* @Brief Cells changed by one published grid update
+*/
+struct FZonePathGridChange
+{
+	/** @Brief Snapshot version published before the update */
+	uint32 previousSnapshotVersion = 0;
+
+	/** @Brief Snapshot version that contains the update */
+	uint32 snapshotVersion = 0;
+
+	/** @Brief Cells whose movement cost or blocked flag changed */
+	TArray<FIntVector, TInlineAllocator<1>> changedCells;
+
+	/** @Brief Inclusive minimum corner of changedCells */
+	FIntVector boundsMin = FIntVector::ZeroValue;
+
+	/** @Brief Inclusive maximum corner of changedCells */
+	FIntVector boundsMax = FIntVector::ZeroValue;
+};
+
+DECLARE_MULTICAST_DELEGATE_OneParam(FOnZonePathGridChangedNative, const FZonePathGridChange& /*inChange*/);
+
+/**
+* @Brief Cached flow field of one goal cell
+*/
+struct FZonePathFlowFieldCacheEntry
+{
+	/** @Brief Last built field, served even when stale until its rebuild lands (null until the first build finishes) */
+	FZonePathFlowFieldPtr field;
+
+	/** @Brief Snapshot version the field is known to match */
+	uint32 validSnapshotVersion = 0;
+
+	/** @Brief Rebuild running on a worker thread (at most one per goal) */
+	TSharedFuture<FZonePathFlowFieldPtr> pendingBuild;
+
+	/** @Brief Snapshot version the pending rebuild reads */
+	uint32 pendingBuildVersion = 0;
+
+	/** @Brief Last lookup time (FPlatformTime::Seconds) for least-recently-used eviction */
+	double lastAccessTime = 0.0;
 };
 
 /**
 * @Brief Zone-specific path score caching system
 *
 * Manages pathfinding grid generation, caching, and persistence
-* for a single zone with collision detection and file I/O support
+* for a single zone with collision detection and file I/O support.
+* Writers mutate pathGrid under pathGridMutex and publish an immutable snapshot;
+* queries pin the published snapshot through FZonePathGridReadScope without waiting for writers.
+* Cell updates are published lazily: the copy is made by the next read or at the end of the frame,
+* so any number of updates in between cost one grid copy
 */
 UCLASS(BlueprintType, ClassGroup=(PathFinding))
 class PATHFINDINGPLUGIN_API UZonePathScoreCache : public UObject
@@ -225,6 +730,17 @@ public:
 	*/
 	UZonePathScoreCache();
 
+	/**
+	* @Brief Stops generation, batch delivery and deferred publishing before destruction
+	*/
+	virtual void BeginDestroy() override;
+
+	/**
+	* @Brief Holds off FinishDestroy while a background save is still writing
+	* @Return : bool - False until the in-flight save has finished
+	*/
+	virtual bool IsReadyForFinishDestroy() override;
+
 	/**
 	* @Brief Initializes zone cache with zone data
 	* @inZoneData : FZoneLevelData - Zone configuration data
@@ -239,6 +755,44 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Zone Path Cache")
 	void GeneratePathGrid(const FZoneLevelData& inZoneData);
 
+	/**
+	* @Brief Starts generating the pathfinding grid across frames within pathSettings.generationBudgetMicroseconds
+	*
+	* Baked rows are published periodically; cells not baked yet report Unknown through
+	* GetNodeQueryState and IsGridGenerated stays false until OnZonePathGenerationCompleted fires
+	* @inZoneData : FZoneLevelData - Zone configuration data
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Zone Path Cache")
+	void BeginTimeSlicedGeneration(const FZoneLevelData& inZoneData);
+
+	/**
+	* @Brief Stops an in-progress time-sliced generation (partial grid stays unbaked)
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Zone Path Cache")
+	void CancelGeneration();
+
+	/**
+	* @Brief Checks whether a time-sliced generation is running
+	* @Return : bool - True while bake slices are being scheduled
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Zone Path Cache")
+	bool IsGenerating() const { return generationTickerHandle.IsValid(); }
+
+	/**
+	* @Brief Gets progress of the current generation
+	* @Return : float - Baked fraction [0, 1] (1 when generated, 0 when nothing was generated)
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Zone Path Cache")
+	float GetGenerationProgress() const;
+
+	/**
+	* @Brief Gets bake-aware state of a node
+	* @inGridPosition : FIntVector          - Grid coordinates
+	* @Return         : EZonePathQueryState - Unknown if not baked yet, otherwise Open/Blocked
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Zone Path Cache")
+	EZonePathQueryState GetNodeQueryState(const FIntVector& inGridPosition) const;
+
 	/**
 	* @Brief Updates individual path node properties
 	* @inGridPosition : FIntVector - Grid coordinates of node
@@ -248,6 +802,38 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Zone Path Cache")
 	void UpdatePathNode(const FIntVector& inGridPosition, float inNewCost, bool bBlocked = false);
 
+	/**
+	* @Brief Applies one cost/blocked state to a list of cells in a single update
+	* @inGridPositions : TArray<FIntVector> - Grid coordinates (cells outside the grid are skipped)
+	* @inNewCost       : float              - New movement cost
+	* @bBlocked        : bool               - Whether nodes should be blocked (default: false)
+	* @Return          : int32              - Number of cells updated
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Zone Path Cache")
+	int32 UpdatePathNodes(const TArray<FIntVector>& inGridPositions, float inNewCost, bool bBlocked = false);
+
+	/**
+	* @Brief Applies one cost/blocked state to every cell of an inclusive grid box in a single update
+	* @inBoxMin   : FIntVector - Minimum corner (clamped to the grid)
+	* @inBoxMax   : FIntVector - Maximum corner (clamped to the grid)
+	* @inNewCost  : float      - New movement cost
+	* @bBlocked   : bool       - Whether nodes should be blocked (default: false)
+	* @Return     : int32      - Number of cells updated
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Zone Path Cache")
+	int32 UpdatePathNodesInBox(const FIntVector& inBoxMin, const FIntVector& inBoxMax, float inNewCost, bool bBlocked = false);
+
+	/**
+	* @Brief Applies one cost/blocked state to every cell whose center lies in a world sphere, in a single update
+	* @inWorldCenter : FVector - Sphere center in world space
+	* @inRadius      : float   - Sphere radius in world units
+	* @inNewCost     : float   - New movement cost
+	* @bBlocked      : bool    - Whether nodes should be blocked (default: false)
+	* @Return        : int32   - Number of cells updated
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Zone Path Cache")
+	int32 UpdatePathNodesInSphere(const FVector& inWorldCenter, float inRadius, float inNewCost, bool bBlocked = false);
+
 	/**
 	* @Brief Gets read-only access to path node
 	* @inGridPosition : FIntVector  - Grid coordinates
@@ -260,7 +846,7 @@ public:
 	/**
 	* @Brief Checks if node is blocked for pathfinding
 	* @inGridPosition : FIntVector - Grid coordinates
-	* @Return         : bool       - True if node blocks movement
+	* @Return         : bool       - True if node blocks movement or is not baked yet
 	*/
 	UFUNCTION(BlueprintCallable, Category = "Zone Path Cache")
 	bool IsNodeBlocked(const FIntVector& inGridPosition) const;
@@ -268,7 +854,7 @@ public:
 	/**
 	* @Brief Gets movement cost for specific grid position
 	* @inGridPosition : FIntVector - Grid coordinates
-	* @Return         : float      - Movement cost or FLT_MAX if invalid
+	* @Return         : float      - Movement cost or FLT_MAX if invalid or not baked yet
 	*/
 	UFUNCTION(BlueprintCallable, Category = "Zone Path Cache")
 	float GetMovementCost(const FIntVector& inGridPosition) const;
@@ -311,6 +897,20 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Zone Path Cache")
 	bool IsGridGenerated() const { return pathGrid.bIsGenerated; }
 
+	/**
+	* @Brief Gets content hash of the level the grid was baked from
+	* @Return : uint32 - NZonePathCacheFormat::ComputeLevelContentHash at bake time (0 if unknown)
+	*/
+	uint32 GetLevelContentHash() const { return levelContentHash; }
+
+	/**
+	* @Brief Checks whether the generated grid was baked from the same level content
+	* @inZoneData : FZoneLevelData - Zone configuration about to be loaded
+	* @Return     : bool           - True if the grid can be used without a new bake
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Zone Path Cache")
+	bool CanReuseGrid(const FZoneLevelData& inZoneData) const;
+
 	/**
 	* @Brief Gets zone identifier for this cache
 	* @Return : FZoneIdentifier - Zone identifier reference
@@ -326,25 +926,259 @@ public:
 	FDateTime GetLastUpdateTime() const { return pathGrid.lastUpdateTime; }
 
 	/**
-	* @Brief Saves cache data to file for persistence
+	* @Brief Finds lowest-cost path between two grid cells (A* or Jump Point Search per pathSettings.searchMode)
+	* @inStartGridPosition : FIntVector          - Start grid coordinates
+	* @inGoalGridPosition  : FIntVector          - Goal grid coordinates
+	* @outPath             : TArray<FIntVector>& - Grid cells from start to goal inclusive
+	* @Return              : bool                - True if a path was found
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Zone Path Cache")
+	bool FindPath(const FIntVector& inStartGridPosition, const FIntVector& inGoalGridPosition, TArray<FIntVector>& outPath) const;
+
+	/**
+	* @Brief Finds lowest-cost path between two world positions (A* or Jump Point Search per pathSettings.searchMode)
+	* @inStartWorldPosition : FVector          - Start world position
+	* @inGoalWorldPosition  : FVector          - Goal world position
+	* @outWorldPath         : TArray<FVector>& - Cell centers from start to goal inclusive
+	* @Return               : bool             - True if a path was found
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Zone Path Cache")
+	bool FindPathWorld(const FVector& inStartWorldPosition, const FVector& inGoalWorldPosition, TArray<FVector>& outWorldPath) const;
+
+	/**
+	* @Brief Queues path queries for worker threads; results arrive through OnZonePathBatchCompleted in query-order slices
+	* @inQueries : TArray<FZonePathQuery> - Start/goal pairs
+	* @Return    : int32                  - Batch id passed to the completion event
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Zone Path Cache")
+	int32 SubmitPathBatch(const TArray<FZonePathQuery>& inQueries);
+
+	/**
+	* @Brief Queues path queries for worker threads with a native completion callback
+	*
+	* Queries are split into work units run on the task scheduler (work-stealing worker pool);
+	* queries sharing a goal are answered by one reverse search unless a per-query expansion
+	* limit is set (same reachability and cost as FindPath; under Jump Point Search the route
+	* may be a different equal-cost one). Finished batches are delivered on the game thread in slices of at
+	* most PATH_BATCH_DELIVERY_SLICE_QUERIES results, within pathBatchDeliveryBudgetMicroseconds
+	* per frame; each slice carries the index of its first query
+	* @inQueries     : TArray<FZonePathQuery>          - Start/goal pairs
+	* @inOnCompleted : FOnZonePathBatchCompletedNative - Called per slice on the game thread before OnZonePathBatchCompleted
+	* @Return        : int32                           - Batch id
+	*/
+	int32 SubmitPathBatchWithCallback(const TArray<FZonePathQuery>& inQueries, FOnZonePathBatchCompletedNative inOnCompleted);
+
+	/**
+	* @Brief Queues path queries for worker threads and returns a future for the results
+	* @inQueries : TArray<FZonePathQuery>                - Start/goal pairs
+	* @Return    : TFuture<TArray<FZonePathQueryResult>> - Set on the worker that finishes the batch (no game-thread delivery)
+	*/
+	TFuture<TArray<FZonePathQueryResult>> SubmitPathBatchAsync(const TArray<FZonePathQuery>& inQueries);
+
+	/**
+	* @Brief Gets number of submitted batches not yet delivered on the game thread
+	* @Return : int32 - Pending batch count (futures excluded)
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Zone Path Cache")
+	int32 GetPendingPathBatchCount() const { return pendingPathBatchCallbacks.Num(); }
+
+	/**
+	* @Brief Gets the flow field toward a goal cell, building and caching it on first use
+	*
+	* Fields survive cell updates that cannot change their integration costs. Builds run on
+	* a worker, one at a time per goal; until a rebuild lands the last field is returned even
+	* if stale. Thread-safe
+	* @inGoalGridPosition : FIntVector            - Goal grid position
+	* @bWaitForBuild      : bool                  - Block on the rebuild started for the grid at call time instead of returning a stale or null field
+	* @Return             : FZonePathFlowFieldPtr - Current or stale field (null before generation, or while the first build runs unless waiting)
+	*/
+	FZonePathFlowFieldPtr GetFlowField(const FIntVector& inGoalGridPosition, bool bWaitForBuild = false);
+
+	/**
+	* @Brief Samples the flow field toward a goal cell at a world position
+	*
+	* Never waits for a build: samples the last field toward the goal, stale or not, and
+	* returns zero until the first field for the goal is ready
+	* @inGoalGridPosition : FIntVector - Goal grid position
+	* @inWorldPosition    : FVector    - Agent world position
+	* @Return             : FVector    - Unit direction toward the next cell (zero at the goal or if unreachable)
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Zone Path Cache")
+	FVector SampleFlowDirection(const FIntVector& inGoalGridPosition, const FVector& inWorldPosition);
+
+	/**
+	* @Brief Gets number of flow fields currently cached
+	* @Return : int32 - Cached field count (stale fields included until their next lookup)
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Zone Path Cache")
+	int32 GetCachedFlowFieldCount() const;
+
+	/**
+	* @Brief Sets pathfinding behavior used by path queries
+	* @inPathSettings : FZonePathSettings - Zone pathfinding configuration
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Zone Path Cache")
+	void SetPathSettings(const FZonePathSettings& inPathSettings) { pathSettings = inPathSettings; }
+
+	/**
+	* @Brief Gets pathfinding behavior used by path queries
+	* @Return : FZonePathSettings - Zone pathfinding configuration reference
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Zone Path Cache")
+	const FZonePathSettings& GetPathSettings() const { return pathSettings; }
+
+	/**
+	* @Brief Writes the full cache to file, compacting pending deltas (binary, see NZonePathCacheFormat)
 	* @inFilePath : FString - File path for cache storage
 	*/
 	UFUNCTION(BlueprintCallable, Category = "Zone Path Cache")
 	void SaveCacheToFile(const FString& inFilePath);
 
 	/**
-	* @Brief Loads cache data from file
+	* @Brief Loads cache data from binary cache file (memory-mapped when available) and replays its delta file
 	* @inFilePath : FString - File path for cache loading
 	* @Return     : bool    - True if loading succeeded
 	*/
 	UFUNCTION(BlueprintCallable, Category = "Zone Path Cache")
 	bool LoadCacheFromFile(const FString& inFilePath);
 
+	/**
+	* @Brief Reads and decodes a cache file without touching any cache (safe on worker threads)
+	* @inFilePath : FString                  - File path for cache loading
+	* @Return     : FZonePathCacheLoadResult - Decoded grid and snapshot (bSuccess false if missing or invalid)
+	*/
+	static FZonePathCacheLoadResult DecodeCacheFile(const FString& inFilePath);
+
+	/**
+	* @Brief Installs a decoded cache file as the current grid (game thread)
+	* @inLoadResult : FZonePathCacheLoadResult - Result of DecodeCacheFile (consumed)
+	* @Return       : bool                     - True if the result was valid and installed
+	*/
+	bool ApplyDecodedCache(FZonePathCacheLoadResult&& inLoadResult);
+
+	/**
+	* @Brief Saves the current grid snapshot on a background thread
+	*
+	* Only the snapshot reference is taken on the calling (game) thread; serialization and
+	* file I/O run on the thread pool. At most one save is in flight per cache; a request made
+	* while busy is coalesced and re-issued with the latest snapshot when the running save ends.
+	* Cells changed since the last save are appended to the delta file; the base file is only
+	* rewritten after bulk changes or once deltaCompactionRecordLimit records have accumulated
+	* @inFilePath : FString - File path for cache storage
+	* @Return     : bool    - True if a save was started or queued, false if nothing changed
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Zone Path Cache")
+	bool SaveCacheToFileAsync(const FString& inFilePath);
+
+	/**
+	* @Brief Checks whether a background save is running or its result is still undelivered
+	*
+	* Stays true until the finished save is consumed on the game thread, so a new save
+	* never replaces a result that has not been applied yet
+	* @Return : bool - True from the start of a save until its completion is handled
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Zone Path Cache")
+	bool IsSaveInFlight() const { return pendingSaveFuture.IsValid(); }
+
+	/**
+	* @Brief Blocks until the in-flight save and any save queued behind it have finished
+	*/
+	void WaitForPendingSave();
+
+	/**
+	* @Brief Exports cache data as human-readable JSON (debug/inspection only)
+	* @inFilePath : FString - JSON file path
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Zone Path Cache")
+	void ExportCacheToJson(const FString& inFilePath) const;
+
+	/**
+	* @Brief Imports cache data previously exported as JSON
+	* @inFilePath : FString - JSON file path
+	* @Return     : bool    - True if import succeeded
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Zone Path Cache")
+	bool ImportCacheFromJson(const FString& inFilePath);
+
+	/**
+	* @Brief Gets a reference to the current grid snapshot (publishes pending cell updates first)
+	* @Return : FZonePathGridSnapshotPtr - Immutable grid version (null before first publish)
+	*/
+	FZonePathGridSnapshotPtr GetGridSnapshot() const;
+
+	/**
+	* @Brief Gets the current grid snapshot together with its version (publishes pending cell updates first)
+	* @outSnapshotVersion : uint32&                  - Version of the returned snapshot
+	* @Return             : FZonePathGridSnapshotPtr - Immutable grid version (null before first publish)
+	*/
+	FZonePathGridSnapshotPtr GetGridSnapshot(uint32& outSnapshotVersion) const;
+
+	/**
+	* @Brief Collects cells changed by cell updates between two snapshot versions
+	*
+	* Fails when any other publish (generation, load, import, clear)
+	* happened in between or the bounded change log no longer reaches back that far
+	* @inSinceVersion  : uint32              - Version the caller derived its data from
+	* @inUntilVersion  : uint32              - Version the caller is updating to
+	* @outChangedCells : TArray<FIntVector>& - Changed cells (may repeat)
+	* @Return          : bool                - True if outChangedCells covers every change in the range
+	*/
+	bool GetChangedCellsBetween(uint32 inSinceVersion, uint32 inUntilVersion, TArray<FIntVector>& outChangedCells) const;
+
+	/**
+	* @Brief Gets memory held by the working grid, its published snapshot and cached flow fields
+	* @Return : int64 - Footprint in bytes
+	*/
+	UFUNCTION(BlueprintCallable, Category = "Zone Path Cache")
+	int64 GetMemoryFootprint() const;
+
+	/**
+	* @Brief Gets number of grid versions published so far
+	* @Return : uint32 - Monotonic snapshot version
+	*/
+	uint32 GetSnapshotVersion() const { return snapshotVersion.load(std::memory_order_acquire); }
+
+	/** @Brief Broadcast after every time-sliced generation step */
+	UPROPERTY(BlueprintAssignable, Category = "Zone Path Cache")
+	FOnZonePathGenerationProgress OnZonePathGenerationProgress;
+
+	/** @Brief Broadcast when time-sliced generation finishes */
+	UPROPERTY(BlueprintAssignable, Category = "Zone Path Cache")
+	FOnZonePathGenerationCompleted OnZonePathGenerationCompleted;
+
+	/** @Brief Broadcast on the game thread when a background save completes */
+	UPROPERTY(BlueprintAssignable, Category = "Zone Path Cache")
+	FOnZonePathCacheSaved OnZonePathCacheSaved;
+
+	/** @Brief Broadcast on the game thread for each delivered slice of a submitted path batch */
+	UPROPERTY(BlueprintAssignable, Category = "Zone Path Cache")
+	FOnZonePathBatchCompleted OnZonePathBatchCompleted;
+
+	/**
+	* @Brief Broadcast after a cell update publishes a change, outside the grid lock, always on the game thread
+	*
+	* Updates made on other threads are delivered by a game-thread task, so subscribers may bind
+	* and unbind on the game thread without racing the broadcast. Only cell updates are reported;
+	* other publishes (generation, load, import, clear) show up as a snapshot version that no
+	* change event led to
+	*/
+	FOnZonePathGridChangedNative OnZonePathGridChangedNative;
+
+	/** @Brief Broadcast with the changed bounds after each cell update, always on the game thread (deferred if the update ran elsewhere) */
+	UPROPERTY(BlueprintAssignable, Category = "Zone Path Cache")
+	FOnZonePathGridRegionChanged OnZonePathGridRegionChanged;
+
 protected:
+	friend class FZonePathGridReadScope;
+
 	/** @Brief Main pathfinding grid data structure */
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Zone Path Cache")
 	FZonePathGrid pathGrid;
 
+	/** @Brief Pathfinding behavior (diagonal/vertical movement) applied to path queries */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Zone Path Cache")
+	FZonePathSettings pathSettings;
+
 	/** @Brief Enable automatic cache saving */
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Zone Path Cache")
 	bool bAutoSave;
@@ -356,15 +1190,267 @@ protected:
 	/** @Brief Timer handle for auto-save functionality */
 	FTimerHandle autoSaveTimerHandle;
 
-	/** @Brief Thread safety mutex for PathGrid operations */
+	/** @Brief Minimum seconds between partial snapshot publications during time-sliced generation */
+	static constexpr double GENERATION_PUBLISH_INTERVAL = 0.25;
+
+	/** @Brief Zone configuration of the running time-sliced generation */
+	FZoneLevelData generationZoneData;
+
+	/** @Brief Next bake row of the running time-sliced generation */
+	int32 generationNextRow;
+
+	/** @Brief Blocked node count accumulated by the running generation */
+	int32 generationBlockedNodes;
+
+	/** @Brief Checked node count accumulated by the running generation */
+	int32 generationCheckedNodes;
+
+	/** @Brief Platform time of the last partial snapshot publication */
+	double generationLastPublishTime;
+
+	/** @Brief Core ticker registration driving time-sliced generation */
+	FTSTicker::FDelegateHandle generationTickerHandle;
+
+	/** @Brief Cells updated before the running generation baked them; their bake result is discarded (guarded by pathGridMutex) */
+	TSet<FIntVector> generationEditedCells;
+
+	/** @Brief Queries sharing a goal are answered by one reverse search from this many on */
+	static constexpr int32 PATH_BATCH_COALESCE_MIN_QUERIES = 3;
+
+	/** @Brief Most results handed to the callbacks at once; the delivery budget is checked between slices */
+	static constexpr int32 PATH_BATCH_DELIVERY_SLICE_QUERIES = 32;
+
+	/** @Brief Game-thread time per frame spent delivering finished path batches (at least one slice is delivered) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Zone Path Cache", meta = (ClampMin = "50.0"))
+	float pathBatchDeliveryBudgetMicroseconds;
+
+	/** @Brief Finished batches pushed by worker tasks (shared so tasks may outlive the cache) */
+	TSharedPtr<FZonePathBatchCompletionQueue, ESPMode::ThreadSafe> pathBatchCompletions;
+
+	/** @Brief Callbacks of submitted batches awaiting delivery (game thread) */
+	TMap<int32, FOnZonePathBatchCompletedNative> pendingPathBatchCallbacks;
+
+	/** @Brief Batch whose results are partly delivered (game thread) */
+	TOptional<FZonePathBatchCompletion> pathBatchDelivery;
+
+	/** @Brief Id assigned to the next submitted batch */
+	int32 nextPathBatchID;
+
+	/** @Brief Core ticker registration delivering finished batches */
+	FTSTicker::FDelegateHandle pathBatchTickerHandle;
+
+	/** @Brief Most flow fields kept per zone (least recently used are dropped first) */
+	static constexpr int32 MAX_CACHED_FLOW_FIELDS = 8;
+
+	/** @Brief Flow fields per goal cell (guarded by pathGridMutex) */
+	TMap<FIntVector, FZonePathFlowFieldCacheEntry> flowFieldCache;
+
+	/** @Brief Content hash of the level the current grid was baked from (0 if unknown, e.g. loaded from file) */
+	uint32 levelContentHash;
+
+	/** @Brief Delta records appended to the delta file before the base file is rewritten */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Zone Path Cache")
+	int32 deltaCompactionRecordLimit;
+
+	/** @Brief Result of the in-flight background save (invalid once consumed) */
+	TFuture<FZonePathCacheSaveResult> pendingSaveFuture;
+
+	/** @Brief File path of a save requested while another was in flight (empty if none) */
+	FString queuedSaveFilePath;
+
+	/** @Brief Core ticker registration that consumes the background save once its result is set */
+	FTSTicker::FDelegateHandle saveCompletionTickerHandle;
+
+	/** @Brief Cell indices changed since the last captured save (guarded by pathGridMutex) */
+	TSet<int32> dirtyCellIndices;
+
+	/** @Brief Most cells kept in gridChangeLog (oldest changes are dropped first) */
+	static constexpr int32 MAX_GRID_CHANGE_LOG_CELLS = 4096;
+
+	/** @Brief Recent cell updates in version order (guarded by pathGridMutex) */
+	TArray<FZonePathGridChange> gridChangeLog;
+
+	/** @Brief Cells held by gridChangeLog (guarded by pathGridMutex) */
+	int32 gridChangeLogCellCount = 0;
+
+	/** @Brief Whether the next save must rewrite the base file (guarded by pathGridMutex) */
+	bool bFullSaveRequired;
+
+	/** @Brief Base cache file the delta file currently belongs to (game thread) */
+	FString baseFilePath;
+
+	/** @Brief Checksum of baseFilePath (game thread) */
+	uint32 baseFileChecksum;
+
+	/** @Brief Records currently in the delta file of baseFilePath (game thread) */
+	int32 deltaRecordCount;
+
+	/** @Brief Writer-side mutex serializing grid mutation and snapshot publication */
 	mutable FCriticalSection pathGridMutex;
 
 	/**
-	* @Brief Performs collision checking for pathfinding grid
+	* @Brief Latest published snapshot (written with pathGridMutex and publishedSnapshotLock held,
+	* read under either). Readers hold their own reference, so superseded snapshots are freed
+	* as soon as the last reader pinning them finishes
+	*/
+	mutable FZonePathGridSnapshotPtr publishedSnapshot;
+
+	/** @Brief Guards the publishedSnapshot pointer itself; held only to copy or swap it */
+	mutable FRWLock publishedSnapshotLock;
+
+	/** @Brief Whether pathGrid has cell updates that publishedSnapshot does not show yet (written under pathGridMutex) */
+	mutable std::atomic<bool> bSnapshotPublishPending{ false };
+
+	/** @Brief Core ticker registration publishing pending cell updates at the end of the frame (guarded by pathGridMutex) */
+	FTSTicker::FDelegateHandle snapshotPublishTickerHandle;
+
+	/** @Brief Monotonic grid version incremented on every publish and every cell update */
+	std::atomic<uint32> snapshotVersion{ 0 };
+
+	/**
+	* @Brief Publishes a copy of pathGrid as the new read snapshot (pathGridMutex must be held)
+	*/
+	void PublishSnapshotLocked();
+
+	/**
+	* @Brief Publishes a snapshot that already matches pathGrid (pathGridMutex must be held)
+	* @inSnapshot : FZonePathGridSnapshotPtr - Prepared immutable copy of pathGrid
+	*/
+	void PublishSnapshotLocked(FZonePathGridSnapshotPtr inSnapshot);
+
+	/**
+	* @Brief Records a cell update whose snapshot copy is deferred (pathGridMutex must be held)
+	*/
+	void MarkSnapshotPublishPendingLocked();
+
+	/**
+	* @Brief Publishes deferred cell updates, if any (pathGridMutex must be held)
+	*/
+	void PublishPendingSnapshotLocked() const;
+
+	/**
+	* @Brief Swaps the published snapshot pointer (pathGridMutex must be held)
+	* @inSnapshot : FZonePathGridSnapshotPtr - Immutable copy matching pathGrid
+	*/
+	void StoreSnapshotLocked(FZonePathGridSnapshotPtr inSnapshot) const;
+
+	/**
+	* @Brief Gets a reference to the published snapshot, publishing deferred updates first
+	* @bWaitForWriter : bool                     - Wait for pathGridMutex to publish (false: only if it is free)
+	* @Return         : FZonePathGridSnapshotPtr - Snapshot or null before the first publish
+	*/
+	FZonePathGridSnapshotPtr AcquireSnapshot(bool bWaitForWriter) const;
+
+	/**
+	* @Brief Publishes deferred cell updates no read has published during the frame
+	* @inDeltaTime : float - Frame delta time
+	* @Return      : bool  - Always false (the ticker is registered again by the next update)
+	*/
+	bool TickSnapshotPublish(float inDeltaTime);
+
+	/**
+	* @Brief Carries cached flow fields over a cell update when it cannot change them
+	*
+	* Fields not carried over keep their old version and stay servable until their next
+	* lookup starts a rebuild
+	* @inTransitions     : TConstArrayView<FZonePathCellTransition> - Cell states before and after the change
+	* @inPreviousVersion : uint32                                   - Snapshot version published before the change
+	*/
+	void RevalidateFlowFieldsLocked(TConstArrayView<FZonePathCellTransition> inTransitions, uint32 inPreviousVersion);
+
+	/**
+	* @Brief Finds the cache entry of a goal, landing a finished rebuild and starting one if stale (pathGridMutex must be held)
+	* @inGoalGridPosition : FIntVector                    - Goal grid position
+	* @Return             : FZonePathFlowFieldCacheEntry* - Entry of the goal (null before generation)
+	*/
+	FZonePathFlowFieldCacheEntry* RefreshFlowFieldEntryLocked(const FIntVector& inGoalGridPosition);
+
+	/**
+	* @Brief Records a cell update in gridChangeLog (pathGridMutex must be held)
+	* @inChange : FZonePathGridChange - Published cell update
+	*/
+	void AppendGridChangeLogLocked(const FZonePathGridChange& inChange);
+
+	/**
+	* @Brief Broadcasts a published cell update to native and Blueprint subscribers (game thread)
+	* @inChange : FZonePathGridChange - Published cell update
+	*/
+	void BroadcastGridChange(const FZonePathGridChange& inChange);
+
+	/**
+	* @Brief Applies one cost/blocked state to cells under one lock, one timestamp and one publish
+	* @inGridPositions : TConstArrayView<FIntVector> - Grid coordinates (cells outside the grid are skipped)
+	* @inNewCost       : float                       - New movement cost
+	* @bBlocked        : bool                        - Whether nodes should be blocked
+	* @Return          : int32                       - Number of cells updated
+	*/
+	int32 ApplyNodeUpdates(TConstArrayView<FIntVector> inGridPositions, float inNewCost, bool bBlocked);
+
+	/**
+	* @Brief Splits a batch into work units on the current snapshot and launches them as tasks
+	* @inQueries    : TArray<FZonePathQuery>                          - Start/goal pairs
+	* @inOnFinished : TFunction<void(TArray<FZonePathQueryResult>&&)> - Called once, on the worker that finishes last
+	*/
+	void LaunchPathBatch(const TArray<FZonePathQuery>& inQueries, TFunction<void(TArray<FZonePathQueryResult>&&)> inOnFinished) const;
+
+	/**
+	* @Brief Delivers slices of finished batches within the per-frame budget
+	* @inDeltaTime : float - Frame time
+	* @Return      : bool  - True while batches are still pending
+	*/
+	bool TickPathBatches(float inDeltaTime);
+
+	/**
+	* @Brief Resets pathGrid for a new bake (pathGridMutex must be held)
+	* @inZoneData : FZoneLevelData - Zone configuration data
+	*/
+	void BeginGenerationLocked(const FZoneLevelData& inZoneData);
+
+	/**
+	* @Brief Completes a bake: connection points, storage, publish (pathGridMutex must be held)
+	* @inZoneData : FZoneLevelData - Zone configuration data
+	*/
+	void FinishGenerationLocked(const FZoneLevelData& inZoneData);
+
+	/**
+	* @Brief Runs one budgeted time-sliced generation step (core ticker callback)
+	* @inDeltaTime : float - Ticker delta time
+	* @Return      : bool  - True to keep ticking
+	*/
+	bool TickGeneration(float inDeltaTime);
+
+	/**
+	* @Brief Bakes every sampled cell of one (z, y) row (thread-safe, reads pathGrid only)
+	* @inWorld         : UWorld                - World to trace against
+	* @inZoneData      : FZoneLevelData        - Zone configuration for collision rules
+	* @inQueryParams   : FCollisionQueryParams - Trace parameters
+	* @inRow           : int32                 - Bake row index [0, GetBakeRowCount)
+	* @outNodes        : TArray<FPathNode>&    - Receives non-default nodes (appended)
+	* @outBlockedCount : int32&                - Incremented per blocking rule hit
+	* @outCheckedCount : int32&                - Incremented per traced cell
+	*/
+	void BakeRow(const UWorld& inWorld, const FZoneLevelData& inZoneData, const FCollisionQueryParams& inQueryParams,
+		int32 inRow, TArray<FPathNode>& outNodes, int32& outBlockedCount, int32& outCheckedCount) const;
+
+	/**
+	* @Brief Performs collision checking for pathfinding grid (slabs baked in parallel)
 	* @inZoneData : FZoneLevelData - Zone configuration for collision rules
 	*/
 	void PerformCollisionCheck(const FZoneLevelData& inZoneData);
 
+	/**
+	* @Brief Traces and classifies a single sampled cell (thread-safe, reads pathGrid only)
+	* @inWorld         : UWorld                - World to trace against
+	* @inZoneData      : FZoneLevelData        - Zone configuration for collision rules
+	* @inQueryParams   : FCollisionQueryParams - Trace parameters
+	* @inGridPos       : FIntVector            - Cell to bake
+	* @outNode         : FPathNode&            - Baked node
+	* @outBlockedCount : int32&                - Incremented per blocking rule hit
+	* @Return          : bool                  - True if the node differs from default and must be stored
+	*/
+	bool BakeCell(const UWorld& inWorld, const FZoneLevelData& inZoneData, const FCollisionQueryParams& inQueryParams,
+		const FIntVector& inGridPos, FPathNode& outNode, int32& outBlockedCount) const;
+
 	/**
 	* @Brief Sets up inter-zone connection points
 	* @inZoneData : FZoneLevelData - Zone data with connection information
@@ -372,7 +1458,87 @@ protected:
 	void SetupConnectionPoints(const FZoneLevelData& inZoneData);
 
 	/**
-	* @Brief Performs automatic cache saving
+	* @Brief Drops per-cell dirty tracking after a bulk change and forces the next save to rewrite the base file (pathGridMutex must be held)
+	*/
+	void MarkFullSaveRequiredLocked();
+
+	/**
+	* @Brief Takes snapshot and dirty cells for a save and decides between base rewrite and delta append
+	* @bForceFullSave      : bool                      - Always rewrite the base file
+	* @inFilePath          : FString                   - Base cache file path
+	* @outSnapshot         : FZonePathGridSnapshotPtr& - Snapshot consistent with the dirty cells
+	* @outDirtyCells       : TArray<int32>&            - Cells changed since the previous save
+	* @outLevelContentHash : uint32&                   - Level content hash matching the snapshot
+	* @bOutFullSave        : bool&                     - Whether the base file is rewritten
+	* @Return              : bool                      - False if nothing needs saving
+	*/
+	bool CaptureSaveState(bool bForceFullSave, const FString& inFilePath, FZonePathGridSnapshotPtr& outSnapshot,
+		TArray<int32>& outDirtyCells, uint32& outLevelContentHash, bool& bOutFullSave);
+
+	/**
+	* @Brief Writes a captured save (thread-safe, touches no cache state)
+	* @inGrid             : FZonePathGrid            - Snapshot to persist
+	* @inDirtyCells       : TConstArrayView<int32>   - Cells to append for delta saves
+	* @inLevelContentHash : uint32                   - Level content hash written into a rewritten base file
+	* @inFilePath         : FString                  - Base cache file path
+	* @bFullSave          : bool                     - Rewrite base file instead of appending a delta
+	* @inBaseChecksum     : uint32                   - Checksum of the current base file
+	* @Return             : FZonePathCacheSaveResult - Outcome of the write
+	*/
+	static FZonePathCacheSaveResult ExecuteCacheSave(const FZonePathGrid& inGrid, TConstArrayView<int32> inDirtyCells,
+		uint32 inLevelContentHash, const FString& inFilePath, bool bFullSave, uint32 inBaseChecksum);
+
+	/**
+	* @Brief Updates persistence bookkeeping from a finished save (game thread)
+	* @inResult : FZonePathCacheSaveResult - Outcome of the write
+	*/
+	void ApplySaveResult(const FZonePathCacheSaveResult& inResult);
+
+	/**
+	* @Brief Consumes a finished background save on the game thread and re-issues a queued request
+	*/
+	void HandleFinishedSave();
+
+	/**
+	* @Brief Polls the background save and consumes it once its result is set
+	* @inDeltaTime : float - Frame time
+	* @Return      : bool  - True while a save is still in flight
+	*/
+	bool TickSaveCompletion(float inDeltaTime);
+
+	/**
+	* @Brief Performs automatic cache saving (asynchronous)
 	*/
 	void AutoSaveCache();
-};
\ No newline at end of file
+};
+
+/**
+* @Brief RAII scope pinning the published grid snapshot of a cache
+*
+* Entering takes a shared reference to the snapshot, so the pinned grid stays valid for
+* the lifetime of the scope while writers keep publishing new versions. Deferred cell
+* updates are published first when no writer holds the grid; otherwise the scope
+* reads the last published version instead of waiting
+*/
+class PATHFINDINGPLUGIN_API FZonePathGridReadScope
+{
+public:
+	/**
+	* @Brief Pins the current snapshot of a cache
+	* @inCache : UZonePathScoreCache - Cache to read from
+	*/
+	explicit FZonePathGridReadScope(const UZonePathScoreCache& inCache);
+
+	FZonePathGridReadScope(const FZonePathGridReadScope&) = delete;
+	FZonePathGridReadScope& operator=(const FZonePathGridReadScope&) = delete;
+
+	/**
+	* @Brief Gets pinned grid snapshot
+	* @Return : const FZonePathGrid* - Snapshot or nullptr if nothing was published yet
+	*/
+	FORCEINLINE const FZonePathGrid* Get() const { return pinnedSnapshot.Get(); }
+
+private:
+	/** @Brief Snapshot reference held for the scope's lifetime */
+	FZonePathGridSnapshotPtr pinnedSnapshot;
+};
@@ -0,0 +1,314 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Zone/ZoneTypes.h"
+
+#pragma region Forward_Declare
+struct FZonePathGrid;
+struct FZonePathSettings;
+struct FZonePathNeighborVisitor;
+#pragma endregion Forward_Declare
+
+/**
+* @Brief Search options derived from zone path settings
+*
+* Controls which neighbor directions a grid search may expand
+* and bounds the amount of work a single query can perform
+*/
+struct PATHFINDINGPLUGIN_API FZonePathSearchParams
+{
+	/** @Brief Allow diagonal (two-axis) steps */
+	bool bAllowDiagonal = true;
+
+	/** @Brief Allow steps that change the Z layer */
+	bool bAllowVertical = false;
+
+	/** @Brief Maximum node expansions before giving up (0: unlimited) */
+	int32 maxExpansions = 0;
+
+	/** @Brief Algorithm used by NZonePathSearch::FindPath */
+	EZonePathSearchMode searchMode = EZonePathSearchMode::AStar;
+
+	/** @Brief Only expand cells inside [boundsMin, boundsMax] */
+	bool bRestrictToBounds = false;
+
+	/** @Brief Inclusive minimum corner of the search region (used when bRestrictToBounds) */
+	FIntVector boundsMin = FIntVector::ZeroValue;
+
+	/** @Brief Inclusive maximum corner of the search region (used when bRestrictToBounds) */
+	FIntVector boundsMax = FIntVector::ZeroValue;
+
+	FZonePathSearchParams() = default;
+
+	/**
+	* @Brief Builds search options from zone path settings
+	* @inSettings : FZonePathSettings - Zone pathfinding configuration
+	*/
+	explicit FZonePathSearchParams(const FZonePathSettings& inSettings);
+
+	/**
+	* @Brief Restricts the search to an inclusive grid region
+	* @inMin : FIntVector - Minimum corner
+	* @inMax : FIntVector - Maximum corner
+	*/
+	void SetBounds(const FIntVector& inMin, const FIntVector& inMax)
+	{
+		bRestrictToBounds = true;
+		boundsMin = inMin;
+		boundsMax = inMax;
+	}
+
+	/**
+	* @Brief Checks whether a cell may be expanded under the current region restriction
+	* @inGridPos : FIntVector - Grid position
+	* @Return    : bool       - True if unrestricted or inside the region
+	*/
+	FORCEINLINE bool IsInsideBounds(const FIntVector& inGridPos) const
+	{
+		return !bRestrictToBounds
+			|| (inGridPos.X >= boundsMin.X && inGridPos.X <= boundsMax.X
+			&& inGridPos.Y >= boundsMin.Y && inGridPos.Y <= boundsMax.Y
+			&& inGridPos.Z >= boundsMin.Z && inGridPos.Z <= boundsMax.Z);
+	}
+};
+
+/**
+* @Brief Reusable scratch buffers for grid searches
+*
+* Scratches are leased per search from a shared pool (FZonePathSearchScratchScope) and
+* reused across queries; a generation stamp invalidates per-cell state without clearing,
+* so steady-state searches perform no heap allocation. The pool keeps only a few scratches
+* sized for large grids, so bursts of searches on many workers do not pin grid-sized
+* buffers per thread
+*/
+struct PATHFINDINGPLUGIN_API FZonePathSearchScratch
+{
+	/** @Brief Open-set heap entry (lazy deletion, stale entries are skipped on pop) */
+	struct FOpenEntry
+	{
+		float fScore;
+		int32 nodeIndex;
+	};
+
+	/** @Brief Best known cost from start per cell (valid when visitStamps matches) */
+	TArray<float> gScores;
+
+	/** @Brief Predecessor cell index per cell (valid when visitStamps matches) */
+	TArray<int32> parentIndices;
+
+	/** @Brief Generation stamp marking cells touched by the current search */
+	TArray<uint32> visitStamps;
+
+	/** @Brief Generation stamp marking cells closed by the current search */
+	TArray<uint32> closedStamps;
+
+	/** @Brief Binary heap of open entries ordered by fScore */
+	TArray<FOpenEntry> openHeap;
+
+	/** @Brief Current search generation */
+	uint32 currentStamp = 0;
+
+	/** @Brief Nodes expanded by the last search that used this scratch */
+	int32 lastExpansionCount = 0;
+
+	/** @Brief Capacity in cells above which a scratch counts as large when returned to the pool */
+	static constexpr int32 RETAINED_CELL_LIMIT = 1 << 18;
+
+	/** @Brief Large scratches kept in the pool; further ones have their buffers freed on return */
+	static constexpr int32 MAX_RETAINED_LARGE_SCRATCHES = 2;
+
+	/** @Brief Scratches kept in the pool; further ones are destroyed on return */
+	static constexpr int32 MAX_POOLED_SCRATCHES = 32;
+
+	/**
+	* @Brief Prepares buffers for a new search over a grid of given size
+	* @inCellCount : int32 - Number of cells in the searched grid
+	*/
+	void BeginSearch(int32 inCellCount);
+
+	/**
+	* @Brief Checks whether a cell has been touched by the current search
+	* @inIndex : int32 - Cell index
+	* @Return  : bool  - True if gScore/parent are valid for this search
+	*/
+	FORCEINLINE bool IsVisited(int32 inIndex) const { return visitStamps[inIndex] == currentStamp; }
+
+	/**
+	* @Brief Checks whether a cell has been closed by the current search
+	* @inIndex : int32 - Cell index
+	* @Return  : bool  - True if cell is closed
+	*/
+	FORCEINLINE bool IsClosed(int32 inIndex) const { return closedStamps[inIndex] == currentStamp; }
+
+	/**
+	* @Brief Gets number of cells the buffers currently cover
+	* @Return : int32 - Cell capacity
+	*/
+	FORCEINLINE int32 GetCellCapacity() const { return visitStamps.Num(); }
+
+	/**
+	* @Brief Frees all buffers (the next BeginSearch reallocates them)
+	*/
+	void ReleaseBuffers();
+};
+
+/**
+* @Brief Scoped lease of a pooled search scratch prepared for one search
+*/
+class PATHFINDINGPLUGIN_API FZonePathSearchScratchScope
+{
+public:
+	/**
+	* @Brief Leases a scratch (preferring one already large enough) and begins a search
+	* @inCellCount : int32 - Number of cells in the searched grid
+	*/
+	explicit FZonePathSearchScratchScope(int32 inCellCount);
+
+	/**
+	* @Brief Returns the scratch to the pool, trimming it if the pool already holds enough large ones
+	*/
+	~FZonePathSearchScratchScope();
+
+	FZonePathSearchScratchScope(const FZonePathSearchScratchScope&) = delete;
+	FZonePathSearchScratchScope& operator=(const FZonePathSearchScratchScope&) = delete;
+
+	/**
+	* @Brief Gets the leased scratch
+	* @Return : FZonePathSearchScratch& - Scratch prepared by BeginSearch
+	*/
+	FORCEINLINE FZonePathSearchScratch& Get() const { return *scratch; }
+
+private:
+	/** @Brief Leased scratch */
+	TUniquePtr<FZonePathSearchScratch> scratch;
+};
+
+/**
+* @Brief Native grid search algorithms operating directly on FZonePathGrid
+*
+* Step cost is the step length in cells multiplied by the movement cost of the
+* entered cell; blocked cells and cells with non-positive cost are impassable
+*/
+namespace NZonePathSearch
+{
+	/**
+	* @Brief Finds a path between two grid cells with the algorithm selected by inParams.searchMode
+	* @inGrid            : FZonePathGrid             - Grid to search (caller guarantees it is not mutated during the search)
+	* @inParams          : FZonePathSearchParams     - Neighbor and work limits
+	* @inStart           : FIntVector                - Start grid position
+	* @inGoal            : FIntVector                - Goal grid position
+	* @outPath           : TArray<FIntVector>&       - Cells from start to goal inclusive (reset, capacity kept)
+	* @outPathCost       : float&                    - Accumulated path cost
+	* @inNeighborVisitor : FZonePathNeighborVisitor* - Visitor reused across searches with the same grid and rules (nullptr: built per call)
+	* @Return            : bool                      - True if a path was found
+	*/
+	PATHFINDINGPLUGIN_API bool FindPath(const FZonePathGrid& inGrid, const FZonePathSearchParams& inParams,
+		const FIntVector& inStart, const FIntVector& inGoal, TArray<FIntVector>& outPath, float& outPathCost,
+		const FZonePathNeighborVisitor* inNeighborVisitor = nullptr);
+
+	/**
+	* @Brief Runs A* between two grid cells
+	* @inGrid            : FZonePathGrid             - Grid to search (caller guarantees it is not mutated during the search)
+	* @inParams          : FZonePathSearchParams     - Neighbor and work limits
+	* @inStart           : FIntVector                - Start grid position
+	* @inGoal            : FIntVector                - Goal grid position
+	* @outPath           : TArray<FIntVector>&       - Cells from start to goal inclusive (reset, capacity kept)
+	* @outPathCost       : float&                    - Accumulated path cost
+	* @inNeighborVisitor : FZonePathNeighborVisitor* - Visitor reused across searches with the same grid and rules (nullptr: built per call)
+	* @Return            : bool                      - True if a path was found
+	*/
+	PATHFINDINGPLUGIN_API bool FindPathAStar(const FZonePathGrid& inGrid, const FZonePathSearchParams& inParams,
+		const FIntVector& inStart, const FIntVector& inGoal, TArray<FIntVector>& outPath, float& outPathCost,
+		const FZonePathNeighborVisitor* inNeighborVisitor = nullptr);
+
+	/**
+	* @Brief Checks whether Jump Point Search can serve a query with the given movement rules
+	* @inParams : FZonePathSearchParams - Search options
+	* @Return   : bool                  - True for planar 8-way movement (diagonal on, vertical off)
+	*/
+	FORCEINLINE bool CanUseJumpPointSearch(const FZonePathSearchParams& inParams)
+	{
+		return inParams.bAllowDiagonal && !inParams.bAllowVertical;
+	}
+
+	/**
+	* @Brief Runs Jump Point Search on the start cell's Z layer (same optimal cost as A*)
+	*
+	* Straight and diagonal scans skip cells with the grid default cost and stop at forced
+	* neighbors, the goal and cells next to other costs, which are then expanded like A*.
+	* Requires CanUseJumpPointSearch; the returned path is expanded to every traversed cell
+	* @inGrid      : FZonePathGrid         - Grid to search (caller guarantees it is not mutated during the search)
+	* @inParams    : FZonePathSearchParams - Region and work limits (maxExpansions counts jump points)
+	* @inStart     : FIntVector            - Start grid position
+	* @inGoal      : FIntVector            - Goal grid position (must share the start Z layer)
+	* @outPath     : TArray<FIntVector>&   - Cells from start to goal inclusive (reset, capacity kept)
+	* @outPathCost : float&                - Accumulated path cost
+	* @Return      : bool                  - True if a path was found
+	*/
+	PATHFINDINGPLUGIN_API bool FindPathJumpPoint(const FZonePathGrid& inGrid, const FZonePathSearchParams& inParams,
+		const FIntVector& inStart, const FIntVector& inGoal, TArray<FIntVector>& outPath, float& outPathCost);
+
+	/**
+	* @Brief Runs Dijkstra from one cell until every target is settled or the open set is exhausted
+	* @inGrid            : FZonePathGrid               - Grid to search (caller guarantees it is not mutated during the search)
+	* @inParams          : FZonePathSearchParams       - Neighbor, region and work limits
+	* @inStart           : FIntVector                  - Start grid position
+	* @inTargets         : TConstArrayView<FIntVector> - Target grid positions
+	* @outCosts          : TArray<float>&              - Cost per target (MAX_flt if unreachable)
+	* @inNeighborVisitor : FZonePathNeighborVisitor*   - Visitor reused across searches with the same grid and rules (nullptr: built per call)
+	* @Return            : int32                       - Number of targets reached
+	*/
+	PATHFINDINGPLUGIN_API int32 FindCostsToTargets(const FZonePathGrid& inGrid, const FZonePathSearchParams& inParams,
+		const FIntVector& inStart, TConstArrayView<FIntVector> inTargets, TArray<float>& outCosts,
+		const FZonePathNeighborVisitor* inNeighborVisitor = nullptr);
+
+	/**
+	* @Brief Computes path costs from many starts to one goal with a single reverse Dijkstra
+	*
+	* Uses the same reverse step costs as FindPathsToGoal, so each cost equals the one
+	* FindPathAStar reports for that start. Like FindPathAStar, a blocked start may still
+	* be left; the search stops once every start is settled
+	* @inGrid            : FZonePathGrid               - Grid to search (caller guarantees it is not mutated during the search)
+	* @inParams          : FZonePathSearchParams       - Neighbor, region and work limits
+	* @inGoal            : FIntVector                  - Shared goal grid position
+	* @inStarts          : TConstArrayView<FIntVector> - Start grid positions
+	* @outCosts          : TArray<float>&              - Cost per start (MAX_flt if unreachable)
+	* @inNeighborVisitor : FZonePathNeighborVisitor*   - Visitor reused across searches with the same grid and rules (nullptr: built per call)
+	* @Return            : int32                       - Number of starts reached
+	*/
+	PATHFINDINGPLUGIN_API int32 FindCostsFromStarts(const FZonePathGrid& inGrid, const FZonePathSearchParams& inParams,
+		const FIntVector& inGoal, TConstArrayView<FIntVector> inStarts, TArray<float>& outCosts,
+		const FZonePathNeighborVisitor* inNeighborVisitor = nullptr);
+
+	/**
+	* @Brief Finds paths from many starts to one goal with a single reverse search
+	*
+	* Runs Dijkstra backwards from the goal, charging each reverse step the cost of the cell
+	* it leaves (the cell a forward step enters), so costs match FindPathAStar. Like
+	* FindPathAStar, a blocked start may still be left; the search stops once every start
+	* is settled. maxExpansions bounds the whole search, not each start
+	* @inGrid    : FZonePathGrid               - Grid to search (caller guarantees it is not mutated during the search)
+	* @inParams  : FZonePathSearchParams       - Neighbor, region and work limits
+	* @inGoal    : FIntVector                  - Shared goal grid position
+	* @inStarts  : TConstArrayView<FIntVector> - Start grid positions
+	* @outPaths  : TArray<TArray<FIntVector>>& - Cells from each start to the goal inclusive (empty if unreachable)
+	* @outCosts  : TArray<float>&              - Cost per start (MAX_flt if unreachable)
+	* @Return    : int32                       - Number of starts reached
+	*/
+	PATHFINDINGPLUGIN_API int32 FindPathsToGoal(const FZonePathGrid& inGrid, const FZonePathSearchParams& inParams,
+		const FIntVector& inGoal, TConstArrayView<FIntVector> inStarts, TArray<TArray<FIntVector>>& outPaths, TArray<float>& outCosts);
+
+	/**
+	* @Brief Runs a reverse Dijkstra from a goal over every reachable cell
+	*
+	* Uses the same reverse step costs as FindPathsToGoal. Cells are reported once, in
+	* nondecreasing cost order, together with their successor on a cheapest path to the goal
+	* @inGrid      : FZonePathGrid                             - Grid to search (caller guarantees it is not mutated during the search)
+	* @inParams    : FZonePathSearchParams                     - Neighbor, region and work limits
+	* @inGoal      : FIntVector                                - Goal grid position
+	* @inOnSettled : TFunctionRef<void(int32, int32, float)>   - Called as (cell index, next cell index or INDEX_NONE at the goal, cost to goal)
+	* @Return      : int32                                     - Number of settled cells
+	*/
+	PATHFINDINGPLUGIN_API int32 SettleCellsFromGoal(const FZonePathGrid& inGrid, const FZonePathSearchParams& inParams,
+		const FIntVector& inGoal, TFunctionRef<void(int32, int32, float)> inOnSettled);
+}
@@ -0,0 +1,142 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Zone/ZoneTypes.h"
+#include "Zone/ZoneLevelData.h"
+
+/**
+* @Brief Uniform XY hash grid over zone bounds
+*
+* Each zone is inserted into every grid cell its XY bounding box overlaps, so point
+* and radius queries only test the zones registered in the touched cells. Zones that
+* would cover more than MAX_CELLS_PER_ZONE cells are kept in a separate list that is
+* tested on every query instead of bloating the cell table. Query results are ordered
+* by insertion so they match the registration order of the zones
+*/
+class PATHFINDINGPLUGIN_API FZoneSpatialHashGrid
+{
+public:
+	/** @Brief Default cell edge length in world units */
+	static constexpr float DEFAULT_CELL_SIZE = 10000.0f;
+
+	/** @Brief Largest cell footprint a zone may have before it is treated as oversized */
+	static constexpr int32 MAX_CELLS_PER_ZONE = 1024;
+
+	/** @Brief Largest absolute cell coordinate; coordinates beyond it are clamped so cell spans cannot overflow int32 */
+	static constexpr int32 MAX_CELL_COORDINATE = 1 << 29;
+
+	/**
+	* @Brief Constructor
+	* @inCellSize : float - Cell edge length in world units
+	*/
+	explicit FZoneSpatialHashGrid(float inCellSize = DEFAULT_CELL_SIZE);
+
+	/**
+	* @Brief Changes the cell size, re-inserting every zone
+	* @inCellSize : float - Cell edge length in world units
+	*/
+	void SetCellSize(float inCellSize);
+
+	/**
+	* @Brief Gets the cell edge length
+	* @Return : float - Cell size in world units
+	*/
+	float GetCellSize() const { return cellSize; }
+
+	/**
+	* @Brief Inserts or updates a zone
+	* @inZoneIdentifier : FZoneIdentifier - Zone
+	* @inZoneBounds     : FZoneBounds     - Zone bounds
+	*/
+	void AddZone(const FZoneIdentifier& inZoneIdentifier, const FZoneBounds& inZoneBounds);
+
+	/**
+	* @Brief Removes a zone
+	* @inZoneIdentifier : FZoneIdentifier - Zone
+	* @Return           : bool            - True if the zone was indexed
+	*/
+	bool RemoveZone(const FZoneIdentifier& inZoneIdentifier);
+
+	/**
+	* @Brief Removes every zone
+	*/
+	void Reset();
+
+	/**
+	* @Brief Gets number of indexed zones
+	* @Return : int32 - Zone count
+	*/
+	int32 Num() const { return zoneLookup.Num(); }
+
+	/**
+	* @Brief Finds the earliest inserted zone whose bounds contain a point (FZoneBounds::ContainsPoint)
+	* @inWorldPosition : FVector          - Position to test
+	* @outZone         : FZoneIdentifier& - Containing zone
+	* @Return          : bool             - True if a zone contains the point
+	*/
+	bool FindZoneContainingPoint(const FVector& inWorldPosition, FZoneIdentifier& outZone) const;
+
+	/**
+	* @Brief Finds zones whose center lies within a radius
+	* @inCenter   : FVector                  - Query center
+	* @inRadius   : float                    - Query radius
+	* @outZones   : TArray<FZoneIdentifier>& - Matching zones in insertion order
+	*/
+	void FindZonesInRadius(const FVector& inCenter, float inRadius, TArray<FZoneIdentifier>& outZones) const;
+
+private:
+	/** @Brief Indexed zone */
+	struct FZoneEntry
+	{
+		FZoneIdentifier zoneIdentifier;
+		FZoneBounds zoneBounds;
+		FIntPoint minCell;
+		FIntPoint maxCell;
+		uint64 insertionOrder;
+		bool bOversized;
+	};
+
+	/**
+	* @Brief Converts a world XY coordinate pair to a cell coordinate
+	* @inX    : double    - World X
+	* @inY    : double    - World Y
+	* @Return : FIntPoint - Cell coordinate clamped to [-MAX_CELL_COORDINATE, MAX_CELL_COORDINATE]
+	*/
+	FIntPoint ToCell(double inX, double inY) const;
+
+	/**
+	* @Brief Registers an entry in the cells it covers (or the oversized list)
+	* @inEntryIndex : int32 - Entry index
+	*/
+	void LinkEntry(int32 inEntryIndex);
+
+	/**
+	* @Brief Removes an entry from the cells it covers (or the oversized list)
+	* @inEntryIndex : int32 - Entry index
+	*/
+	void UnlinkEntry(int32 inEntryIndex);
+
+	/**
+	* @Brief Sorts entry indices by insertion order
+	* @inOutEntryIndices : TArray<int32>& - Entry indices
+	*/
+	void SortByInsertionOrder(TArray<int32, TInlineAllocator<16>>& inOutEntryIndices) const;
+
+	/** @Brief Cell edge length in world units */
+	float cellSize;
+
+	/** @Brief Zone entries (sparse, indices stay stable on removal) */
+	TSparseArray<FZoneEntry> zoneEntries;
+
+	/** @Brief Zone to entry index lookup */
+	TMap<FZoneIdentifier, int32> zoneLookup;
+
+	/** @Brief Entry indices per occupied cell */
+	TMap<FIntPoint, TArray<int32>> cellEntries;
+
+	/** @Brief Entries too large for the cell table */
+	TArray<int32> oversizedEntries;
+
+	/** @Brief Next insertion order value */
+	uint64 nextInsertionOrder;
+};
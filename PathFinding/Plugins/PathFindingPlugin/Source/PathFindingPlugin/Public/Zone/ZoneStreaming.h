@@ -0,0 +1,276 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Zone/ZoneTypes.h"
+#include "ZoneStreaming.generated.h"
+
+/**
+* @Brief Proximity band change reported by FZoneProximityTracker
+*/
+struct FZoneProximityTransition
+{
+	/** @Brief Zone whose band changed */
+	FZoneIdentifier zoneIdentifier;
+
+	/** @Brief Band before the update (Outside for a zone evaluated for the first time) */
+	EZoneProximityBand previousBand;
+
+	/** @Brief Band after the update */
+	EZoneProximityBand newBand;
+
+	/** @Brief Distance from the tracked position to the zone center */
+	float distance;
+};
+
+/**
+* @Brief Incremental zone proximity tracker
+*
+* The tracked position accumulates an odometer of distance travelled. After each
+* evaluation a zone is scheduled to wake when the odometer has advanced by its slack,
+* the distance to the nearest of its load/unload shells; the position cannot cross
+* either shell before that. An update therefore only evaluates zones whose shell could
+* have been crossed, so its cost follows nearby zones rather than all registered zones
+*/
+class PATHFINDINGPLUGIN_API FZoneProximityTracker
+{
+public:
+	/** @Brief Minimum wake distance so zones sitting on a shell are not re-evaluated every update */
+	static constexpr float MIN_WAKE_SLACK = 1.0f;
+
+	FZoneProximityTracker();
+
+	/**
+	* @Brief Adds or replaces a tracked zone (evaluated on the next update)
+	* @inZoneIdentifier : FZoneIdentifier - Zone
+	* @inCenter         : FVector         - Zone center
+	* @inLoadDistance   : float           - Inside band radius
+	* @inUnloadDistance : float           - Outside band radius (clamped to at least the load distance)
+	*/
+	void AddZone(const FZoneIdentifier& inZoneIdentifier, const FVector& inCenter, float inLoadDistance, float inUnloadDistance);
+
+	/**
+	* @Brief Stops tracking a zone
+	* @inZoneIdentifier : FZoneIdentifier - Zone
+	* @Return           : bool            - True if the zone was tracked
+	*/
+	bool RemoveZone(const FZoneIdentifier& inZoneIdentifier);
+
+	/**
+	* @Brief Stops tracking every zone and forgets the tracked position
+	*/
+	void Reset();
+
+	/**
+	* @Brief Schedules every zone for evaluation on the next update and reports each as a transition
+	*/
+	void InvalidateAll();
+
+	/**
+	* @Brief Advances the tracked position and evaluates zones whose shells may have been crossed
+	* @inPosition     : FVector                            - New tracked position
+	* @outTransitions : TArray<FZoneProximityTransition>& - Band changes (and first evaluations)
+	*/
+	void Update(const FVector& inPosition, TArray<FZoneProximityTransition>& outTransitions);
+
+	/**
+	* @Brief Gets the band of a zone as of its last evaluation
+	* @inZoneIdentifier : FZoneIdentifier    - Zone
+	* @Return           : EZoneProximityBand - Band (Outside if untracked or not evaluated yet)
+	*/
+	EZoneProximityBand GetBand(const FZoneIdentifier& inZoneIdentifier) const;
+
+	/**
+	* @Brief Gets number of tracked zones
+	* @Return : int32 - Zone count
+	*/
+	int32 Num() const { return zoneLookup.Num(); }
+
+	/**
+	* @Brief Gets number of zones evaluated by the last update
+	* @Return : int32 - Evaluated zone count
+	*/
+	int32 GetLastEvaluatedCount() const { return lastEvaluatedCount; }
+
+	/**
+	* @Brief Gets total distance travelled by the tracked position
+	* @Return : double - Odometer value
+	*/
+	double GetOdometer() const { return odometer; }
+
+private:
+	/** @Brief Tracked zone */
+	struct FZoneEntry
+	{
+		FZoneIdentifier zoneIdentifier;
+		FVector center;
+		float loadDistance;
+		float unloadDistance;
+		EZoneProximityBand band;
+		bool bForceReport;
+		uint32 wakeGeneration;
+	};
+
+	/** @Brief Wake schedule entry (stale when generation no longer matches the zone entry) */
+	struct FWakeEntry
+	{
+		double wakeOdometer;
+		int32 entryIndex;
+		uint32 generation;
+	};
+
+	/**
+	* @Brief Schedules an entry to wake at an odometer value
+	* @inEntryIndex   : int32  - Entry index
+	* @inWakeOdometer : double - Odometer value at which the entry is evaluated
+	*/
+	void ScheduleWake(int32 inEntryIndex, double inWakeOdometer);
+
+	/** @Brief Tracked zones (sparse, indices stay stable on removal) */
+	TSparseArray<FZoneEntry> zoneEntries;
+
+	/** @Brief Zone to entry index lookup */
+	TMap<FZoneIdentifier, int32> zoneLookup;
+
+	/** @Brief Min-heap of wake entries ordered by wakeOdometer */
+	TArray<FWakeEntry> wakeHeap;
+
+	/** @Brief Distance travelled by the tracked position */
+	double odometer;
+
+	/** @Brief Last tracked position */
+	FVector lastPosition;
+
+	/** @Brief A position has been tracked */
+	bool bHasPosition;
+
+	/** @Brief Next wake generation value */
+	uint32 nextWakeGeneration;
+
+	/** @Brief Zones evaluated by the last update */
+	int32 lastEvaluatedCount;
+};
+
+/**
+* @Brief Observer that drives zone streaming (player, camera, AI squad, ...)
+*
+* A zone is wanted by a source while the source is inside the zone load distance
+* extended by interestRadius and is released once the source leaves the extended
+* unload distance. Weight scales how urgently the source's needs are loaded
+*/
+USTRUCT(BlueprintType)
+struct PATHFINDINGPLUGIN_API FZoneStreamingSource
+{
+	GENERATED_BODY()
+
+public:
+	/** @Brief Unique source name */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Zone Streaming")
+	FName sourceName;
+
+	/** @Brief Last reported world position */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Zone Streaming")
+	FVector position;
+
+	/** @Brief Smoothed velocity estimated from position reports */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Zone Streaming")
+	FVector velocity;
+
+	/** @Brief Load urgency multiplier (higher loads this source's zones first) */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Zone Streaming", meta = (ClampMin = "0.01"))
+	float weight;
+
+	/** @Brief Distance added to every zone load/unload distance for this source */
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Zone Streaming", meta = (ClampMin = "0.0"))
+	float interestRadius;
+
+	FZoneStreamingSource()
+		: sourceName(NAME_None)
+		, position(FVector::ZeroVector)
+		, velocity(FVector::ZeroVector)
+		, weight(1.0f)
+		, interestRadius(0.0f)
+	{}
+};
+
+/**
+* @Brief Runtime state of a registered streaming source
+*/
+struct FZoneStreamingSourceState
+{
+	/** @Brief Source configuration and motion */
+	FZoneStreamingSource source;
+
+	/** @Brief World time of the last position report (negative before the first) */
+	double lastSampleTime = -1.0;
+
+	/** @Brief Position reported at least once */
+	bool bHasPosition = false;
+
+	/** @Brief Proximity bands of auto-loading zones relative to this source */
+	FZoneProximityTracker proximityTracker;
+
+	/** @Brief Zones this source currently holds a residency reference on */
+	TSet<FZoneIdentifier> interestedZones;
+
+	/** @Brief Zones held ahead of need by velocity or route prediction (disjoint from interestedZones) */
+	TSet<FZoneIdentifier> prefetchedZones;
+
+	/** @Brief Planned zone sequence the source is following (empty when no route is active) */
+	TArray<FZoneIdentifier> routeZones;
+
+	/** @Brief Furthest routeZones index the source has been inside (INDEX_NONE before the first) */
+	int32 routeProgress = INDEX_NONE;
+};
+
+/**
+* @Brief Prefetch effectiveness counters
+*
+* A prefetch is a load issued because a source was predicted to need the zone. It is
+* a hit when any source later enters the zone load distance and wasted when the zone
+* is released without that happening. Demand loads are zones first wanted by proximity
+* that no prefetch had requested, i.e. streaming that prediction failed to get ahead of
+*/
+USTRUCT(BlueprintType)
+struct PATHFINDINGPLUGIN_API FZonePrefetchStats
+{
+	GENERATED_BODY()
+
+public:
+	/** @Brief Loads issued by prediction */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Zone Streaming")
+	int32 prefetchedZones;
+
+	/** @Brief Prefetched zones later entered by a source */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Zone Streaming")
+	int32 prefetchHits;
+
+	/** @Brief Hits whose zone had finished loading when the source arrived */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Zone Streaming")
+	int32 readyOnArrival;
+
+	/** @Brief Prefetched zones released without being entered */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Zone Streaming")
+	int32 wastedLoads;
+
+	/** @Brief Zones that had to be loaded on arrival without a prefetch */
+	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Zone Streaming")
+	int32 demandLoads;
+
+	FZonePrefetchStats()
+		: prefetchedZones(0)
+		, prefetchHits(0)
+		, readyOnArrival(0)
+		, wastedLoads(0)
+		, demandLoads(0)
+	{}
+
+	/**
+	* @Brief Gets the fraction of resolved prefetches that were hits
+	* @Return : float - Hit rate in [0, 1] (0 before any prefetch resolved)
+	*/
+	float GetHitRate() const
+	{
+		const int32 resolvedCount = prefetchHits + wastedLoads;
+		return resolvedCount > 0 ? static_cast<float>(prefetchHits) / resolvedCount : 0.0f;
+	}
+};
@@ -57,6 +57,63 @@ enum class EZoneLoadState : uint8
 	Error			UMETA(DisplayName = "Error")
 };
 
+/**
+* @Brief Path grid storage backend enumeration
+*
+* Selects how a zone path grid keeps its per-cell cost and blocked data,
+* trading memory footprint against lookup speed for pathfinding queries
+*/
+UENUM(BlueprintType)
+enum class EZonePathGridStorage : uint8
+{
+	Auto			UMETA(DisplayName = "Auto (Volume/Occupancy)"),
+	Sparse			UMETA(DisplayName = "Sparse Map"),
+	Dense			UMETA(DisplayName = "Dense Array"),
+	Compact			UMETA(DisplayName = "Compact (Packed Layers Only)")
+};
+
+/**
+* @Brief Point-to-point grid search algorithm enumeration
+*
+* JumpPoint prunes symmetric paths through uniform-cost cells and expands
+* like A* next to cells with other costs; it needs planar 8-way movement and
+* falls back to A* when diagonal steps are disabled or vertical steps enabled
+*/
+UENUM(BlueprintType)
+enum class EZonePathSearchMode : uint8
+{
+	AStar			UMETA(DisplayName = "A*"),
+	JumpPoint		UMETA(DisplayName = "Jump Point Search")
+};
+
+/**
+* @Brief Path node query state enumeration
+*
+* Distinguishes cells whose collision bake has not run yet from baked cells,
+* so callers can treat partially generated grids conservatively
+*/
+UENUM(BlueprintType)
+enum class EZonePathQueryState : uint8
+{
+	Unknown			UMETA(DisplayName = "Unknown (Not Baked)"),
+	Open			UMETA(DisplayName = "Open"),
+	Blocked			UMETA(DisplayName = "Blocked")
+};
+
+/**
+* @Brief Player proximity band of a zone
+*
+* Bands are separated by the zone load and unload distances; the band between them
+* is a hysteresis region in which a zone keeps its current load state
+*/
+UENUM(BlueprintType)
+enum class EZoneProximityBand : uint8
+{
+	Outside			UMETA(DisplayName = "Outside Unload Distance"),
+	Hysteresis		UMETA(DisplayName = "Between Load And Unload Distance"),
+	Inside			UMETA(DisplayName = "Inside Load Distance")
+};
+
 /**
 * @Brief Zone identification structure for unique zone referencing
 *